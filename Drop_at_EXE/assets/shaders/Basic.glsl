@@ -0,0 +1,19 @@
+// Per-draw path: model + color from the Object UBO. Hot-reloads on save.
+#type vertex
+#version 410 core
+layout(location = 0) in vec3 aPos;
+layout(std140) uniform Camera { mat4 u_ViewProj; };
+layout(std140) uniform Object { mat4 u_Model; vec4 u_Color; };
+void main()
+{
+    gl_Position = u_ViewProj * u_Model * vec4(aPos, 1.0);
+}
+
+#type fragment
+#version 410 core
+out vec4 FragColor;
+layout(std140) uniform Object { mat4 u_Model; vec4 u_Color; };
+void main()
+{
+    FragColor = u_Color;
+}
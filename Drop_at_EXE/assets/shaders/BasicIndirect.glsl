@@ -0,0 +1,25 @@
+// Multi-draw indirect path (GL 4.3): model + color come from the instance
+// SSBO, indexed by the arena's per-instance draw-ID attribute. Hot-reloads on save.
+#type vertex
+#version 430 core
+layout(location = 0) in vec3 aPos;
+layout(location = 2) in uint aDrawID;
+layout(std140) uniform Camera { mat4 u_ViewProj; };
+struct InstanceData { mat4 Model; vec4 Color; };
+layout(std430, binding = 0) readonly buffer Instances { InstanceData u_Instances[]; };
+flat out vec4 v_Color;
+void main()
+{
+    InstanceData instance = u_Instances[aDrawID];
+    v_Color = instance.Color;
+    gl_Position = u_ViewProj * instance.Model * vec4(aPos, 1.0);
+}
+
+#type fragment
+#version 430 core
+flat in vec4 v_Color;
+out vec4 FragColor;
+void main()
+{
+    FragColor = v_Color;
+}
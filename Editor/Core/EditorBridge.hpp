@@ -132,12 +132,7 @@ public:
         if (entity.HasComponent<HierarchyOrderComponent>())
             oldOrder = entity.GetComponent<HierarchyOrderComponent>().Order;
 
-        // Calculate new max order
-        int32_t maxOrder = -1;
-        entity.GetScene()->Reg().view<HierarchyOrderComponent>().each([&](auto e, auto& hc) {
-            if (hc.Order > maxOrder) maxOrder = hc.Order;
-        });
-        int32_t newOrder = maxOrder + 1;
+        int32_t newOrder = entity.GetScene()->AllocateOrder(); // Above every order in the scene
 
         auto cmd = std::make_unique<ReorderEntityCommand>(
             GetScene(entity),
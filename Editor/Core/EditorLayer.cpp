@@ -2,6 +2,8 @@
 #include "EditorBridge.hpp"
 #include <glm/gtc/type_ptr.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstring> // For strncpy_s or manual null termination
 #include <limits>
@@ -16,7 +18,11 @@
 #include <GLFW/glfw3.h>
 #include <glm/glm.hpp>
 
+#include <Core/Application.hpp>
 #include <Core/Input/ViewportInput.hpp>
+#include <Core/Resources/AssetDatabase.hpp>
+#include <Core/Resources/ResourceManager.hpp>
+#include <Rendering/ThumbnailCache.hpp>
 #include <Scene/Scene.hpp>
 #include <Scene/Entity.hpp>
 #include <Scene/Components.hpp>
@@ -156,10 +162,19 @@ void EditorLayer::OnAttach()
     {
         m_ActiveScene = std::make_unique<Scene>();
         SceneAPI::CreateDefaultScene(*m_ActiveScene);
+        m_HierarchyIndex.Attach(m_ActiveScene.get());
     }
+    Renderer::Init(); // Before SceneRenderer: sets up GL state and the shader cache
+    if (Application::Get().GetSpecification().CompareStreamingModes)
+        Renderer::CompareStreamingModes();
     m_SceneRenderer = std::make_shared<SceneRenderer>();
     m_SceneRenderer->Init();
-    Renderer::Init();
+    AssetDatabase::Init(); // Scans assets/, queues re-imports of changed files
+    AssetDatabase::AddChangeCallback([](const AssetRecord& asset)
+    {
+        ResourceManager::Reload(AssetDatabase::GetAbsolutePath(asset)); // Hot reload of saved shaders, textures, models
+    });
+    ThumbnailCache::Init(); // Content Browser previews, generated on demand
     m_EditorCamera.SetViewportSize(m_ViewportSize.x, m_ViewportSize.y);
 }
 
@@ -188,12 +203,21 @@ glm::vec2 EditorLayer::WorldToScreen(const glm::vec3& worldPos, const glm::mat4&
 void EditorLayer::OnDetach()
 {
     EditorBridge::Init(nullptr); // Clear bridge pointer to prevent use-after-free
+    m_HierarchyIndex.Detach(); // Before the registry it listens to goes away
     m_ActiveScene.reset();
     m_SceneRenderer.reset();
+    AssetDatabase::Shutdown(); // Saves the index before the loader drops pending imports
+    ThumbnailCache::Shutdown();
+    ResourceManager::Clear(); // Cached models hold arena ranges
+    Renderer::Shutdown(); // Releases GL buffers while the context is still alive
 }
 
 void EditorLayer::OnUpdate(float deltaTime)
 {
+    AssetDatabase::Update(); // Watched file changes -> re-import + hot reload
+    ThumbnailCache::Update();
+    ResourceManager::Update(); // Async model uploads, time-budgeted
+
     ViewportInput::UpdateCameraState(Input::IsMouseButtonPressed(GLFW_MOUSE_BUTTON_RIGHT));
 
     if (ViewportInput::IsCameraActive())
@@ -228,8 +252,7 @@ void EditorLayer::OnUpdate(float deltaTime)
                  if (!m_ShowDeletePopup && m_SelectedEntity.HasComponent<TransformComponent>()) 
                  {
                     m_ShowDeletePopup = true;
-                    auto& tc = m_SelectedEntity.GetComponent<TransformComponent>();
-                    m_DeletePopupWorldPos = tc.Position;
+                    m_DeletePopupWorldPos = glm::vec3(m_ActiveScene->GetTransforms().GetWorldMatrix(m_SelectedEntity.Handle())[3]);
                     m_DeletePopupNeedsPositioning = true;
                  }
              }
@@ -254,33 +277,13 @@ void EditorLayer::OnUpdate(float deltaTime)
         bool ctrlPressed = Input::IsKeyPressed(GLFW_KEY_LEFT_CONTROL) || Input::IsKeyPressed(GLFW_KEY_RIGHT_CONTROL);
         
         // =====================================================================
-        // Undo / Redo Shortcuts
+        // Undo / Redo Shortcuts (edge-triggered via the input snapshot)
         // =====================================================================
-        if (ctrlPressed && Input::IsKeyPressed(GLFW_KEY_Z))
-        {
-             if (!m_UndoPressedLastFrame) 
-             {
-                 m_CommandHistory.Undo();
-                 m_UndoPressedLastFrame = true;
-             }
-        }
-        else
-        {
-             m_UndoPressedLastFrame = false;
-        }
-        
-        if (ctrlPressed && Input::IsKeyPressed(GLFW_KEY_Y))
-        {
-             if (!m_RedoPressedLastFrame)
-             {
-                 m_CommandHistory.Redo();
-                 m_RedoPressedLastFrame = true;
-             }
-        }
-        else
-        {
-             m_RedoPressedLastFrame = false;
-        }
+        if (ctrlPressed && Input::IsKeyJustPressed(GLFW_KEY_Z))
+            m_CommandHistory.Undo();
+
+        if (ctrlPressed && Input::IsKeyJustPressed(GLFW_KEY_Y))
+            m_CommandHistory.Redo();
 
         // =====================================================================
         // Clipboard / Hierarchy Shortcuts
@@ -288,77 +291,49 @@ void EditorLayer::OnUpdate(float deltaTime)
         if (ctrlPressed && m_SelectedEntity)
         {
             // Copy
-            if (Input::IsKeyPressed(GLFW_KEY_C))
+            if (Input::IsKeyJustPressed(GLFW_KEY_C) && m_SelectedEntity.HasComponent<IDComponent>())
             {
-                if (!m_CopyPressedLastFrame && m_SelectedEntity.HasComponent<IDComponent>())
-                {
-                    m_Clipboard.Mode = ClipboardMode::Copy;
-                    m_Clipboard.EntityID = m_SelectedEntity.GetComponent<IDComponent>().ID;
-                    m_CutEntityID = entt::null;
-                    CORE_INFO("[Clipboard] Entity Copied to clipboard");
-                }
-                m_CopyPressedLastFrame = true;
+                m_Clipboard.Mode = ClipboardMode::Copy;
+                m_Clipboard.EntityID = m_SelectedEntity.GetComponent<IDComponent>().ID;
+                m_CutEntityID = entt::null;
+                CORE_INFO("[Clipboard] Entity Copied to clipboard");
             }
-            else m_CopyPressedLastFrame = false;
 
             // Cut
-            if (Input::IsKeyPressed(GLFW_KEY_X))
+            if (Input::IsKeyJustPressed(GLFW_KEY_X) && m_SelectedEntity.HasComponent<IDComponent>())
             {
-                if (!m_CutPressedLastFrame && m_SelectedEntity.HasComponent<IDComponent>())
-                {
-                    m_Clipboard.Mode = ClipboardMode::Cut;
-                    m_Clipboard.EntityID = m_SelectedEntity.GetComponent<IDComponent>().ID;
-                    m_CutEntityID = m_SelectedEntity.Handle();
-                    CORE_INFO("[Clipboard] Entity Cut to clipboard");
-                }
-                m_CutPressedLastFrame = true;
+                m_Clipboard.Mode = ClipboardMode::Cut;
+                m_Clipboard.EntityID = m_SelectedEntity.GetComponent<IDComponent>().ID;
+                m_CutEntityID = m_SelectedEntity.Handle();
+                CORE_INFO("[Clipboard] Entity Cut to clipboard");
             }
-            else m_CutPressedLastFrame = false;
 
             // Duplicate
-            if (Input::IsKeyPressed(GLFW_KEY_D))
-            {
-                if (!m_DuplicatePressedLastFrame)
-                {
-                    EditorBridge::SubmitDuplicate(m_SelectedEntity, true); // Linked
-                    m_DuplicatePressedLastFrame = true;
-                }
-            }
-            else m_DuplicatePressedLastFrame = false;
-        }
-        else
-        {
-            m_CopyPressedLastFrame = false;
-            m_CutPressedLastFrame = false;
-            m_DuplicatePressedLastFrame = false;
+            if (Input::IsKeyJustPressed(GLFW_KEY_D))
+                EditorBridge::SubmitDuplicate(m_SelectedEntity, true); // Linked
         }
 
         // Paste
-        if (ctrlPressed && Input::IsKeyPressed(GLFW_KEY_V))
+        if (ctrlPressed && Input::IsKeyJustPressed(GLFW_KEY_V) && m_Clipboard.Mode != ClipboardMode::None)
         {
-            if (!m_PastePressedLastFrame && m_Clipboard.Mode != ClipboardMode::None)
+            Entity src = m_ActiveScene->GetEntityByUUID(m_Clipboard.EntityID);
+            if (src)
             {
-                Entity src = m_ActiveScene->GetEntityByUUID(m_Clipboard.EntityID);
-                if (src)
+                if (m_Clipboard.Mode == ClipboardMode::Copy)
                 {
-                    if (m_Clipboard.Mode == ClipboardMode::Copy)
-                    {
-                        EditorBridge::SubmitDuplicate(src, false);
-                        CORE_INFO("[Clipboard] Entity Pasted (Duplicated)");
-                    }
-                    else if (m_Clipboard.Mode == ClipboardMode::Cut)
-                    {
-                        EditorBridge::SubmitReorder(src);
-                        m_Clipboard.Mode = ClipboardMode::None;
-                        m_CutEntityID = entt::null;
-                        m_SelectedEntity = src;
-                        CORE_INFO("[Clipboard] Entity Pasted (Moved)");
-                    }
+                    EditorBridge::SubmitDuplicate(src, false);
+                    CORE_INFO("[Clipboard] Entity Pasted (Duplicated)");
+                }
+                else if (m_Clipboard.Mode == ClipboardMode::Cut)
+                {
+                    EditorBridge::SubmitReorder(src);
+                    m_Clipboard.Mode = ClipboardMode::None;
+                    m_CutEntityID = entt::null;
+                    m_SelectedEntity = src;
+                    CORE_INFO("[Clipboard] Entity Pasted (Moved)");
                 }
             }
-            m_PastePressedLastFrame = true;
         }
-        else m_PastePressedLastFrame = false;
     }
 }
 
@@ -418,104 +393,114 @@ void EditorLayer::DrawHierarchyPanel()
         Entity entityToDelete;
         bool shouldDelete = false;
 
-        // Sort by HierarchyOrderComponent (Professional engines keep order)
-        // We want new entities (higher Order) at top? User said "new entity goes on top"
-        reg.sort<HierarchyOrderComponent>([](const auto& lhs, const auto& rhs) {
-            return lhs.Order > rhs.Order; // Descending = Newer at top
-        });
+        // Rows come from the index (resorted only when orders change); only the visible ones are submitted
+        m_HierarchyIndex.Refresh();
+        const auto& rows = m_HierarchyIndex.GetRows();
+
+        ImGui::SetNextItemWidth(-1.0f);
+        ImGui::InputTextWithHint("##HierarchyFilter", "Search...", m_HierarchyFilter, sizeof(m_HierarchyFilter));
+        const bool filtering = m_HierarchyFilter[0] != '\0';
+        const std::vector<uint32_t>* matches = filtering ? &m_HierarchyIndex.Filter(m_HierarchyFilter) : nullptr;
+        const int rowCount = (int)(filtering ? matches->size() : rows.size());
+
+        ImGui::BeginChild("##HierarchyRows");
 
         // Header style
         ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(0, 5));
-        
-        auto view = reg.view<TagComponent, HierarchyOrderComponent>();
-        for (auto entityHandle : view)
+
+        ImGuiListClipper clipper;
+        clipper.Begin(rowCount);
+        while (clipper.Step())
         {
-            Entity entity(entityHandle, m_ActiveScene.get());
-            auto& tag = reg.get<TagComponent>(entityHandle);
-            
-            bool isSelected = (m_SelectedEntity == entity);
-            bool isCut = (m_CutEntityID == entityHandle);
+            for (int rowIndex = clipper.DisplayStart; rowIndex < clipper.DisplayEnd; ++rowIndex)
+            {
+                entt::entity entityHandle = rows[filtering ? (*matches)[rowIndex] : (uint32_t)rowIndex].Handle;
+                Entity entity(entityHandle, m_ActiveScene.get());
+                auto& tag = reg.get<TagComponent>(entityHandle);
+        
+                bool isSelected = (m_SelectedEntity == entity);
+                bool isCut = (m_CutEntityID == entityHandle);
 
-            ImGuiTreeNodeFlags flags = (isSelected ? ImGuiTreeNodeFlags_Selected : 0) | ImGuiTreeNodeFlags_OpenOnArrow;
-            flags |= ImGuiTreeNodeFlags_SpanAvailWidth; 
-            flags |= ImGuiTreeNodeFlags_Leaf; 
+                ImGuiTreeNodeFlags flags = (isSelected ? ImGuiTreeNodeFlags_Selected : 0) | ImGuiTreeNodeFlags_OpenOnArrow;
+                flags |= ImGuiTreeNodeFlags_SpanAvailWidth; 
+                flags |= ImGuiTreeNodeFlags_Leaf; 
 
-            // Fade the text if cut
-            if (isCut) ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.5f, 0.5f, 0.5f, 0.5f));
+                // Fade the text if cut
+                if (isCut) ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.5f, 0.5f, 0.5f, 0.5f));
 
-            bool opened = ImGui::TreeNodeEx((void*)(uint64_t)entityHandle, flags, "%s", tag.Tag.c_str());
-            
-            if (isCut) ImGui::PopStyleColor();
+                bool opened = ImGui::TreeNodeEx((void*)(uint64_t)entityHandle, flags, "%s", tag.Tag.c_str());
+        
+                if (isCut) ImGui::PopStyleColor();
 
-            // Hover effect
-            if (ImGui::IsItemHovered() && !isSelected)
-            {
-                ImVec2 min = ImGui::GetItemRectMin();
-                ImVec2 max = ImGui::GetItemRectMax();
-                ImGui::GetWindowDrawList()->AddRectFilled(min, max, IM_COL32(50, 120, 200, 40));
-            }
-            
-            if (ImGui::IsItemClicked())
-            {
-                m_SelectedEntity = entity;
-            }
+                // Hover effect
+                if (ImGui::IsItemHovered() && !isSelected)
+                {
+                    ImVec2 min = ImGui::GetItemRectMin();
+                    ImVec2 max = ImGui::GetItemRectMax();
+                    ImGui::GetWindowDrawList()->AddRectFilled(min, max, IM_COL32(50, 120, 200, 40));
+                }
+        
+                if (ImGui::IsItemClicked())
+                {
+                    m_SelectedEntity = entity;
+                }
 
-            // Right click context menu on ITEM
-            if (ImGui::BeginPopupContextItem())
-            {
-                m_SelectedEntity = entity; // Select on right click like Unity
+                // Right click context menu on ITEM
+                if (ImGui::BeginPopupContextItem())
+                {
+                    m_SelectedEntity = entity; // Select on right click like Unity
 
-                if (ImGui::MenuItem("Cut", "Ctrl+X")) {
-                    if (entity.HasComponent<IDComponent>()) {
-                        m_Clipboard.Mode = ClipboardMode::Cut;
-                        m_Clipboard.EntityID = entity.GetComponent<IDComponent>().ID;
-                        m_CutEntityID = entityHandle;
-                    }
-                }
-                if (ImGui::MenuItem("Copy", "Ctrl+C")) {
-                    if (entity.HasComponent<IDComponent>()) {
-                        m_Clipboard.Mode = ClipboardMode::Copy;
-                        m_Clipboard.EntityID = entity.GetComponent<IDComponent>().ID;
-                        m_CutEntityID = entt::null;
+                    if (ImGui::MenuItem("Cut", "Ctrl+X")) {
+                        if (entity.HasComponent<IDComponent>()) {
+                            m_Clipboard.Mode = ClipboardMode::Cut;
+                            m_Clipboard.EntityID = entity.GetComponent<IDComponent>().ID;
+                            m_CutEntityID = entityHandle;
+                        }
                     }
-                }
-                
-                bool canPaste = (m_Clipboard.Mode != ClipboardMode::None);
-                if (!canPaste) ImGui::BeginDisabled();
-                if (ImGui::MenuItem("Paste", "Ctrl+V")) {
-                    Entity src = m_ActiveScene->GetEntityByUUID(m_Clipboard.EntityID);
-                    if (src) {
-                        if (m_Clipboard.Mode == ClipboardMode::Copy) {
-                            EditorBridge::SubmitDuplicate(src, false);
-                        } else if (m_Clipboard.Mode == ClipboardMode::Cut) {
-                            SceneAPI::SetNextOrder(src);
-                            m_Clipboard.Mode = ClipboardMode::None;
+                    if (ImGui::MenuItem("Copy", "Ctrl+C")) {
+                        if (entity.HasComponent<IDComponent>()) {
+                            m_Clipboard.Mode = ClipboardMode::Copy;
+                            m_Clipboard.EntityID = entity.GetComponent<IDComponent>().ID;
                             m_CutEntityID = entt::null;
                         }
                     }
-                }
-                if (!canPaste) ImGui::EndDisabled();
+            
+                    bool canPaste = (m_Clipboard.Mode != ClipboardMode::None);
+                    if (!canPaste) ImGui::BeginDisabled();
+                    if (ImGui::MenuItem("Paste", "Ctrl+V")) {
+                        Entity src = m_ActiveScene->GetEntityByUUID(m_Clipboard.EntityID);
+                        if (src) {
+                            if (m_Clipboard.Mode == ClipboardMode::Copy) {
+                                EditorBridge::SubmitDuplicate(src, false);
+                            } else if (m_Clipboard.Mode == ClipboardMode::Cut) {
+                                SceneAPI::SetNextOrder(src);
+                                m_Clipboard.Mode = ClipboardMode::None;
+                                m_CutEntityID = entt::null;
+                            }
+                        }
+                    }
+                    if (!canPaste) ImGui::EndDisabled();
 
-                if (ImGui::MenuItem("Duplicate", "Ctrl+D")) {
-                    EditorBridge::SubmitDuplicate(entity, true); 
-                }
+                    if (ImGui::MenuItem("Duplicate", "Ctrl+D")) {
+                        EditorBridge::SubmitDuplicate(entity, true); 
+                    }
 
-                ImGui::Separator();
+                    ImGui::Separator();
 
-                if (ImGui::MenuItem("Delete Entity", "Del"))
-                {
-                    entityToDelete = entity;
-                    shouldDelete = true;
+                    if (ImGui::MenuItem("Delete Entity", "Del"))
+                    {
+                        entityToDelete = entity;
+                        shouldDelete = true;
+                    }
+                    ImGui::EndPopup();
                 }
-                ImGui::EndPopup();
-            }
 
-            if (opened)
-            {
-                ImGui::TreePop();
+                if (opened)
+                {
+                    ImGui::TreePop();
+                }
             }
         }
-        
         ImGui::PopStyleVar();
 
         // Right click on blank space to create
@@ -567,6 +552,8 @@ void EditorLayer::DrawHierarchyPanel()
             ImGui::EndPopup();
         }
 
+        ImGui::EndChild();
+
         if (shouldDelete)
         {
             if (m_SelectedEntity == entityToDelete) m_SelectedEntity = {};
@@ -599,7 +586,7 @@ void EditorLayer::DrawInspectorPanel()
             // Draw a simpler name field at the top
             if (ImGui::InputText("##Tag", buffer, sizeof(buffer)))
             {
-                tag.Tag = std::string(buffer);
+                m_SelectedEntity.AddOrReplaceComponent<TagComponent>(std::string(buffer)); // Signalled, so the hierarchy search sees it
             }
              if (ImGui::IsItemActivated()) m_PreviousName = tag.Tag;
              if (ImGui::IsItemDeactivatedAfterEdit() && m_PreviousName != tag.Tag)
@@ -616,6 +603,7 @@ void EditorLayer::DrawInspectorPanel()
             if (ImGui::CollapsingHeader("Transform", ImGuiTreeNodeFlags_DefaultOpen))
             {
                 auto& tc = m_SelectedEntity.GetComponent<TransformComponent>();
+                const TransformComponent before = tc; // Edited in place below - signalled once at the end
                 
                 // Draw column headers
                 ImGui::Columns(4, nullptr, false);
@@ -681,6 +669,9 @@ void EditorLayer::DrawInspectorPanel()
                  if (tc.Scale.x < 0.001f) tc.Scale.x = 0.001f;
                  if (tc.Scale.y < 0.001f) tc.Scale.y = 0.001f;
                  if (tc.Scale.z < 0.001f) tc.Scale.z = 0.001f;
+
+                if (tc.Position != before.Position || tc.Rotation != before.Rotation || tc.Scale != before.Scale)
+                    m_ActiveScene->Reg().patch<TransformComponent>(m_SelectedEntity.Handle());
             }
         }
     }
@@ -694,47 +685,163 @@ void EditorLayer::DrawInspectorPanel()
 
 
 
-// Replaced DrawContentBrowserPanel
 void EditorLayer::DrawContentBrowserPanel()
 {
     ImGui::Begin("Content Browser");
 
-    // Simple grid layout simulation for "Professional" look
+    const AssetDatabase::Directory* directory = AssetDatabase::GetDirectory(m_ContentBrowserDirectory);
+    if (!directory) // Removed by a refresh - back to the root
+    {
+        m_ContentBrowserDirectory.clear();
+        directory = AssetDatabase::GetDirectory(m_ContentBrowserDirectory);
+    }
+
+    // Toolbar: up, current path, refresh
+    ImGui::BeginDisabled(m_ContentBrowserDirectory.empty());
+    if (ImGui::Button("<-"))
+    {
+        size_t slash = m_ContentBrowserDirectory.find_last_of('/');
+        m_ContentBrowserDirectory = slash == std::string::npos ? std::string() : m_ContentBrowserDirectory.substr(0, slash);
+    }
+    ImGui::EndDisabled();
+    ImGui::SameLine();
+    ImGui::Text("%s/%s", AssetDatabase::GetRoot().c_str(), m_ContentBrowserDirectory.c_str());
+    ImGui::SameLine();
+    if (ImGui::Button("Refresh"))
+    {
+        AssetDatabase::Refresh();
+        AssetDatabase::LogStats();
+    }
+    ImGui::SameLine();
+    ImGui::TextDisabled("%zu assets | %d drawn in %.2f ms", AssetDatabase::GetAssetCount(),
+                        m_ContentBrowserDrawnItems, m_ContentBrowserGridMs);
+    if (uint32_t pending = AssetDatabase::GetPendingImports())
+    {
+        ImGui::SameLine();
+        ImGui::TextDisabled("(importing %u)", pending);
+    }
+    ImGui::Separator();
+
     static float padding = 50.0f;
     static float thumbnailSize = 96.0f;
-    float cellSize = thumbnailSize + padding;
+    const ImGuiStyle& style = ImGui::GetStyle();
+    const float cellWidth = thumbnailSize + padding;
+    const float lineHeight = ImGui::GetTextLineHeightWithSpacing();
+    const float rowHeight = thumbnailSize + style.FramePadding.y * 2.0f + style.ItemSpacing.y + lineHeight * 2.0f;
+
+    // Fixed-size cells in rows: only the rows in view reach ImGui (and ask
+    // for thumbnails), so a folder of 50k assets costs what one of 50 does
+    auto gridStart = std::chrono::steady_clock::now();
+    int drawnItems = 0;
+    ImGui::BeginChild("##ContentGrid", ImVec2(0.0f, -ImGui::GetFrameHeightWithSpacing()));
+
+    const int columnCount = std::max(1, (int)(ImGui::GetContentRegionAvail().x / cellWidth));
+    if (directory)
+    {
+        const size_t folderCount = directory->Children.size();
+        const size_t itemCount = folderCount + directory->Assets.size();
+        const float startX = ImGui::GetCursorPosX();
+        std::string openDirectory;
 
-    float panelWidth = ImGui::GetContentRegionAvail().x;
-    int columnCount = (int)(panelWidth / cellSize);
-    if (columnCount < 1) columnCount = 1;
+        // Name on one line, clipped to the cell
+        auto drawLabel = [&](const char* text, bool disabled)
+        {
+            ImVec2 position = ImGui::GetCursorScreenPos();
+            ImGui::PushClipRect(position, ImVec2(position.x + cellWidth - style.ItemSpacing.x, position.y + lineHeight), true);
+            if (disabled) ImGui::TextDisabled("%s", text);
+            else ImGui::TextUnformatted(text);
+            ImGui::PopClipRect();
+        };
+
+        ImGuiListClipper clipper;
+        clipper.Begin((int)((itemCount + columnCount - 1) / columnCount), rowHeight);
+        while (clipper.Step())
+        {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+            {
+                const float rowY = ImGui::GetCursorPosY();
+                for (int column = 0; column < columnCount; column++)
+                {
+                    const size_t index = (size_t)row * columnCount + column;
+                    if (index >= itemCount) break;
+                    ImGui::SetCursorPos(ImVec2(startX + column * cellWidth, rowY));
+                    ImGui::BeginGroup();
+                    drawnItems++;
 
-    ImGui::Columns(columnCount, 0, false);
+                    if (index < folderCount)
+                    {
+                        const std::string& child = directory->Children[index];
+                        ImGui::PushID(child.c_str());
+                        ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0, 0, 0, 0));
+                        ImGui::ImageButton("##folder", (ImTextureID)0, ImVec2(thumbnailSize, thumbnailSize), ImVec2(0, 1), ImVec2(1, 0));
+                        ImGui::PopStyleColor();
+                        if (ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left))
+                            openDirectory = child;
+
+                        size_t slash = child.find_last_of('/');
+                        std::string name = (slash == std::string::npos ? child : child.substr(slash + 1)) + "/";
+                        drawLabel(name.c_str(), false);
+                        ImGui::PopID();
+                        ImGui::EndGroup();
+                        continue;
+                    }
 
-    // Dummy Assets
-    const char* assets[] = { "Scene.sc", "Player.obj", "Tex.png", "Script.lua", "Audio.wav" };
+                    const AssetRecord* asset = AssetDatabase::Find(directory->Assets[index - folderCount]);
+                    if (!asset)
+                    {
+                        ImGui::EndGroup();
+                        continue;
+                    }
 
-    for (int i = 0; i < 5; i++)
-    {
-        ImGui::PushID(i);
-        // Placeholder button as thumbnail
-        ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0, 0, 0, 0));
-        ImGui::ImageButton("##asset", (ImTextureID)0, ImVec2(thumbnailSize, thumbnailSize), ImVec2(0, 1), ImVec2(1, 0));
-        
-        // Drag Source (Example)
-        if (ImGui::BeginDragDropSource())
-        {
-            ImGui::SetDragDropPayload("CONTENT_BROWSER_ITEM", assets[i], strlen(assets[i]) + 1);
-            ImGui::Text("%s", assets[i]);
-            ImGui::EndDragDropSource();
+                    size_t slash = asset->Path.find_last_of('/');
+                    const char* name = slash == std::string::npos ? asset->Path.c_str() : asset->Path.c_str() + slash + 1;
+
+                    // Blank until the worker has made it
+                    ThumbnailCache::Thumbnail thumbnail = ThumbnailCache::Get(*asset);
+
+                    ImGui::PushID((void*)(uintptr_t)(uint64_t)asset->ID);
+                    ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0, 0, 0, 0));
+                    ImGui::ImageButton("##asset", (ImTextureID)(intptr_t)thumbnail.TextureID, ImVec2(thumbnailSize, thumbnailSize),
+                                       ImVec2(thumbnail.U0, thumbnail.V0), ImVec2(thumbnail.U1, thumbnail.V1));
+
+                    // Drag source: absolute path, ready for ResourceManager
+                    if (ImGui::BeginDragDropSource())
+                    {
+                        std::string path = AssetDatabase::GetAbsolutePath(*asset);
+                        ImGui::SetDragDropPayload("CONTENT_BROWSER_ITEM", path.c_str(), path.size() + 1);
+                        ImGui::Text("%s", name);
+                        ImGui::EndDragDropSource();
+                    }
+                    else if (ImGui::IsItemHovered())
+                    {
+                        ImGui::SetTooltip("%s\n%s, %llu KB\nUUID %016llx\nHash %016llx%s", asset->Path.c_str(),
+                                          AssetDatabase::GetTypeName(asset->Type), (unsigned long long)(asset->Size / 1024),
+                                          (unsigned long long)(uint64_t)asset->ID, (unsigned long long)asset->ContentHash,
+                                          asset->ImportedHash == asset->ContentHash ? "" : "\nNot imported");
+                    }
+
+                    ImGui::PopStyleColor();
+                    drawLabel(name, false);
+                    drawLabel(AssetDatabase::GetTypeName(asset->Type), true);
+                    ImGui::PopID();
+                    ImGui::EndGroup();
+                }
+
+                // Every row advances by exactly rowHeight, as the clipper assumes
+                ImGui::SetCursorPos(ImVec2(startX, rowY));
+                ImGui::Dummy(ImVec2(1.0f, rowHeight - style.ItemSpacing.y));
+            }
         }
+        clipper.End();
 
-        ImGui::PopStyleColor();
-        ImGui::TextWrapped("%s", assets[i]);
-        ImGui::NextColumn();
-        ImGui::PopID();
+        if (!openDirectory.empty())
+            m_ContentBrowserDirectory = openDirectory;
     }
 
-    ImGui::Columns(1);
+    ImGui::EndChild();
+    m_ContentBrowserGridMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - gridStart).count();
+    m_ContentBrowserDrawnItems = drawnItems;
+
     ImGui::SliderFloat("Thumbnail Size", &thumbnailSize, 16, 512);
     ImGui::End();
 }
@@ -765,9 +872,9 @@ void EditorLayer::DrawViewportPanel()
         // Calculate delete popup screen position if needed
         if (m_DeletePopupNeedsPositioning && m_SelectedEntity && m_SelectedEntity.HasComponent<TransformComponent>())
         {
-            auto& tc = m_SelectedEntity.GetComponent<TransformComponent>();
+            glm::vec3 worldPosition = glm::vec3(m_ActiveScene->GetTransforms().GetWorldMatrix(m_SelectedEntity.Handle())[3]);
             m_DeletePopupPos = WorldToScreen(
-                tc.Position,
+                worldPosition,
                 m_EditorCamera.GetViewMatrix(),
                 m_EditorCamera.GetProjectionMatrix(),
                 m_ViewportSize,
@@ -803,8 +910,10 @@ void EditorLayer::DrawViewportPanel()
             const glm::mat4& cameraProjection = m_EditorCamera.GetProjectionMatrix();
             glm::mat4 cameraView = m_EditorCamera.GetViewMatrix();
             auto& tc = m_SelectedEntity.GetComponent<TransformComponent>();
-            // Disable preview accumulation - work directly on component
-            glm::mat4 transform = tc.GetMatrix();
+            // The gizmo works in world space; children are written back relative to their parent
+            TransformHierarchy& transforms = m_ActiveScene->GetTransforms();
+            entt::entity parent = transforms.GetParent(m_SelectedEntity.Handle());
+            glm::mat4 transform = transforms.GetWorldMatrix(m_SelectedEntity.Handle());
             glm::mat4 deltaMatrix(1.0f);
 
             bool snap = Input::IsKeyPressed(GLFW_KEY_LEFT_CONTROL);
@@ -827,12 +936,13 @@ void EditorLayer::DrawViewportPanel()
                 }
 
                 // LIVE UPDATE: Decompose immediately to support inspector updates
+                glm::mat4 local = parent != entt::null ? glm::inverse(transforms.GetWorldMatrix(parent)) * transform : transform;
                 glm::vec3 scale;
                 glm::quat rotation;
                 glm::vec3 translation;
                 glm::vec3 skew;
                 glm::vec4 perspective;
-                glm::decompose(transform, scale, rotation, translation, skew, perspective);
+                glm::decompose(local, scale, rotation, translation, skew, perspective);
 
                 tc.Position = translation;
                 tc.Rotation = glm::degrees(glm::eulerAngles(rotation));
@@ -843,6 +953,7 @@ void EditorLayer::DrawViewportPanel()
                 if (scale.z < 0.001f) scale.z = 0.001f;
                 
                 tc.Scale = scale;
+                m_ActiveScene->Reg().patch<TransformComponent>(m_SelectedEntity.Handle());
             }
             else if (m_WasUsingGizmo)
             {
@@ -874,13 +985,13 @@ void EditorLayer::DrawViewportPanel()
                  m_SelectedEntity = {};
                  float minT = FLT_MAX;
                  auto& reg = m_ActiveScene->Reg();
-                 reg.view<TransformComponent, MeshComponent>().each([&](auto entity, TransformComponent& tc, MeshComponent& mc) {
+                 reg.view<WorldTransformComponent, MeshComponent>().each([&](auto entity, WorldTransformComponent& world, MeshComponent& mc) {
                      if (!mc.MeshHandle) return;
                      
                      glm::vec3 minB = mc.MeshHandle->GetMinAABB();
                      glm::vec3 maxB = mc.MeshHandle->GetMaxAABB();
 
-                     glm::mat4 invModel = glm::inverse(tc.GetMatrix());
+                     glm::mat4 invModel = glm::inverse(world.Matrix);
                      glm::vec3 localRayOrigin = glm::vec3(invModel * glm::vec4(rayOrigin, 1.0f));
                      glm::vec3 localRayDir = glm::normalize(glm::vec3(invModel * glm::vec4(rayDir, 0.0f)));
                      float t;
@@ -8,6 +8,7 @@
 #include <Scene/Scene.hpp>
 #include <Scene/Entity.hpp>
 #include <Scene/Components.hpp>
+#include <Scene/HierarchyIndex.hpp>
 #include <Rendering/Framebuffer/Framebuffer.hpp>
 #include <Rendering/Renderer.hpp>
 #include <Rendering/Buffers/VertexArray.hpp>
@@ -39,6 +40,10 @@ private:
     std::unique_ptr<Scene> m_ActiveScene;
     Entity m_SelectedEntity;
 
+    // Hierarchy: cached row order + search index; declared after the scene so it detaches first
+    HierarchyIndex m_HierarchyIndex;
+    char m_HierarchyFilter[128] = {};
+
     // Rendering
     std::shared_ptr<SceneRenderer> m_SceneRenderer;
     glm::vec2 m_ViewportSize = { 1280.0f, 720.0f };
@@ -68,14 +73,6 @@ private:
     entt::entity m_GizmoPreviewEntity = entt::null;
     glm::mat4 m_GizmoPreviewMatrix{ 1.0f };
 
-    // Shortcuts state
-    bool m_UndoPressedLastFrame = false;
-    bool m_RedoPressedLastFrame = false;
-    bool m_CopyPressedLastFrame = false;
-    bool m_CutPressedLastFrame = false;
-    bool m_PastePressedLastFrame = false;
-    bool m_DuplicatePressedLastFrame = false;
-
     // Clipboard State
     enum class ClipboardMode { None, Copy, Cut };
     struct ClipboardRecord {
@@ -90,6 +87,11 @@ private:
     bool m_DeletePopupNeedsPositioning = false;
     entt::entity m_CutEntityID = entt::null; // For visual fading in hierarchy
 
+    // Content Browser: directory relative to the asset root, "" = root
+    std::string m_ContentBrowserDirectory;
+    float m_ContentBrowserGridMs = 0.0f;    // CPU time of the grid last frame
+    int m_ContentBrowserDrawnItems = 0;     // Cells submitted last frame (visible rows only)
+
     // Internal helpers
     void DrawHierarchyPanel();
     void DrawInspectorPanel();
@@ -11,6 +11,66 @@
 
 #include <iostream>
 #include <Core/Log.hpp>
+#include <Core/Events/KeyEvent.hpp>
+#include <Core/Events/MouseEvent.hpp>
+#include <Rendering/GLState.hpp>
+
+namespace
+{
+    // Replayed key events carry GLFW key codes; the backend's own translation
+    // table is internal, so map the keys the editor actually uses
+    ImGuiKey ToImGuiKey(int key)
+    {
+        if (key >= GLFW_KEY_A && key <= GLFW_KEY_Z)
+            return (ImGuiKey)(ImGuiKey_A + (key - GLFW_KEY_A));
+        if (key >= GLFW_KEY_0 && key <= GLFW_KEY_9)
+            return (ImGuiKey)(ImGuiKey_0 + (key - GLFW_KEY_0));
+        if (key >= GLFW_KEY_F1 && key <= GLFW_KEY_F12)
+            return (ImGuiKey)(ImGuiKey_F1 + (key - GLFW_KEY_F1));
+
+        switch (key)
+        {
+            case GLFW_KEY_TAB:           return ImGuiKey_Tab;
+            case GLFW_KEY_LEFT:          return ImGuiKey_LeftArrow;
+            case GLFW_KEY_RIGHT:         return ImGuiKey_RightArrow;
+            case GLFW_KEY_UP:            return ImGuiKey_UpArrow;
+            case GLFW_KEY_DOWN:          return ImGuiKey_DownArrow;
+            case GLFW_KEY_PAGE_UP:       return ImGuiKey_PageUp;
+            case GLFW_KEY_PAGE_DOWN:     return ImGuiKey_PageDown;
+            case GLFW_KEY_HOME:          return ImGuiKey_Home;
+            case GLFW_KEY_END:           return ImGuiKey_End;
+            case GLFW_KEY_INSERT:        return ImGuiKey_Insert;
+            case GLFW_KEY_DELETE:        return ImGuiKey_Delete;
+            case GLFW_KEY_BACKSPACE:     return ImGuiKey_Backspace;
+            case GLFW_KEY_SPACE:         return ImGuiKey_Space;
+            case GLFW_KEY_ENTER:         return ImGuiKey_Enter;
+            case GLFW_KEY_KP_ENTER:      return ImGuiKey_KeypadEnter;
+            case GLFW_KEY_ESCAPE:        return ImGuiKey_Escape;
+            case GLFW_KEY_LEFT_SHIFT:    return ImGuiKey_LeftShift;
+            case GLFW_KEY_RIGHT_SHIFT:   return ImGuiKey_RightShift;
+            case GLFW_KEY_LEFT_CONTROL:  return ImGuiKey_LeftCtrl;
+            case GLFW_KEY_RIGHT_CONTROL: return ImGuiKey_RightCtrl;
+            case GLFW_KEY_LEFT_ALT:      return ImGuiKey_LeftAlt;
+            case GLFW_KEY_RIGHT_ALT:     return ImGuiKey_RightAlt;
+            case GLFW_KEY_LEFT_SUPER:    return ImGuiKey_LeftSuper;
+            case GLFW_KEY_RIGHT_SUPER:   return ImGuiKey_RightSuper;
+            default:                     return ImGuiKey_None;
+        }
+    }
+
+    // Modifier state is derived from the key itself, as the GLFW backend does
+    ImGuiKey ToImGuiMod(int key)
+    {
+        switch (key)
+        {
+            case GLFW_KEY_LEFT_SHIFT:   case GLFW_KEY_RIGHT_SHIFT:   return ImGuiMod_Shift;
+            case GLFW_KEY_LEFT_CONTROL: case GLFW_KEY_RIGHT_CONTROL: return ImGuiMod_Ctrl;
+            case GLFW_KEY_LEFT_ALT:     case GLFW_KEY_RIGHT_ALT:     return ImGuiMod_Alt;
+            case GLFW_KEY_LEFT_SUPER:   case GLFW_KEY_RIGHT_SUPER:   return ImGuiMod_Super;
+            default:                                                 return ImGuiKey_None;
+        }
+    }
+}
 
 ImGuiLayer::ImGuiLayer() : Layer("ImGuiLayer") {}
 ImGuiLayer::~ImGuiLayer() {}
@@ -32,6 +92,13 @@ void ImGuiLayer::OnAttach()
     io.ConfigFlags |= ImGuiConfigFlags_DpiEnableScaleFonts;
     io.ConfigFlags |= ImGuiConfigFlags_DpiEnableScaleViewports;
 
+    // A replay only carries main-window input (window-relative coordinates), and
+    // the backend installs live callbacks on every secondary viewport it creates,
+    // so keep everything inside the main window for the duration of the replay
+    m_FeedReplay = !Application::Get().GetSpecification().ReplayEventsPath.empty();
+    if (m_FeedReplay)
+        io.ConfigFlags &= ~ImGuiConfigFlags_ViewportsEnable;
+
     // Fix window stacking issue (floating panels going behind main window)
     ImGui::GetIO().ConfigViewportsNoDecoration = false;
     ImGui::GetIO().ConfigViewportsNoTaskBarIcon = true;
@@ -139,7 +206,9 @@ void ImGuiLayer::OnAttach()
 
 
     // Setup Platform/Renderer backends
-    ImGui_ImplGlfw_InitForOpenGL(window, true);
+    // During a replay ImGui is fed from OnEvent; installing the backend's GLFW
+    // callbacks would let live input through alongside the recorded stream
+    ImGui_ImplGlfw_InitForOpenGL(window, !m_FeedReplay);
 #ifdef __APPLE__
     ImGui_ImplOpenGL3_Init("#version 410 core");
 #else
@@ -161,6 +230,56 @@ void ImGuiLayer::OnDetach()
     ImGui::DestroyContext();
 }
 
+void ImGuiLayer::OnEvent(EventSystem::Event& event)
+{
+    if (!m_Enabled || !m_FeedReplay)
+        return;
+
+    using namespace EventSystem;
+    ImGuiIO& io = ImGui::GetIO();
+
+    switch (event.GetEventType())
+    {
+        case EventType::MouseMoved:
+        {
+            auto& e = static_cast<MouseMovedEvent&>(event);
+            m_ReplayMousePos = ImVec2(e.GetX(), e.GetY());
+            io.AddMousePosEvent(m_ReplayMousePos.x, m_ReplayMousePos.y);
+            break;
+        }
+        case EventType::MouseButtonPressed:
+        case EventType::MouseButtonReleased:
+        {
+            int button = static_cast<MouseButtonEvent&>(event).GetMouseButton();
+            if (button >= 0 && button < ImGuiMouseButton_COUNT)
+                io.AddMouseButtonEvent(button, event.GetEventType() == EventType::MouseButtonPressed);
+            break;
+        }
+        case EventType::MouseScrolled:
+        {
+            auto& e = static_cast<MouseScrolledEvent&>(event);
+            io.AddMouseWheelEvent(e.GetXOffset(), e.GetYOffset());
+            break;
+        }
+        case EventType::KeyPressed:
+        case EventType::KeyReleased:
+        {
+            int key = static_cast<KeyEvent&>(event).GetKeyCode();
+            bool down = event.GetEventType() == EventType::KeyPressed;
+            if (ImGuiKey mod = ToImGuiMod(key); mod != ImGuiKey_None)
+                io.AddKeyEvent(mod, down);
+            if (ImGuiKey imKey = ToImGuiKey(key); imKey != ImGuiKey_None)
+                io.AddKeyEvent(imKey, down);
+            break;
+        }
+        case EventType::KeyTyped:
+            io.AddInputCharacter((unsigned int)static_cast<KeyTypedEvent&>(event).GetKeyCode());
+            break;
+        default:
+            break;
+    }
+}
+
 void ImGuiLayer::Begin()
 {
     if (!m_Enabled)
@@ -168,6 +287,12 @@ void ImGuiLayer::Begin()
 
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplGlfw_NewFrame();
+
+    // Without a cursor-enter callback the backend polls the live cursor every
+    // frame; queue the replayed position after it so the recorded one wins
+    if (m_FeedReplay)
+        ImGui::GetIO().AddMousePosEvent(m_ReplayMousePos.x, m_ReplayMousePos.y);
+
     ImGui::NewFrame();
 }
 
@@ -180,6 +305,7 @@ void ImGuiLayer::End()
 
     ImGui::Render();
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    GLState::Invalidate(); // Backend changed GL state behind the cache's back
 
     // Viewport windows (optional but looks professional)
     if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
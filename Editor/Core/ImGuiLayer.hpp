@@ -2,6 +2,7 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include <imgui.h>
+#include <cfloat>
 #include "Core/Layer.hpp"
 
 class ImGuiLayer : public Layer
@@ -12,6 +13,7 @@ public:
 
     void OnAttach() override;
     void OnDetach() override;
+    void OnEvent(EventSystem::Event& event) override;
 
     void Begin();
     void End();
@@ -20,4 +22,8 @@ public:
 
 private:
     bool m_Enabled = false;
+
+    // Event replay: ImGui reads the replayed stream instead of live GLFW input
+    bool m_FeedReplay = false;
+    ImVec2 m_ReplayMousePos = ImVec2(-FLT_MAX, -FLT_MAX);
 };
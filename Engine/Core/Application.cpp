@@ -4,6 +4,9 @@
 #include <iostream>
 
 #include "Log.hpp"
+#include "Input/Input.hpp"
+#include "Events/EventRecorder.hpp"
+#include <Rendering/GLState.hpp>
 
 // Static singleton instance
 Application* Application::s_Instance = nullptr;
@@ -19,12 +22,16 @@ Application::Application(const ApplicationSpecification& spec)
     }
     s_Instance = this;
 
+    ParseCommandLine();
+
     // Create the window with specification
     WindowProps windowProps(
-        spec.Name,
-        spec.WindowWidth,
-        spec.WindowHeight
+        m_Specification.Name,
+        m_Specification.WindowWidth,
+        m_Specification.WindowHeight
     );
+    windowProps.Visible = !m_Specification.Headless;
+    windowProps.VSync = !m_Specification.Headless && !m_Specification.ReplayMaxSpeed;
     m_Window = std::unique_ptr<Window>(Window::Create(windowProps));
     
     if (m_Window && m_Window->GetNativeWindow())
@@ -45,6 +52,25 @@ Application::~Application()
     s_Instance = nullptr;
 }
 
+void Application::ParseCommandLine()
+{
+    const auto& args = m_Specification.CommandLineArgs;
+    for (int i = 1; i < args.Count; i++)
+    {
+        std::string arg = args[i];
+        if (arg == "--headless")
+            m_Specification.Headless = true;
+        else if (arg == "--replay-fast")
+            m_Specification.ReplayMaxSpeed = true;
+        else if (arg == "--compare-streaming")
+            m_Specification.CompareStreamingModes = true;
+        else if (arg == "--record-events" && i + 1 < args.Count)
+            m_Specification.RecordEventsPath = args[++i];
+        else if (arg == "--replay-events" && i + 1 < args.Count)
+            m_Specification.ReplayEventsPath = args[++i];
+    }
+}
+
 void Application::Run()
 {
     if (!m_Running)
@@ -58,6 +84,17 @@ void Application::Run()
     // ========================================================================
     OnInit();
 
+    if (!m_Specification.RecordEventsPath.empty())
+        EventRecorder::Start(m_Specification.RecordEventsPath);
+
+    if (!m_Specification.ReplayEventsPath.empty())
+    {
+        auto speed = m_Specification.ReplayMaxSpeed ? EventReplayer::Speed::Max : EventReplayer::Speed::Recorded;
+        if (!EventReplayer::Start(m_Specification.ReplayEventsPath, speed,
+                                  std::bind(&Application::OnEvent, this, std::placeholders::_1)))
+            m_Running = false;
+    }
+
     m_LastFrameTime = (float)glfwGetTime();
 
     // ========================================================================
@@ -70,6 +107,13 @@ void Application::Run()
         float deltaTime = time - m_LastFrameTime;
         m_LastFrameTime = time;
 
+        // Replay feeds this frame's recorded events (and, at max speed, its recorded delta)
+        if (EventReplayer::IsReplaying() && !EventReplayer::Update(deltaTime))
+            Close(); // Recording exhausted - report has been logged
+
+        // Publish the input gathered during the previous poll as this frame's snapshot
+        Input::NewFrame();
+
         // Skip rendering if minimized
         if (!m_Minimized)
         {
@@ -88,6 +132,9 @@ void Application::Run()
     // ========================================================================
     // Post-Loop Shutdown
     // ========================================================================
+    EventRecorder::Stop();
+    EventReplayer::Stop();
+
     OnShutdown();
 }
 
@@ -103,6 +150,9 @@ void Application::PushOverlay(Layer* layer)
 
 void Application::OnEvent(EventSystem::Event& e)
 {
+    // Input snapshot sees every event, even ones a layer marks Handled
+    Input::OnEvent(e);
+
     EventSystem::EventDispatcher dispatcher(e);
     // Dispatch window events to Application methods
     dispatcher.Dispatch<EventSystem::WindowCloseEvent>(std::bind(&Application::OnWindowClose, this, std::placeholders::_1));
@@ -134,7 +184,7 @@ bool Application::OnWindowResize(EventSystem::WindowResizeEvent& e)
     m_Minimized = false;
     
     // Resize viewport if necessary, though typically handled in client Or Renderer
-    glViewport(0, 0, e.GetWidth(), e.GetHeight());
+    GLState::SetViewport(0, 0, (int)e.GetWidth(), (int)e.GetHeight());
     
     return false;
 }
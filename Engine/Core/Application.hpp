@@ -55,6 +55,16 @@ struct ApplicationSpecification
     uint32_t WindowWidth = 1280;
     uint32_t WindowHeight = 720;
     ApplicationCommandLineArgs CommandLineArgs;
+
+    // Session capture / deterministic replay (see Events/EventRecorder.hpp).
+    // Filled from CommandLineArgs if not set explicitly.
+    bool Headless = false;
+    std::string RecordEventsPath = "";
+    std::string ReplayEventsPath = "";
+    bool ReplayMaxSpeed = false;
+
+    // --compare-streaming: run Renderer::CompareStreamingModes() once the renderer is up
+    bool CompareStreamingModes = false;
 };
 
 // ============================================================================
@@ -135,6 +145,8 @@ public:
     void PushOverlay(Layer* layer);
 
 private:
+    void ParseCommandLine();
+
     bool OnWindowClose(EventSystem::WindowCloseEvent& e);
     bool OnWindowResize(EventSystem::WindowResizeEvent& e);
 
@@ -7,6 +7,7 @@
 #include <Scene/SceneAPI.hpp>
 #include <Rendering/Mesh/Mesh.hpp>
 #include <memory>
+#include <vector>
 #include <Core/UUID.hpp>
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/string_cast.hpp>
@@ -103,6 +104,23 @@ public:
 
         if (reg.any_of<HierarchyOrderComponent>(handle))
             m_HierarchyComp = reg.get<HierarchyOrderComponent>(handle);
+
+        // Destroying unlinks the children (they become roots), so remember the links by UUID
+        if (const RelationshipComponent* links = reg.try_get<RelationshipComponent>(handle))
+        {
+            if (links->Parent != entt::null && reg.any_of<IDComponent>(links->Parent))
+            {
+                m_HasParent = true;
+                m_ParentUUID = reg.get<IDComponent>(links->Parent).ID;
+            }
+
+            for (entt::entity child = links->FirstChild; child != entt::null;
+                 child = reg.get<RelationshipComponent>(child).NextSibling)
+            {
+                if (reg.all_of<IDComponent, TransformComponent>(child))
+                    m_Children.push_back({ reg.get<IDComponent>(child).ID, reg.get<TransformComponent>(child) });
+            }
+        }
     }
 
     void Execute() override
@@ -128,9 +146,7 @@ public:
             restored.GetComponent<TagComponent>() = m_TagComp;
 
         // Restore components logic
-        if (!restored.HasComponent<TransformComponent>())
-            restored.AddComponent<TransformComponent>();
-        restored.GetComponent<TransformComponent>() = m_TransformComp;
+        restored.AddOrReplaceComponent<TransformComponent>(m_TransformComp);
         
         if (m_MeshComp.MeshHandle)
         {
@@ -149,9 +165,25 @@ public:
             restored.AddComponent<DuplicationComponent>() = m_DuplicationComp;
         }
 
-        if (!restored.HasComponent<HierarchyOrderComponent>())
-            restored.AddComponent<HierarchyOrderComponent>();
-        restored.GetComponent<HierarchyOrderComponent>() = m_HierarchyComp;
+        // Through the registry, so the order is signalled (hierarchy index, order counter)
+        restored.AddOrReplaceComponent<HierarchyOrderComponent>(m_HierarchyComp);
+
+        // Relink, then put the captured local transforms back (keep-world goes through matrices)
+        TransformHierarchy& transforms = m_Scene->GetTransforms();
+        if (m_HasParent)
+        {
+            Entity parent = m_Scene->GetEntityByUUID(m_ParentUUID);
+            if (parent && transforms.SetParent(restored.Handle(), parent.Handle(), true))
+                restored.AddOrReplaceComponent<TransformComponent>(m_TransformComp);
+        }
+
+        // Linking prepends, so walk backwards to get the original sibling order
+        for (auto it = m_Children.rbegin(); it != m_Children.rend(); ++it)
+        {
+            Entity child = m_Scene->GetEntityByUUID(it->ID);
+            if (child && transforms.SetParent(child.Handle(), restored.Handle(), true))
+                child.AddOrReplaceComponent<TransformComponent>(it->Transform);
+        }
     }
 
     std::string GetDescription() const override
@@ -173,6 +205,16 @@ private:
 
     bool m_HasDuplication = false;
     DuplicationComponent m_DuplicationComp;
+
+    struct ChildLink
+    {
+        Core::UUID ID;
+        TransformComponent Transform; // Local, relative to this entity
+    };
+
+    bool m_HasParent = false;
+    Core::UUID m_ParentUUID;
+    std::vector<ChildLink> m_Children;
 };
 
 
@@ -202,8 +244,7 @@ public:
             return;
         }
         
-        auto& tc = entity.GetComponent<TransformComponent>();
-        tc = m_NewTransform;
+        entity.AddOrReplaceComponent<TransformComponent>(m_NewTransform);
     }
 
     void Undo() override
@@ -214,8 +255,7 @@ public:
             return;
         }
         
-        auto& tc = entity.GetComponent<TransformComponent>();
-        tc = m_OldTransform;
+        entity.AddOrReplaceComponent<TransformComponent>(m_OldTransform);
     }
 
     std::string GetDescription() const override
@@ -250,14 +290,14 @@ public:
     {
         Entity entity = m_Scene->GetEntityByUUID(m_EntityUUID);
         if (entity)
-            entity.GetComponent<TagComponent>().Tag = m_NewName;
+            entity.AddOrReplaceComponent<TagComponent>(m_NewName);
     }
 
     void Undo() override
     {
         Entity entity = m_Scene->GetEntityByUUID(m_EntityUUID);
         if (entity)
-            entity.GetComponent<TagComponent>().Tag = m_OldName;
+            entity.AddOrReplaceComponent<TagComponent>(m_OldName);
     }
 
     std::string GetDescription() const override
@@ -0,0 +1,283 @@
+#include "EventRecorder.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+#include "ApplicationEvent.hpp"
+#include "KeyEvent.hpp"
+#include "MouseEvent.hpp"
+#include <Core/Log.hpp>
+
+using namespace EventSystem;
+
+namespace
+{
+    constexpr uint32_t RECORDING_MAGIC = 0x31525645; // "EVR1"
+
+    struct RecordingHeader
+    {
+        uint32_t Magic = RECORDING_MAGIC;
+        uint32_t RecordSize = sizeof(RecordedEvent);
+    };
+
+    std::ofstream s_RecordFile;
+
+    double Now()
+    {
+        using namespace std::chrono;
+        return duration<double>(steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+// ============================================================================
+// EventRecorder
+// ============================================================================
+bool EventRecorder::s_Recording = false;
+double EventRecorder::s_StartTime = 0.0;
+
+bool EventRecorder::Start(const std::string& path)
+{
+    Stop();
+
+    s_RecordFile.open(path, std::ios::binary | std::ios::trunc);
+    if (!s_RecordFile.is_open())
+    {
+        CORE_ERROR("[EventRecorder] Failed to open {0}", path);
+        return false;
+    }
+
+    RecordingHeader header;
+    s_RecordFile.write((const char*)&header, sizeof(header));
+
+    s_StartTime = Now();
+    s_Recording = true;
+    CORE_INFO("[EventRecorder] Recording events to {0}", path);
+    return true;
+}
+
+void EventRecorder::Stop()
+{
+    if (!s_Recording) return;
+
+    s_RecordFile.close();
+    s_Recording = false;
+    CORE_INFO("[EventRecorder] Recording stopped.");
+}
+
+void EventRecorder::Record(const Event& e)
+{
+    if (!s_Recording) return;
+
+    RecordedEvent rec{};
+    rec.Time = (float)(Now() - s_StartTime);
+    rec.Type = (uint16_t)e.GetEventType();
+
+    switch (e.GetEventType())
+    {
+        case EventType::KeyPressed:
+        {
+            auto& ke = static_cast<const KeyPressedEvent&>(e);
+            rec.Code = (int16_t)ke.GetKeyCode();
+            rec.X = (float)ke.GetRepeatCount();
+            break;
+        }
+        case EventType::KeyReleased:
+            rec.Code = (int16_t)static_cast<const KeyReleasedEvent&>(e).GetKeyCode();
+            break;
+        case EventType::KeyTyped:
+            rec.X = (float)static_cast<const KeyTypedEvent&>(e).GetKeyCode(); // Code points exceed int16
+            break;
+        case EventType::MouseButtonPressed:
+        case EventType::MouseButtonReleased:
+            rec.Code = (int16_t)static_cast<const MouseButtonEvent&>(e).GetMouseButton();
+            break;
+        case EventType::MouseMoved:
+        {
+            auto& me = static_cast<const MouseMovedEvent&>(e);
+            rec.X = me.GetX();
+            rec.Y = me.GetY();
+            break;
+        }
+        case EventType::MouseScrolled:
+        {
+            auto& me = static_cast<const MouseScrolledEvent&>(e);
+            rec.X = me.GetXOffset();
+            rec.Y = me.GetYOffset();
+            break;
+        }
+        case EventType::WindowResize:
+        {
+            auto& we = static_cast<const WindowResizeEvent&>(e);
+            rec.X = (float)we.GetWidth();
+            rec.Y = (float)we.GetHeight();
+            break;
+        }
+        default:
+            return; // Close / focus etc. are not part of a replayable session
+    }
+
+    s_RecordFile.write((const char*)&rec, sizeof(rec));
+}
+
+void EventRecorder::RecordFrameBoundary()
+{
+    if (!s_Recording) return;
+
+    RecordedEvent rec{};
+    rec.Time = (float)(Now() - s_StartTime);
+    rec.Type = (uint16_t)EventType::AppTick;
+    s_RecordFile.write((const char*)&rec, sizeof(rec));
+}
+
+// ============================================================================
+// EventReplayer
+// ============================================================================
+bool EventReplayer::s_Replaying = false;
+EventReplayer::Speed EventReplayer::s_Speed = EventReplayer::Speed::Recorded;
+EventReplayer::DispatchFn EventReplayer::s_Dispatch;
+std::vector<RecordedEvent> EventReplayer::s_Events;
+size_t EventReplayer::s_Cursor = 0;
+double EventReplayer::s_Clock = 0.0;
+float EventReplayer::s_LastMarkerTime = 0.0f;
+std::vector<float> EventReplayer::s_FrameTimesMs;
+
+static std::chrono::steady_clock::time_point s_LastFrameStart;
+
+bool EventReplayer::Start(const std::string& path, Speed speed, const DispatchFn& dispatch)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        CORE_ERROR("[EventReplayer] Failed to open {0}", path);
+        return false;
+    }
+
+    size_t fileSize = (size_t)file.tellg();
+    file.seekg(0);
+
+    RecordingHeader header;
+    file.read((char*)&header, sizeof(header));
+    if (!file || header.Magic != RECORDING_MAGIC || header.RecordSize != sizeof(RecordedEvent))
+    {
+        CORE_ERROR("[EventReplayer] {0} is not a valid event recording", path);
+        return false;
+    }
+
+    // Single bulk read - recordings are flat arrays of POD records
+    size_t count = (fileSize - sizeof(header)) / sizeof(RecordedEvent);
+    s_Events.resize(count);
+    file.read((char*)s_Events.data(), count * sizeof(RecordedEvent));
+
+    s_Speed = speed;
+    s_Dispatch = dispatch;
+    s_Cursor = 0;
+    s_Clock = 0.0;
+    s_LastMarkerTime = 0.0f;
+    s_FrameTimesMs.clear();
+    s_FrameTimesMs.reserve(count / 4);
+    s_LastFrameStart = std::chrono::steady_clock::now();
+    s_Replaying = true;
+
+    CORE_INFO("[EventReplayer] Replaying {0} events from {1} ({2})",
+              count, path, speed == Speed::Max ? "max speed" : "recorded speed");
+    return true;
+}
+
+void EventReplayer::Stop()
+{
+    if (!s_Replaying) return;
+    s_Replaying = false;
+
+    Report r = BuildReport();
+    CORE_INFO("[EventReplayer] ===== Frame Time Report =====");
+    CORE_INFO("[EventReplayer] Frames: {0}  Total: {1} ms", r.Frames, r.TotalMs);
+    CORE_INFO("[EventReplayer] Avg: {0} ms  Min: {1} ms  Max: {2} ms", r.AvgMs, r.MinMs, r.MaxMs);
+    CORE_INFO("[EventReplayer] P50: {0} ms  P95: {1} ms  P99: {2} ms", r.P50Ms, r.P95Ms, r.P99Ms);
+
+    s_Events.clear();
+    s_Events.shrink_to_fit();
+}
+
+bool EventReplayer::Update(float& deltaTime)
+{
+    if (!s_Replaying) return false;
+
+    // Wall-clock duration of the previous frame
+    auto now = std::chrono::steady_clock::now();
+    if (s_Cursor > 0)
+        s_FrameTimesMs.push_back(std::chrono::duration<float, std::milli>(now - s_LastFrameStart).count());
+    s_LastFrameStart = now;
+
+    if (s_Speed == Speed::Max)
+    {
+        // Everything up to (and including) the next frame boundary
+        while (s_Cursor < s_Events.size())
+        {
+            const RecordedEvent& rec = s_Events[s_Cursor++];
+            if (rec.Type == (uint16_t)EventType::AppTick)
+            {
+                deltaTime = rec.Time - s_LastMarkerTime;
+                s_LastMarkerTime = rec.Time;
+                break;
+            }
+            Dispatch(rec);
+        }
+    }
+    else
+    {
+        s_Clock += deltaTime;
+        while (s_Cursor < s_Events.size() && s_Events[s_Cursor].Time <= s_Clock)
+        {
+            const RecordedEvent& rec = s_Events[s_Cursor++];
+            if (rec.Type != (uint16_t)EventType::AppTick)
+                Dispatch(rec);
+        }
+    }
+
+    if (s_Cursor >= s_Events.size())
+    {
+        Stop();
+        return false;
+    }
+    return true;
+}
+
+EventReplayer::Report EventReplayer::BuildReport()
+{
+    Report r;
+    if (s_FrameTimesMs.empty()) return r;
+
+    std::vector<float> sorted = s_FrameTimesMs;
+    std::sort(sorted.begin(), sorted.end());
+
+    r.Frames = (uint32_t)sorted.size();
+    for (float ms : sorted) r.TotalMs += ms;
+    r.AvgMs = r.TotalMs / r.Frames;
+    r.MinMs = sorted.front();
+    r.MaxMs = sorted.back();
+
+    auto percentile = [&](double p) { return (double)sorted[(size_t)(p * (sorted.size() - 1))]; };
+    r.P50Ms = percentile(0.50);
+    r.P95Ms = percentile(0.95);
+    r.P99Ms = percentile(0.99);
+    return r;
+}
+
+void EventReplayer::Dispatch(const RecordedEvent& rec)
+{
+    if (!s_Dispatch) return;
+
+    switch ((EventType)rec.Type)
+    {
+        case EventType::KeyPressed:          { KeyPressedEvent e(rec.Code, (int)rec.X);  s_Dispatch(e); break; }
+        case EventType::KeyReleased:         { KeyReleasedEvent e(rec.Code);              s_Dispatch(e); break; }
+        case EventType::KeyTyped:            { KeyTypedEvent e((int)rec.X);               s_Dispatch(e); break; }
+        case EventType::MouseButtonPressed:  { MouseButtonPressedEvent e(rec.Code);       s_Dispatch(e); break; }
+        case EventType::MouseButtonReleased: { MouseButtonReleasedEvent e(rec.Code);      s_Dispatch(e); break; }
+        case EventType::MouseMoved:          { MouseMovedEvent e(rec.X, rec.Y);           s_Dispatch(e); break; }
+        case EventType::MouseScrolled:       { MouseScrolledEvent e(rec.X, rec.Y);        s_Dispatch(e); break; }
+        case EventType::WindowResize:        { WindowResizeEvent e((unsigned)rec.X, (unsigned)rec.Y); s_Dispatch(e); break; }
+        default: break;
+    }
+}
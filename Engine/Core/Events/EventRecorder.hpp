@@ -0,0 +1,106 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "Event.hpp"
+
+/**
+ * ============================================================================
+ * EVENT RECORDER / REPLAYER
+ * ============================================================================
+ *
+ * Captures the raw event stream at the GLFWWindow callback layer and plays it
+ * back through Application::OnEvent, so a user session can be reproduced
+ * frame-for-frame (regression benchmarks, "it got slow when I did X" reports).
+ * ImGuiLayer forwards replayed events to ImGuiIO and installs no GLFW
+ * callbacks of its own during a replay, so editor UI interaction replays too
+ * and live input reaches nothing.
+ *
+ * File layout (little-endian):
+ *   RecordingHeader
+ *   RecordedEvent[]   (16 bytes each)
+ *
+ * Frame boundaries are stored as AppTick records written right after each
+ * glfwPollEvents(), which is exactly when live events become visible to the
+ * next frame.
+ *
+ * Command line (parsed by Application):
+ *   --record-events <file>    record this session
+ *   --replay-events <file>    replay a session, then close
+ *   --replay-fast             ignore recorded timing, one recorded frame per frame
+ *   --headless                hidden window, no vsync
+ * ============================================================================
+ */
+
+#pragma pack(push, 1)
+struct RecordedEvent
+{
+    float    Time;  // Seconds since recording start
+    uint16_t Type;  // EventSystem::EventType
+    int16_t  Code;  // Key / mouse button
+    float    X;     // Mouse X / scroll X / width / repeat count / typed code point
+    float    Y;     // Mouse Y / scroll Y / height
+};
+#pragma pack(pop)
+
+static_assert(sizeof(RecordedEvent) == 16, "RecordedEvent must stay 16 bytes");
+
+class EventRecorder
+{
+public:
+    static bool Start(const std::string& path);
+    static void Stop();
+    static bool IsRecording() { return s_Recording; }
+
+    // Called from the window callbacks / after every poll
+    static void Record(const EventSystem::Event& e);
+    static void RecordFrameBoundary();
+
+private:
+    static bool s_Recording;
+    static double s_StartTime;
+};
+
+class EventReplayer
+{
+public:
+    enum class Speed { Recorded, Max };
+
+    using DispatchFn = std::function<void(EventSystem::Event&)>;
+
+    static bool Start(const std::string& path, Speed speed, const DispatchFn& dispatch);
+    static void Stop();
+    static bool IsReplaying() { return s_Replaying; }
+
+    /**
+     * Call once at the top of every frame. Dispatches the events that belong
+     * to this frame. At Speed::Max it also overrides deltaTime with the
+     * recorded frame delta so simulation stays deterministic.
+     * Returns false once the recording is exhausted.
+     */
+    static bool Update(float& deltaTime);
+
+    // Frame-time report for the replayed section (logged on Stop)
+    struct Report
+    {
+        uint32_t Frames = 0;
+        double TotalMs = 0.0;
+        double AvgMs = 0.0, MinMs = 0.0, MaxMs = 0.0;
+        double P50Ms = 0.0, P95Ms = 0.0, P99Ms = 0.0;
+    };
+    static Report BuildReport();
+
+private:
+    static void Dispatch(const RecordedEvent& rec);
+
+    static bool s_Replaying;
+    static Speed s_Speed;
+    static DispatchFn s_Dispatch;
+    static std::vector<RecordedEvent> s_Events;
+    static size_t s_Cursor;
+    static double s_Clock;
+    static float s_LastMarkerTime;
+    static std::vector<float> s_FrameTimesMs;
+};
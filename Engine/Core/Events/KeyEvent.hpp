@@ -52,4 +52,21 @@ namespace EventSystem {
 
         EVENT_CLASS_TYPE(KeyReleased)
     };
+
+    // Text input: the key code is a Unicode code point (GLFW char callback)
+    class KeyTypedEvent : public KeyEvent
+    {
+    public:
+        KeyTypedEvent(int codepoint)
+            : KeyEvent(codepoint) {}
+
+        std::string ToString() const override
+        {
+            std::stringstream ss;
+            ss << "KeyTypedEvent: " << m_KeyCode;
+            return ss.str();
+        }
+
+        EVENT_CLASS_TYPE(KeyTyped)
+    };
 }
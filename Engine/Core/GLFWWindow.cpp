@@ -7,6 +7,7 @@
 #include "Events/ApplicationEvent.hpp"
 #include "Events/KeyEvent.hpp"
 #include "Events/MouseEvent.hpp"
+#include "Events/EventRecorder.hpp"
 #include "Log.hpp"
 
 class GLFWWindow : public Window
@@ -52,7 +53,16 @@ public:
         glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
 #endif
         glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-        glfwWindowHint(GLFW_MAXIMIZED, GLFW_TRUE); // Launch maximized
+
+        if (props.Visible)
+        {
+            glfwWindowHint(GLFW_MAXIMIZED, GLFW_TRUE); // Launch maximized
+        }
+        else
+        {
+            // Headless: keep a real GL context but never show the window
+            glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        }
 
         m_Window = glfwCreateWindow(
             (int)props.Width,
@@ -69,7 +79,7 @@ public:
         }
 
         glfwMakeContextCurrent(m_Window);
-        glfwSwapInterval(1); // vsync
+        glfwSwapInterval(props.VSync ? 1 : 0);
 
         if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
         {
@@ -92,7 +102,7 @@ public:
             data.Height = height;
 
             EventSystem::WindowResizeEvent event(width, height);
-            data.EventCallback(event);
+            Emit(data, event);
         });
 
         // Window Close
@@ -100,7 +110,7 @@ public:
         {
             WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
             EventSystem::WindowCloseEvent event;
-            data.EventCallback(event);
+            Emit(data, event);
         });
 
         // Key Callback
@@ -113,24 +123,32 @@ public:
                 case GLFW_PRESS:
                 {
                     EventSystem::KeyPressedEvent event(key, 0);
-                    data.EventCallback(event);
+                    Emit(data, event);
                     break;
                 }
                 case GLFW_RELEASE:
                 {
                     EventSystem::KeyReleasedEvent event(key);
-                    data.EventCallback(event);
+                    Emit(data, event);
                     break;
                 }
                 case GLFW_REPEAT:
                 {
                     EventSystem::KeyPressedEvent event(key, 1);
-                    data.EventCallback(event);
+                    Emit(data, event);
                     break;
                 }
             }
         });
 
+        // Text input - recorded so replayed sessions can type into ImGui fields
+        glfwSetCharCallback(m_Window, [](GLFWwindow* window, unsigned int codepoint)
+        {
+            WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+            EventSystem::KeyTypedEvent event((int)codepoint);
+            Emit(data, event);
+        });
+
         // Mouse Button
         glfwSetMouseButtonCallback(m_Window, [](GLFWwindow* window, int button, int action, int mods)
         {
@@ -141,13 +159,13 @@ public:
                 case GLFW_PRESS:
                 {
                     EventSystem::MouseButtonPressedEvent event(button);
-                    data.EventCallback(event);
+                    Emit(data, event);
                     break;
                 }
                 case GLFW_RELEASE:
                 {
                     EventSystem::MouseButtonReleasedEvent event(button);
-                    data.EventCallback(event);
+                    Emit(data, event);
                     break;
                 }
             }
@@ -158,7 +176,7 @@ public:
         {
             WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
             EventSystem::MouseScrolledEvent event((float)xOffset, (float)yOffset);
-            data.EventCallback(event);
+            Emit(data, event);
         });
 
         // Mouse Move
@@ -166,7 +184,7 @@ public:
         {
             WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
             EventSystem::MouseMovedEvent event((float)xPos, (float)yPos);
-            data.EventCallback(event);
+            Emit(data, event);
         });
     }
 
@@ -179,6 +197,7 @@ public:
     void OnUpdate() override
     {
         glfwPollEvents();
+        EventRecorder::RecordFrameBoundary(); // Events polled so far belong to the next frame
         glfwSwapBuffers(m_Window);
     }
 
@@ -203,6 +222,17 @@ private:
         EventCallbackFn EventCallback;
     };
 
+    // Single funnel for every GLFW callback: record, then forward.
+    // While a replay is running live input is dropped so it can't desync the session.
+    static void Emit(WindowData& data, EventSystem::Event& event)
+    {
+        if (EventReplayer::IsReplaying() && event.IsInCategory(EventSystem::EventCategoryInput))
+            return;
+
+        EventRecorder::Record(event);
+        data.EventCallback(event);
+    }
+
     WindowData m_Data;
 };
 
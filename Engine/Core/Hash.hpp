@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+// ============================================================================
+// FNV-1a hashing - constexpr so string literals can be hashed at compile time
+// ============================================================================
+namespace Hash
+{
+    constexpr uint32_t FNV32_OFFSET = 2166136261u;
+    constexpr uint32_t FNV32_PRIME = 16777619u;
+    constexpr uint64_t FNV64_OFFSET = 14695981039346656037ull;
+    constexpr uint64_t FNV64_PRIME = 1099511628211ull;
+
+    constexpr uint32_t Fnv1a32(std::string_view str, uint32_t hash = FNV32_OFFSET)
+    {
+        for (char c : str)
+        {
+            hash ^= (uint8_t)c;
+            hash *= FNV32_PRIME;
+        }
+        return hash;
+    }
+
+    constexpr uint64_t Fnv1a64(std::string_view str, uint64_t hash = FNV64_OFFSET)
+    {
+        for (char c : str)
+        {
+            hash ^= (uint8_t)c;
+            hash *= FNV64_PRIME;
+        }
+        return hash;
+    }
+
+    inline uint64_t Fnv1a64(const void* data, size_t size, uint64_t hash = FNV64_OFFSET)
+    {
+        const uint8_t* bytes = (const uint8_t*)data;
+        for (size_t i = 0; i < size; i++)
+        {
+            hash ^= bytes[i];
+            hash *= FNV64_PRIME;
+        }
+        return hash;
+    }
+}
@@ -1,45 +1,85 @@
 #include "Input.hpp"
 #include <GLFW/glfw3.h>
 
-static double s_LastX = 0.0, s_LastY = 0.0;
-static bool   s_First = true;
+#include <Core/Log.hpp>
+#include <Core/Events/MouseEvent.hpp>
+
 GLFWwindow* Input::s_Window = nullptr;
+InputState Input::s_Pending;
+InputState Input::s_Current;
 
 void Input::Init(GLFWwindow* window)
 {
     s_Window = window;
-    glfwGetCursorPos(s_Window, &s_LastX, &s_LastY);
+
+    // Seed cursor position so the first MouseMoved event doesn't produce a jump
+    double x = 0.0, y = 0.0;
+    if (s_Window)
+        glfwGetCursorPos(s_Window, &x, &y);
+
+    EventSystem::MouseMovedEvent seed((float)x, (float)y);
+    s_Pending.OnEvent(seed);
+    s_Current = s_Pending;
+}
+
+void Input::OnEvent(EventSystem::Event& e)
+{
+    if (!e.IsInCategory(EventSystem::EventCategoryInput))
+        return;
+
+    s_Pending.OnEvent(e);
+}
+
+void Input::NewFrame()
+{
+    s_Current = s_Pending;
+    s_Pending.ResetFrameData();
 }
 
 bool Input::IsKeyPressed(int key)
 {
-    return glfwGetKey(s_Window, key) == GLFW_PRESS;
+    return s_Current.KeysDown.Test(key);
 }
 
 bool Input::IsMouseButtonPressed(int button)
 {
-    return glfwGetMouseButton(s_Window, button) == GLFW_PRESS;
+    return s_Current.ButtonsDown.Test(button);
+}
+
+bool Input::IsKeyJustPressed(int key)
+{
+    return s_Current.KeysPressed.Test(key);
+}
+
+bool Input::IsKeyJustReleased(int key)
+{
+    return s_Current.KeysReleased.Test(key);
+}
+
+bool Input::IsMouseButtonJustPressed(int button)
+{
+    return s_Current.ButtonsPressed.Test(button);
+}
+
+bool Input::IsMouseButtonJustReleased(int button)
+{
+    return s_Current.ButtonsReleased.Test(button);
 }
 
 void Input::GetMousePosition(double& x, double& y)
 {
-    glfwGetCursorPos(s_Window, &x, &y);
+    x = s_Current.MouseX;
+    y = s_Current.MouseY;
 }
 
 void Input::GetMouseDelta(double& dx, double& dy)
 {
-    double x, y;
-    glfwGetCursorPos(s_Window, &x, &y);
-
-    if (s_First)
-    {
-        s_LastX = x;
-        s_LastY = y;
-        s_First = false;
-    }
+    dx = s_Current.MouseDeltaX;
+    dy = -s_Current.MouseDeltaY; // invert Y
+}
 
-    dx = x - s_LastX;
-    dy = s_LastY - y; // invert Y
-    s_LastX = x;
-    s_LastY = y;
+void Input::GetScrollDelta(float& x, float& y)
+{
+    x = s_Current.ScrollX;
+    y = s_Current.ScrollY;
 }
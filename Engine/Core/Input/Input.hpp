@@ -1,17 +1,48 @@
 #pragma once
 #include <GLFW/glfw3.h>
 
+#include "InputState.hpp"
+
+// ============================================================================
+// Input - frame-coherent keyboard / mouse queries
+// ============================================================================
+// Application::OnEvent feeds every event into a pending InputState and
+// Application::Run calls NewFrame() once per frame to publish it. All queries
+// read the published snapshot, so nothing here calls into GLFW per query.
+//
+// Session record / replay happens one level lower, on the raw event stream
+// (EventRecorder / EventReplayer), so a replay rebuilds these snapshots.
+// ============================================================================
 class Input
 {
 public:
     static void Init(GLFWwindow* window);
 
+    // Event stream -> pending state
+    static void OnEvent(EventSystem::Event& e);
+
+    // Publish pending state as this frame's snapshot
+    static void NewFrame();
+
+    // Held state
     static bool IsKeyPressed(int key);
     static bool IsMouseButtonPressed(int button);
 
+    // Edges (true for exactly one frame)
+    static bool IsKeyJustPressed(int key);
+    static bool IsKeyJustReleased(int key);
+    static bool IsMouseButtonJustPressed(int button);
+    static bool IsMouseButtonJustReleased(int button);
+
     static void GetMousePosition(double& x, double& y);
-    static void GetMouseDelta(double& dx, double& dy);
+    static void GetMouseDelta(double& dx, double& dy); // Y inverted (up = +)
+    static void GetScrollDelta(float& x, float& y);
+
+    static const InputState& GetState() { return s_Current; }
 
 private:
     static GLFWwindow* s_Window;
-};
\ No newline at end of file
+
+    static InputState s_Pending;
+    static InputState s_Current;
+};
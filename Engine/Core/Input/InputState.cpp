@@ -0,0 +1,72 @@
+#include "InputState.hpp"
+
+#include <Core/Events/KeyEvent.hpp>
+#include <Core/Events/MouseEvent.hpp>
+
+void InputState::OnEvent(EventSystem::Event& e)
+{
+    switch (e.GetEventType())
+    {
+        case EventSystem::EventType::KeyPressed:
+        {
+            auto& ke = static_cast<EventSystem::KeyPressedEvent&>(e);
+            if (ke.GetRepeatCount() == 0)
+                KeysPressed.Set(ke.GetKeyCode());
+            KeysDown.Set(ke.GetKeyCode());
+            break;
+        }
+        case EventSystem::EventType::KeyReleased:
+        {
+            auto& ke = static_cast<EventSystem::KeyReleasedEvent&>(e);
+            KeysReleased.Set(ke.GetKeyCode());
+            KeysDown.Set(ke.GetKeyCode(), false);
+            break;
+        }
+        case EventSystem::EventType::MouseButtonPressed:
+        {
+            auto& me = static_cast<EventSystem::MouseButtonPressedEvent&>(e);
+            ButtonsPressed.Set(me.GetMouseButton());
+            ButtonsDown.Set(me.GetMouseButton());
+            break;
+        }
+        case EventSystem::EventType::MouseButtonReleased:
+        {
+            auto& me = static_cast<EventSystem::MouseButtonReleasedEvent&>(e);
+            ButtonsReleased.Set(me.GetMouseButton());
+            ButtonsDown.Set(me.GetMouseButton(), false);
+            break;
+        }
+        case EventSystem::EventType::MouseMoved:
+        {
+            auto& me = static_cast<EventSystem::MouseMovedEvent&>(e);
+            if (m_HasMousePosition)
+            {
+                MouseDeltaX += me.GetX() - MouseX;
+                MouseDeltaY += me.GetY() - MouseY;
+            }
+            MouseX = me.GetX();
+            MouseY = me.GetY();
+            m_HasMousePosition = true;
+            break;
+        }
+        case EventSystem::EventType::MouseScrolled:
+        {
+            auto& me = static_cast<EventSystem::MouseScrolledEvent&>(e);
+            ScrollX += me.GetXOffset();
+            ScrollY += me.GetYOffset();
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void InputState::ResetFrameData()
+{
+    KeysPressed.Clear();
+    KeysReleased.Clear();
+    ButtonsPressed.Clear();
+    ButtonsReleased.Clear();
+    MouseDeltaX = MouseDeltaY = 0.0;
+    ScrollX = ScrollY = 0.0f;
+}
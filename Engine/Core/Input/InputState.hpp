@@ -0,0 +1,67 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+
+#include <Core/Events/Event.hpp>
+
+// ============================================================================
+// InputBits - fixed-size bitset with raw word access (cheap to copy/serialize)
+// ============================================================================
+template<int Bits>
+struct InputBits
+{
+    static constexpr int WordCount = (Bits + 63) / 64;
+    uint64_t Words[WordCount] = {};
+
+    bool Test(int i) const
+    {
+        if (i < 0 || i >= Bits) return false;
+        return (Words[i >> 6] >> (i & 63)) & 1ull;
+    }
+
+    void Set(int i, bool value = true)
+    {
+        if (i < 0 || i >= Bits) return;
+        if (value) Words[i >> 6] |=  (1ull << (i & 63));
+        else       Words[i >> 6] &= ~(1ull << (i & 63));
+    }
+
+    void Clear() { std::memset(Words, 0, sizeof(Words)); }
+};
+
+// ============================================================================
+// InputState - one frame worth of keyboard / mouse state
+// ============================================================================
+// Built from the event stream (Application::OnEvent) instead of polling GLFW.
+// Every query is an O(1) bit test or a plain field read.
+//
+// Edge bits are sticky for the whole frame, so a key pressed AND released
+// between two polls still reports IsKeyJustPressed() on the next frame.
+// ============================================================================
+struct InputState
+{
+    // Mirrors GLFW_KEY_LAST (348) / GLFW_MOUSE_BUTTON_LAST (7)
+    static constexpr int MaxKeys = 349;
+    static constexpr int MaxMouseButtons = 8;
+
+    InputBits<MaxKeys> KeysDown;
+    InputBits<MaxKeys> KeysPressed;
+    InputBits<MaxKeys> KeysReleased;
+
+    InputBits<MaxMouseButtons> ButtonsDown;
+    InputBits<MaxMouseButtons> ButtonsPressed;
+    InputBits<MaxMouseButtons> ButtonsReleased;
+
+    double MouseX = 0.0, MouseY = 0.0;
+    double MouseDeltaX = 0.0, MouseDeltaY = 0.0; // Y is NOT inverted here
+    float ScrollX = 0.0f, ScrollY = 0.0f;
+
+    // Feed a single event into this (pending) state
+    void OnEvent(EventSystem::Event& e);
+
+    // Clear per-frame accumulators (edges, delta, scroll), keep held state
+    void ResetFrameData();
+
+private:
+    bool m_HasMousePosition = false;
+};
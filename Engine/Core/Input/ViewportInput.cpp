@@ -1,4 +1,5 @@
 #include "ViewportInput.hpp"
+#include "Input.hpp"
 
 GLFWwindow* ViewportInput::s_Window = nullptr;
 
@@ -7,8 +8,6 @@ float ViewportInput::s_VP_Y = 0.0f;
 float ViewportInput::s_VP_W = 0.0f;
 float ViewportInput::s_VP_H = 0.0f;
 
-double ViewportInput::s_LastX = 0.0;
-double ViewportInput::s_LastY = 0.0;
 bool ViewportInput::s_First = true;
 bool ViewportInput::s_CameraActive = false;
 
@@ -27,8 +26,9 @@ void ViewportInput::SetViewportBounds(float x, float y, float width, float heigh
 
 bool ViewportInput::IsMouseInsideViewport()
 {
+    // Cursor position comes from this frame's input snapshot (no GLFW query)
     double mx, my;
-    glfwGetCursorPos(s_Window, &mx, &my);
+    Input::GetMousePosition(mx, my);
 
     return (mx >= s_VP_X && mx <= s_VP_X + s_VP_W &&
             my >= s_VP_Y && my <= s_VP_Y + s_VP_H);
@@ -69,19 +69,13 @@ void ViewportInput::GetMouseDelta(double& dx, double& dy)
     dx = dy = 0.0;
     if (!s_CameraActive) return;
 
-    double x, y;
-    glfwGetCursorPos(s_Window, &x, &y);
-
+    // Swallow the first frame: switching to GLFW_CURSOR_DISABLED warps the
+    // cursor, and that jump would otherwise show up as a huge delta.
     if (s_First)
     {
-        s_LastX = x;
-        s_LastY = y;
         s_First = false;
+        return;
     }
 
-    dx = x - s_LastX;
-    dy = s_LastY - y;
-
-    s_LastX = x;
-    s_LastY = y;
+    Input::GetMouseDelta(dx, dy);
 }
@@ -21,7 +21,6 @@ private:
     static float s_VP_X, s_VP_Y;
     static float s_VP_W, s_VP_H;
 
-    static double s_LastX, s_LastY;
     static bool s_First;
     static bool s_CameraActive;
 };
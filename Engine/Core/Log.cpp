@@ -31,6 +31,67 @@ namespace Core {
         s_ClientLogger = std::make_shared<Logger>("APP");
     }
 
+    namespace
+    {
+        // Length of a "{N}" placeholder at `pos` (0 if there is none), its index in `index`
+        size_t ParsePlaceholder(const std::string& text, size_t pos, size_t& index)
+        {
+            if (text[pos] != '{') return 0;
+
+            size_t end = pos + 1;
+            index = 0;
+            while (end < text.size() && text[end] >= '0' && text[end] <= '9')
+                index = index * 10 + (size_t)(text[end++] - '0');
+
+            return end > pos + 1 && end < text.size() && text[end] == '}' ? end - pos + 1 : 0;
+        }
+
+        bool HasPlaceholder(const std::string& text)
+        {
+            size_t index;
+            for (size_t pos = text.find('{'); pos != std::string::npos; pos = text.find('{', pos + 1))
+                if (ParsePlaceholder(text, pos, index)) return true;
+            return false;
+        }
+    }
+
+    std::string Log::Logger::Format(const std::vector<std::string>& parts)
+    {
+        size_t format = 0;
+        while (format < parts.size() && !HasPlaceholder(parts[format]))
+            format++;
+
+        std::string message;
+        for (size_t i = 0; i < parts.size() && i < format; i++)
+            message += parts[i];
+        if (format == parts.size()) return message;
+
+        // Values are the arguments after the format string
+        const std::string& text = parts[format];
+        const size_t first = format + 1;
+        std::vector<bool> used(parts.size() - first, false);
+
+        for (size_t pos = 0; pos < text.size();)
+        {
+            size_t index;
+            size_t length = ParsePlaceholder(text, pos, index);
+            if (length && index < used.size())
+            {
+                message += parts[first + index];
+                used[index] = true;
+                pos += length;
+            }
+            else
+            {
+                message += text[pos++];
+            }
+        }
+
+        for (size_t i = 0; i < used.size(); i++)
+            if (!used[i]) message += parts[first + i];
+        return message;
+    }
+
     void Log::Logger::Print(LogLevel level, const std::string& message)
     {
         // Get time
@@ -5,6 +5,7 @@
 #include <iostream>
 #include <fstream> // For file logging
 #include <sstream>
+#include <vector>
 
 namespace Core {
     
@@ -53,14 +54,26 @@ namespace Core {
         public:
             Logger(const std::string& name) : m_Name(name) {}
 
+            // "{N}" in the first argument that has one is replaced by the N-th argument after it;
+            // arguments no placeholder refers to are appended, as plain concatenation
             template<typename... Args>
             void Log(LogLevel level, Args&&... args) {
-                std::stringstream ss;
-                (ss << ... << args);
-                Print(level, ss.str());
+                std::vector<std::string> parts;
+                parts.reserve(sizeof...(Args));
+                (parts.push_back(ToString(args)), ...);
+                Print(level, Format(parts));
             }
 
         private:
+            static std::string Format(const std::vector<std::string>& parts);
+
+            template<typename T>
+            static std::string ToString(const T& value) {
+                std::stringstream ss;
+                ss << value;
+                return ss.str();
+            }
+
             void Print(LogLevel level, const std::string& message);
             std::string m_Name;
         };
@@ -0,0 +1,99 @@
+#include "OffsetAllocator.hpp"
+
+OffsetAllocator::OffsetAllocator(uint32_t capacity)
+{
+    Grow(capacity);
+}
+
+uint32_t OffsetAllocator::Allocate(uint32_t size)
+{
+    if (size == 0) return InvalidOffset;
+
+    // Smallest block that fits
+    auto fit = m_FreeBySize.lower_bound(size);
+    if (fit == m_FreeBySize.end())
+        return InvalidOffset;
+
+    uint32_t offset = fit->second;
+    uint32_t blockSize = fit->first;
+    m_FreeBySize.erase(fit);
+    m_FreeByOffset.erase(offset);
+
+    if (blockSize > size)
+    {
+        uint32_t rest = offset + size;
+        m_FreeByOffset.emplace(rest, blockSize - size);
+        m_FreeBySize.emplace(blockSize - size, rest);
+    }
+
+    m_Used += size;
+    return offset;
+}
+
+void OffsetAllocator::Free(uint32_t offset, uint32_t size)
+{
+    if (offset == InvalidOffset || size == 0) return;
+
+    m_Used -= size;
+    InsertFree(offset, size);
+}
+
+void OffsetAllocator::Grow(uint32_t newCapacity)
+{
+    if (newCapacity <= m_Capacity) return;
+
+    uint32_t oldCapacity = m_Capacity;
+    m_Capacity = newCapacity;
+    InsertFree(oldCapacity, newCapacity - oldCapacity);
+}
+
+OffsetAllocator::Stats OffsetAllocator::GetStats() const
+{
+    Stats stats;
+    stats.Capacity = m_Capacity;
+    stats.Used = m_Used;
+    stats.FreeBlocks = (uint32_t)m_FreeByOffset.size();
+    stats.LargestFreeBlock = m_FreeBySize.empty() ? 0 : m_FreeBySize.rbegin()->first;
+    return stats;
+}
+
+void OffsetAllocator::InsertFree(uint32_t offset, uint32_t size)
+{
+    // Merge with the following block
+    auto next = m_FreeByOffset.find(offset + size);
+    if (next != m_FreeByOffset.end())
+    {
+        size += next->second;
+        EraseFree(next);
+    }
+
+    // Merge with the preceding block
+    auto prev = m_FreeByOffset.lower_bound(offset);
+    if (prev != m_FreeByOffset.begin())
+    {
+        --prev;
+        if (prev->first + prev->second == offset)
+        {
+            offset = prev->first;
+            size += prev->second;
+            EraseFree(prev);
+        }
+    }
+
+    m_FreeByOffset.emplace(offset, size);
+    m_FreeBySize.emplace(size, offset);
+}
+
+void OffsetAllocator::EraseFree(std::map<uint32_t, uint32_t>::iterator it)
+{
+    auto range = m_FreeBySize.equal_range(it->second);
+    for (auto s = range.first; s != range.second; ++s)
+    {
+        if (s->second == it->first)
+        {
+            m_FreeBySize.erase(s);
+            break;
+        }
+    }
+    m_FreeByOffset.erase(it);
+}
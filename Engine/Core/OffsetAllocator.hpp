@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+#include <map>
+
+// ============================================================================
+// OffsetAllocator - best-fit range allocator over [0, capacity)
+// ============================================================================
+// Pure bookkeeping, no GL: hands out offsets into some externally owned
+// storage (vertex/index arenas, atlases, ...). Units are whatever the caller
+// uses - elements, bytes. Free blocks are coalesced on release.
+//
+// Allocate / Free are O(log n) in the number of free blocks.
+// ============================================================================
+class OffsetAllocator
+{
+public:
+    static constexpr uint32_t InvalidOffset = 0xFFFFFFFFu;
+
+    struct Stats
+    {
+        uint32_t Capacity = 0;
+        uint32_t Used = 0;
+        uint32_t FreeBlocks = 0;
+        uint32_t LargestFreeBlock = 0;
+
+        // 0 = all free space is one block, -> 1 = free space is scattered
+        float GetFragmentation() const
+        {
+            uint32_t free = Capacity - Used;
+            return free > 0 ? 1.0f - (float)LargestFreeBlock / (float)free : 0.0f;
+        }
+    };
+
+    explicit OffsetAllocator(uint32_t capacity = 0);
+
+    // Returns InvalidOffset if no free block is large enough
+    uint32_t Allocate(uint32_t size);
+    void Free(uint32_t offset, uint32_t size);
+
+    // Appends [oldCapacity, newCapacity) to the free space
+    void Grow(uint32_t newCapacity);
+
+    uint32_t GetCapacity() const { return m_Capacity; }
+    uint32_t GetUsed() const { return m_Used; }
+    Stats GetStats() const;
+
+private:
+    void InsertFree(uint32_t offset, uint32_t size);
+    void EraseFree(std::map<uint32_t, uint32_t>::iterator it);
+
+    uint32_t m_Capacity = 0;
+    uint32_t m_Used = 0;
+
+    std::map<uint32_t, uint32_t> m_FreeByOffset;      // offset -> size
+    std::multimap<uint32_t, uint32_t> m_FreeBySize;   // size -> offset (best fit)
+};
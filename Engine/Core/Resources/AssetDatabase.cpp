@@ -0,0 +1,931 @@
+#include "AssetDatabase.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <Core/Hash.hpp>
+#include <Core/Log.hpp>
+#include <Core/Resources/AsyncLoader.hpp>
+#include <Core/Resources/FileWatcher.hpp>
+#include <Core/Resources/MappedFile.hpp>
+#include <Rendering/CookedTexture.hpp>
+#include <Rendering/Mesh/CookedMesh.hpp>
+#include <Rendering/Mesh/Mesh.hpp>
+#include <Rendering/Mesh/ObjImporter.hpp>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    // ---- Index file: header, fixed-size entries, then all paths back to back ----
+    struct IndexHeader
+    {
+        static constexpr uint32_t MagicValue = 0x31424441; // "ADB1"
+        static constexpr uint32_t CurrentVersion = 1;
+
+        uint32_t Magic = MagicValue;
+        uint32_t Version = CurrentVersion;
+        uint32_t Count = 0;
+        uint32_t StringBytes = 0;
+    };
+
+    struct IndexEntry
+    {
+        uint64_t ID;
+        uint64_t Size;
+        int64_t ModifiedTime;
+        uint64_t ContentHash;
+        uint64_t ImportedHash;
+        uint64_t ImportSettings;
+        uint32_t PathOffset;
+        uint32_t PathLength;
+        uint32_t Type;
+        uint32_t Reserved;
+    };
+    static_assert(sizeof(IndexEntry) == 64, "IndexEntry is part of the file format");
+
+    // Files modified this recently are re-hashed on the next scan as well
+    constexpr auto RACY_WINDOW = std::chrono::seconds(2);
+
+    constexpr uint64_t MAP_THRESHOLD = 1 << 20;
+    constexpr size_t READ_CHUNK = 64 * 1024;
+
+    constexpr size_t NOT_FOUND = (size_t)-1;
+
+    // Update() saves the index once it has been dirty this long with no imports running
+    constexpr auto SAVE_DELAY = std::chrono::seconds(2);
+
+    std::string s_Root;
+    std::string s_IndexPath;
+    size_t s_RootPrefix = 0;       // generic_string() length of the root + '/'
+
+    std::vector<AssetRecord> s_Records;
+    std::unordered_map<std::string, size_t> s_ByPath;
+    std::unordered_map<uint64_t, size_t> s_ByID;
+    std::unordered_multimap<uint64_t, size_t> s_ByHash;
+    std::unordered_map<std::string, AssetDatabase::Directory> s_Directories;
+    std::unordered_map<uint32_t, AssetDatabase::Importer> s_Importers;
+    std::vector<AssetDatabase::ChangeCallback> s_ChangeCallbacks;
+    FileWatcher s_Watcher;
+
+    AssetDatabase::Stats s_Stats;
+    uint64_t s_Revision = 0;
+    bool s_Dirty = false;          // Index differs from the file
+    Clock::time_point s_DirtySince;
+
+    // Imports in flight: asset ID -> content hash being imported
+    std::unordered_map<uint64_t, uint64_t> s_InFlight;
+    uint32_t s_Imported = 0;
+    uint32_t s_ImportFailed = 0;
+    Clock::time_point s_ImportStart;
+
+    double MsSince(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    std::string GetExtension(const std::string& path)
+    {
+        size_t dot = path.find_last_of('.');
+        if (dot == std::string::npos || path.find('/', dot) != std::string::npos) return {};
+        std::string extension = path.substr(dot);
+        for (char& c : extension) c = (char)std::tolower((unsigned char)c);
+        return extension;
+    }
+
+    // Derived files written next to their source - not assets
+    bool IsArtifact(const std::string& extension)
+    {
+        return extension == CookedTexture::Extension || extension == CookedMesh::Extension || extension == ".tmp";
+    }
+
+    std::string GetParent(const std::string& path)
+    {
+        size_t slash = path.find_last_of('/');
+        return slash == std::string::npos ? std::string() : path.substr(0, slash);
+    }
+
+    void MarkDirty()
+    {
+        if (!s_Dirty) s_DirtySince = Clock::now();
+        s_Dirty = true;
+    }
+
+    AssetDatabase::Directory& AddDirectory(const std::string& path)
+    {
+        auto [it, inserted] = s_Directories.try_emplace(path);
+        if (inserted && !path.empty())
+        {
+            std::vector<std::string>& children = AddDirectory(GetParent(path)).Children;
+            children.insert(std::lower_bound(children.begin(), children.end(), path), path);
+        }
+        return it->second;
+    }
+
+    // Drops `path` and its parents for as long as they are left empty
+    void PruneDirectory(std::string path)
+    {
+        while (!path.empty())
+        {
+            auto it = s_Directories.find(path);
+            if (it == s_Directories.end() || !it->second.Assets.empty() || !it->second.Children.empty()) return;
+            s_Directories.erase(it);
+
+            std::string parent = GetParent(path);
+            std::vector<std::string>& children = s_Directories[parent].Children;
+            auto child = std::lower_bound(children.begin(), children.end(), path);
+            if (child != children.end() && *child == path) children.erase(child);
+            path = std::move(parent);
+        }
+    }
+
+    void EraseHash(uint64_t hash, size_t index)
+    {
+        auto range = s_ByHash.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second != index) continue;
+            s_ByHash.erase(it);
+            return;
+        }
+    }
+
+    void RebuildLookups()
+    {
+        s_ByPath.clear();
+        s_ByID.clear();
+        s_ByHash.clear();
+        s_Directories.clear();
+        s_ByPath.reserve(s_Records.size());
+        s_ByID.reserve(s_Records.size());
+        s_ByHash.reserve(s_Records.size());
+
+        // Walking in path order leaves every directory's assets sorted
+        std::vector<uint32_t> order(s_Records.size());
+        for (uint32_t i = 0; i < (uint32_t)order.size(); i++) order[i] = i;
+        std::sort(order.begin(), order.end(), [](uint32_t a, uint32_t b) { return s_Records[a].Path < s_Records[b].Path; });
+
+        AddDirectory("");
+        for (uint32_t i : order)
+        {
+            const AssetRecord& record = s_Records[i];
+            s_ByPath.emplace(record.Path, i);
+            s_ByID.emplace((uint64_t)record.ID, i);
+            s_ByHash.emplace(record.ContentHash, i);
+            AddDirectory(GetParent(record.Path)).Assets.push_back(record.ID);
+        }
+    }
+
+    // ---- Incremental upkeep for small changes; large ones use RebuildLookups() ----
+    void LinkRecord(size_t index)
+    {
+        const AssetRecord& record = s_Records[index];
+        s_ByPath[record.Path] = index;
+        s_ByID[record.ID] = index;
+        s_ByHash.emplace(record.ContentHash, index);
+
+        std::vector<Core::UUID>& assets = AddDirectory(GetParent(record.Path)).Assets;
+        auto position = std::lower_bound(assets.begin(), assets.end(), record.Path,
+            [](Core::UUID id, const std::string& path) { return s_Records[s_ByID[id]].Path < path; });
+        assets.insert(position, record.ID);
+    }
+
+    void UnlinkRecord(size_t index)
+    {
+        const AssetRecord& record = s_Records[index];
+        s_ByPath.erase(record.Path);
+        s_ByID.erase(record.ID);
+        EraseHash(record.ContentHash, index);
+
+        const std::string directory = GetParent(record.Path);
+        auto it = s_Directories.find(directory);
+        if (it == s_Directories.end()) return;
+        std::vector<Core::UUID>& assets = it->second.Assets;
+        assets.erase(std::remove(assets.begin(), assets.end(), record.ID), assets.end());
+        PruneDirectory(directory);
+    }
+
+    // Removes an unlinked record by moving the last one into its slot
+    void EraseRecord(size_t index)
+    {
+        const size_t last = s_Records.size() - 1;
+        if (index != last)
+        {
+            AssetRecord& moved = s_Records[last];
+            s_ByPath[moved.Path] = index;
+            s_ByID[moved.ID] = index;
+            EraseHash(moved.ContentHash, last);
+            s_ByHash.emplace(moved.ContentHash, index);
+            s_Records[index] = std::move(moved);
+        }
+        s_Records.pop_back();
+    }
+
+    uint64_t HashFile(const std::string& path, uint64_t size, bool& readable)
+    {
+        readable = true;
+        if (size == 0) return Hash::FNV64_OFFSET; // Empty files cannot be mapped
+
+        // Most assets are small: a buffered read costs half of a map + unmap
+        if (size < MAP_THRESHOLD)
+        {
+            thread_local std::vector<char> s_Buffer(READ_CHUNK);
+            std::ifstream file(path, std::ios::binary);
+            uint64_t hash = Hash::FNV64_OFFSET;
+            while (file)
+            {
+                file.read(s_Buffer.data(), (std::streamsize)s_Buffer.size());
+                hash = Hash::Fnv1a64(s_Buffer.data(), (size_t)file.gcount(), hash);
+            }
+            readable = file.eof();
+            return hash;
+        }
+
+        MappedFile file(path);
+        if (!file.IsOpen())
+        {
+            readable = false;
+            return 0;
+        }
+        return Hash::Fnv1a64(file.GetData(), file.GetSize());
+    }
+
+    bool LoadIndex()
+    {
+        MappedFile file(s_IndexPath);
+        if (!file.IsOpen()) return false;
+
+        const char* data = file.GetData();
+        const uint64_t size = file.GetSize();
+        IndexHeader header;
+        if (size < sizeof(IndexHeader)) return false;
+        std::memcpy(&header, data, sizeof(header));
+        if (header.Magic != IndexHeader::MagicValue || header.Version != IndexHeader::CurrentVersion ||
+            sizeof(IndexHeader) + (uint64_t)header.Count * sizeof(IndexEntry) + header.StringBytes > size)
+        {
+            CORE_WARN("[AssetDatabase] '{0}' is not a version {1} index - rescanning everything", s_IndexPath, IndexHeader::CurrentVersion);
+            return false;
+        }
+
+        const IndexEntry* entries = (const IndexEntry*)(data + sizeof(IndexHeader));
+        const char* strings = data + sizeof(IndexHeader) + (uint64_t)header.Count * sizeof(IndexEntry);
+
+        s_Records.clear();
+        s_Records.reserve(header.Count);
+        for (uint32_t i = 0; i < header.Count; i++)
+        {
+            IndexEntry entry;
+            std::memcpy(&entry, &entries[i], sizeof(entry));
+            if ((uint64_t)entry.PathOffset + entry.PathLength > header.StringBytes || entry.Type >= (uint32_t)AssetType::Count)
+            {
+                CORE_WARN("[AssetDatabase] '{0}' is corrupt - rescanning everything", s_IndexPath);
+                s_Records.clear();
+                return false;
+            }
+
+            AssetRecord record;
+            record.ID = entry.ID;
+            record.Path.assign(strings + entry.PathOffset, entry.PathLength);
+            record.Type = (AssetType)entry.Type;
+            record.Size = entry.Size;
+            record.ModifiedTime = entry.ModifiedTime;
+            record.ContentHash = entry.ContentHash;
+            record.ImportedHash = entry.ImportedHash;
+            record.ImportSettings = entry.ImportSettings;
+            s_Records.push_back(std::move(record));
+        }
+        return true;
+    }
+
+    void NotifyChanged(const AssetRecord& record)
+    {
+        for (const AssetDatabase::ChangeCallback& callback : s_ChangeCallbacks)
+            callback(record);
+    }
+
+    void FinishImport(uint64_t id, uint64_t hash, uint64_t settings, bool succeeded)
+    {
+        auto inFlight = s_InFlight.find(id);
+        if (inFlight == s_InFlight.end()) return; // Shut down meanwhile
+        s_InFlight.erase(inFlight);
+
+        auto it = s_ByID.find(id);
+        if (succeeded && it != s_ByID.end() && s_Records[it->second].ContentHash == hash)
+        {
+            s_Records[it->second].ImportedHash = hash;
+            s_Records[it->second].ImportSettings = settings;
+            MarkDirty();
+            NotifyChanged(s_Records[it->second]);
+        }
+        if (succeeded) s_Imported++;
+        else s_ImportFailed++;
+
+        if (s_InFlight.empty())
+            CORE_INFO("[AssetDatabase] Imported {0} assets ({1} failed) in {2} ms", s_Imported, s_ImportFailed, MsSince(s_ImportStart));
+    }
+
+    void QueueImport(const AssetRecord& record, uint64_t settings, const AssetDatabase::Importer& importer)
+    {
+        if (s_InFlight.empty())
+        {
+            s_ImportStart = Clock::now();
+            s_Imported = s_ImportFailed = 0;
+        }
+        s_InFlight[record.ID] = record.ContentHash;
+
+        auto succeeded = std::make_shared<bool>(false);
+        AsyncLoader::Submit(
+            [succeeded, import = importer.Import, path = AssetDatabase::GetAbsolutePath(record)]() { *succeeded = import(path); },
+            [succeeded, id = (uint64_t)record.ID, hash = record.ContentHash, settings]() { FinishImport(id, hash, settings, *succeeded); });
+    }
+
+    void RegisterBuiltInImporters()
+    {
+        if (!s_Importers.count((uint32_t)AssetType::Texture))
+        {
+            AssetDatabase::RegisterImporter(AssetType::Texture, {
+                []() -> uint64_t { return CookedTexture::GetSettings().Enabled ? CookedTexture::GetSettingsKey() : 0; },
+                [](const std::string& path)
+                {
+                    if (!CookedTexture::GetSettings().Enabled) return true;
+                    std::string cookedPath = path + CookedTexture::Extension;
+                    return CookedTexture::IsUpToDate(cookedPath, path) || CookedTexture::Cook(cookedPath, path);
+                } });
+        }
+
+        if (!s_Importers.count((uint32_t)AssetType::Model))
+        {
+            AssetDatabase::RegisterImporter(AssetType::Model, {
+                []() -> uint64_t { return (uint64_t)Mesh::DefaultFormat; },
+                [](const std::string& path)
+                {
+                    if (GetExtension(path) != ".obj") return true; // No importer - nothing to cook
+                    // Same artifact LoadModel(name, path) uses with its default settings
+                    std::string cookedPath = CookedMesh::GetCookedPath(path, Mesh::DefaultFormat, 0);
+                    if (CookedMesh::IsUpToDate(cookedPath, path, Mesh::DefaultFormat, 0)) return true;
+
+                    std::vector<Vertex> vertices;
+                    std::vector<uint32_t> indices;
+                    ObjImporter::Stats imported;
+                    return ObjImporter::Load(path, vertices, indices, &imported) &&
+                           CookedMesh::Cook(cookedPath, vertices, indices, Mesh::DefaultFormat, 0, imported.TotalMs);
+                } });
+        }
+    }
+
+    // ---- Scanning - shared by the full walk and the per-path refresh ----
+    struct Found
+    {
+        std::string Path;
+        uint64_t Size = 0;
+        int64_t ModifiedTime = 0;
+        size_t Record = NOT_FOUND;
+        uint64_t Hash = 0;
+        bool Readable = true;
+    };
+
+    struct Scan
+    {
+        std::vector<Found> Files;   // New or changed - hashed in Apply()
+        std::vector<bool> Seen;     // Per record; records left unseen are gone
+        bool Full = false;          // Whole tree walked - every record is checked for re-import
+        AssetDatabase::Stats Stats;
+    };
+
+    // Hidden files and directories (.git, .vs, ...) are not assets
+    bool IsHidden(const std::string& path)
+    {
+        size_t slash = path.find_last_of('/');
+        return path[slash == std::string::npos ? 0 : slash + 1] == '.';
+    }
+
+    // One directory entry, `path` relative to the root. Only stats it - the
+    // file is read later, and only if size or mtime differ from the index.
+    void Visit(Scan& scan, const fs::directory_entry& entry, std::string path)
+    {
+        std::error_code error;
+        if (!entry.is_regular_file(error) || IsArtifact(GetExtension(path))) return;
+
+        Found file;
+        file.Size = entry.file_size(error);
+        if (error) return;
+        file.ModifiedTime = (int64_t)entry.last_write_time(error).time_since_epoch().count();
+        if (error) return;
+        file.Path = std::move(path);
+
+        auto record = s_ByPath.find(file.Path);
+        if (record != s_ByPath.end())
+        {
+            file.Record = record->second;
+            scan.Seen[file.Record] = true;
+            const AssetRecord& known = s_Records[file.Record];
+            if (known.ModifiedTime != 0 && known.Size == file.Size && known.ModifiedTime == file.ModifiedTime)
+            {
+                scan.Stats.Unchanged++;
+                return;
+            }
+        }
+        scan.Files.push_back(std::move(file));
+    }
+
+    // Everything under `directory` ("" = the root). False if the walk failed -
+    // that would look like mass deletion, so the caller must not apply it.
+    bool Walk(Scan& scan, const std::string& directory)
+    {
+        const std::string start = directory.empty() ? s_Root : s_Root + "/" + directory;
+        std::error_code error;
+        fs::recursive_directory_iterator it(start, fs::directory_options::skip_permission_denied, error), end;
+        for (; !error && it != end; it.increment(error))
+        {
+            std::string path = it->path().generic_string();
+            if (path.size() <= s_RootPrefix) continue;
+            path.erase(0, s_RootPrefix);
+
+            if (IsHidden(path))
+            {
+                std::error_code entryError;
+                if (it->is_directory(entryError)) it.disable_recursion_pending();
+                continue;
+            }
+            Visit(scan, *it, std::move(path));
+        }
+
+        if (error)
+        {
+            CORE_ERROR("[AssetDatabase] Scan of '{0}' failed: {1}", start, error.message());
+            return false;
+        }
+        return true;
+    }
+
+    // Records at or below `path` - the scan decides whether they still exist
+    void Unsee(Scan& scan, const std::string& path)
+    {
+        auto exact = s_ByPath.find(path);
+        if (exact != s_ByPath.end()) scan.Seen[exact->second] = false;
+
+        const std::string prefix = path + "/";
+        for (size_t i = 0; i < s_Records.size(); i++)
+        {
+            if (s_Records[i].Path.compare(0, prefix.size(), prefix) == 0)
+                scan.Seen[i] = false;
+        }
+    }
+
+    // Hash what the walk found, apply it, detect moves and removals, queue imports
+    AssetDatabase::Stats Apply(Scan& scan, bool import, Clock::time_point start)
+    {
+        AssetDatabase::Stats& stats = scan.Stats;
+        std::vector<Found>& found = scan.Files;
+        std::vector<bool>& seen = scan.Seen;
+        stats.WalkMs = MsSince(start);
+
+        // ---- Hash new and changed files on all cores ----
+        auto hashStart = Clock::now();
+        {
+            std::atomic<size_t> next{ 0 };
+            auto work = [&]()
+            {
+                for (size_t i; (i = next.fetch_add(1)) < found.size();)
+                    found[i].Hash = HashFile(s_Root + "/" + found[i].Path, found[i].Size, found[i].Readable);
+            };
+
+            uint32_t workerCount = (uint32_t)std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), found.size());
+            std::vector<std::thread> workers;
+            for (uint32_t i = 1; i < workerCount; i++)
+                workers.emplace_back(work);
+            work();
+            for (auto& worker : workers) worker.join();
+        }
+        stats.HashMs = MsSince(hashStart);
+
+        // ---- Apply ----
+        const int64_t racyAfter = (int64_t)(fs::file_time_type::clock::now() - RACY_WINDOW).time_since_epoch().count();
+        std::vector<size_t> added;
+        std::vector<uint64_t> modified;
+        std::vector<uint64_t> changed;   // Anything that may need a re-import
+        for (Found& file : found)
+        {
+            if (!file.Readable) continue; // Locked - try again next scan; a known record stays seen
+            stats.HashedBytes += file.Size;
+            int64_t modifiedTime = file.ModifiedTime >= racyAfter ? 0 : file.ModifiedTime;
+
+            if (file.Record == NOT_FOUND)
+            {
+                added.push_back(&file - found.data());
+                continue;
+            }
+
+            AssetRecord& record = s_Records[file.Record];
+            if (record.ContentHash == file.Hash)
+            {
+                stats.Touched++;
+            }
+            else
+            {
+                stats.Modified++;
+                EraseHash(record.ContentHash, file.Record);
+                s_ByHash.emplace(file.Hash, file.Record);
+                record.ContentHash = file.Hash;
+                modified.push_back(record.ID);
+                changed.push_back(record.ID);
+            }
+            record.Size = file.Size;
+            record.ModifiedTime = modifiedTime;
+            MarkDirty();
+        }
+
+        // New paths carrying the bytes of a vanished one are moves
+        std::unordered_multimap<uint64_t, size_t> vanished;
+        for (size_t i = 0; i < s_Records.size(); i++)
+            if (!seen[i]) vanished.emplace(s_Records[i].ContentHash, i);
+
+        // A handful of path changes patch the lookups; a large batch rebuilds them once
+        const bool rebuild = (added.size() + vanished.size()) * 8 > s_Records.size();
+
+        for (size_t index : added)
+        {
+            const Found& file = found[index];
+            size_t recordIndex;
+            auto move = vanished.find(file.Hash);
+            if (move != vanished.end())
+            {
+                recordIndex = move->second;
+                seen[recordIndex] = true;
+                vanished.erase(move);
+                if (!rebuild) UnlinkRecord(recordIndex);
+                s_Records[recordIndex].ImportedHash = 0; // Artifacts live next to the old path
+                stats.Moved++;
+            }
+            else
+            {
+                recordIndex = s_Records.size();
+                s_Records.emplace_back();
+                seen.push_back(true);
+                s_Records.back().ID = Core::UUID();
+                s_Records.back().ContentHash = file.Hash;
+                stats.Added++;
+            }
+
+            AssetRecord& record = s_Records[recordIndex];
+            record.Path = file.Path;
+            record.Type = AssetDatabase::GetTypeFromPath(file.Path);
+            record.Size = file.Size;
+            record.ModifiedTime = file.ModifiedTime >= racyAfter ? 0 : file.ModifiedTime;
+            changed.push_back(record.ID);
+            if (!rebuild) LinkRecord(recordIndex);
+        }
+
+        // Whatever was not seen is gone. Back to front: the record moved into a freed slot is always a kept one.
+        for (size_t i = s_Records.size(); i-- > 0;)
+        {
+            if (seen[i]) continue;
+            if (!rebuild) UnlinkRecord(i);
+            EraseRecord(i);
+            stats.Removed++;
+        }
+
+        if (rebuild) RebuildLookups();
+        if (!added.empty() || stats.Removed > 0 || stats.Modified > 0)
+        {
+            s_Revision++;
+            MarkDirty();
+        }
+
+        // ---- Re-import what changed since its last import ----
+        auto importIfStale = [&stats](const AssetRecord& record)
+        {
+            auto importer = s_Importers.find((uint32_t)record.Type);
+            if (importer == s_Importers.end()) return;
+
+            uint64_t settings = importer->second.GetSettings ? importer->second.GetSettings() : 0;
+            if (record.ImportedHash == record.ContentHash && record.ImportSettings == settings) return;
+
+            auto inFlight = s_InFlight.find(record.ID);
+            if (inFlight != s_InFlight.end() && inFlight->second == record.ContentHash) return;
+
+            QueueImport(record, settings, importer->second);
+            stats.ImportsQueued++;
+        };
+        if (import && scan.Full)
+        {
+            for (const AssetRecord& record : s_Records)
+                importIfStale(record);
+        }
+        else if (import)
+        {
+            for (uint64_t id : changed)
+            {
+                auto it = s_ByID.find(id);
+                if (it != s_ByID.end()) importIfStale(s_Records[it->second]);
+            }
+        }
+
+        // Changed content is announced now, or by FinishImport() once its re-import is done
+        for (uint64_t id : modified)
+        {
+            auto it = s_ByID.find(id);
+            if (it == s_ByID.end()) continue;
+            auto inFlight = s_InFlight.find(id);
+            if (inFlight == s_InFlight.end() || inFlight->second != s_Records[it->second].ContentHash)
+                NotifyChanged(s_Records[it->second]);
+        }
+
+        // A full scan saves right away; per-path refreshes leave it to Update()
+        if (scan.Full) AssetDatabase::Save();
+
+        stats.Files = (uint32_t)s_Records.size();
+        stats.TotalMs = MsSince(start);
+        s_Stats = stats;
+        return stats;
+    }
+}
+
+bool AssetDatabase::Init(const std::string& root, const std::string& indexPath, bool watch)
+{
+    auto start = Clock::now();
+    s_Root = fs::path(root).lexically_normal().generic_string();
+    while (s_Root.size() > 1 && s_Root.back() == '/')
+        s_Root.pop_back();
+    s_RootPrefix = s_Root.size() + 1;
+    s_IndexPath = indexPath;
+    RegisterBuiltInImporters();
+
+    bool loaded = LoadIndex();
+    RebuildLookups();
+    double loadMs = MsSince(start);
+
+    std::error_code error;
+    if (!fs::is_directory(s_Root, error))
+    {
+        CORE_WARN("[AssetDatabase] Asset root '{0}' does not exist - database is empty", s_Root);
+        return false;
+    }
+
+    CORE_INFO("[AssetDatabase] Index '{0}': {1} ({2} assets, {3} ms)", s_IndexPath,
+              loaded ? "loaded" : "not found", s_Records.size(), loadMs);
+
+    // Watching starts first - an edit during the initial scan is picked up by Update()
+    if (watch) s_Watcher.Start(s_Root);
+    Refresh();
+    LogStats();
+    return true;
+}
+
+void AssetDatabase::Shutdown()
+{
+    s_Watcher.Stop();
+    s_ChangeCallbacks.clear();
+    Save();
+    s_InFlight.clear(); // Their uploads are dropped by AsyncLoader::Shutdown
+    s_Records.clear();
+    RebuildLookups();
+}
+
+AssetDatabase::Stats AssetDatabase::Refresh(bool import)
+{
+    auto start = Clock::now();
+    Scan scan;
+    scan.Files.reserve(s_Records.size() / 8);
+    scan.Seen.assign(s_Records.size(), false);
+    scan.Full = true;
+
+    std::error_code error;
+    if (s_Root.empty() || !fs::is_directory(s_Root, error) || !Walk(scan, ""))
+    {
+        s_Stats = Stats();
+        return s_Stats;
+    }
+    return Apply(scan, import, start);
+}
+
+AssetDatabase::Stats AssetDatabase::Refresh(const std::vector<std::string>& paths, bool import)
+{
+    auto start = Clock::now();
+    Scan scan;
+    scan.Seen.assign(s_Records.size(), true);
+
+    // A path inside a directory that is listed as well is covered by that directory's walk
+    std::unordered_set<std::string> listed(paths.begin(), paths.end());
+    auto isCovered = [&listed](std::string path)
+    {
+        for (size_t slash; (slash = path.find_last_of('/')) != std::string::npos;)
+        {
+            path.resize(slash);
+            if (listed.count(path)) return true;
+        }
+        return false;
+    };
+
+    for (const std::string& path : paths)
+    {
+        if (path.empty()) return Refresh(import); // Lost events - rescan everything
+        if (IsHidden(path) || isCovered(path)) continue;
+
+        std::error_code error;
+        fs::directory_entry entry(s_Root + "/" + path, error);
+        if (!error && entry.is_regular_file(error))
+        {
+            auto record = s_ByPath.find(path);
+            if (record != s_ByPath.end()) scan.Seen[record->second] = false;
+            Visit(scan, entry, path);
+            continue;
+        }
+
+        // Directory, or a path that is gone (file or whole directory)
+        Unsee(scan, path);
+        if (!error && entry.is_directory(error) && !Walk(scan, path))
+            return Refresh(import);
+    }
+    return Apply(scan, import, start);
+}
+
+void AssetDatabase::Update()
+{
+    std::vector<std::string> paths = s_Watcher.Poll();
+    if (!paths.empty())
+    {
+        Stats stats = Refresh(paths);
+        if (stats.Added + stats.Modified + stats.Moved + stats.Removed > 0)
+        {
+            CORE_INFO("[AssetDatabase] {0} changed paths: {1} added, {2} modified, {3} moved, {4} removed ({5} ms)",
+                      paths.size(), stats.Added, stats.Modified, stats.Moved, stats.Removed, stats.TotalMs);
+        }
+    }
+
+    // Edits come in bursts - one save once things settle, not one per change
+    if (s_Dirty && s_InFlight.empty() && Clock::now() - s_DirtySince >= SAVE_DELAY && !Save())
+        s_DirtySince = Clock::now(); // Retry later, not every frame
+}
+
+bool AssetDatabase::Save()
+{
+    if (!s_Dirty || s_IndexPath.empty()) return true;
+
+    IndexHeader header;
+    header.Count = (uint32_t)s_Records.size();
+    std::vector<IndexEntry> entries(s_Records.size());
+    std::string strings;
+    for (size_t i = 0; i < s_Records.size(); i++)
+    {
+        const AssetRecord& record = s_Records[i];
+        IndexEntry& entry = entries[i];
+        entry.ID = record.ID;
+        entry.Size = record.Size;
+        entry.ModifiedTime = record.ModifiedTime;
+        entry.ContentHash = record.ContentHash;
+        entry.ImportedHash = record.ImportedHash;
+        entry.ImportSettings = record.ImportSettings;
+        entry.PathOffset = (uint32_t)strings.size();
+        entry.PathLength = (uint32_t)record.Path.size();
+        entry.Type = (uint32_t)record.Type;
+        entry.Reserved = 0;
+        strings += record.Path;
+    }
+    header.StringBytes = (uint32_t)strings.size();
+
+    // Write to a temp file and rename, so a crash never leaves a half-written index
+    std::error_code error;
+    fs::path parent = fs::path(s_IndexPath).parent_path();
+    if (!parent.empty()) fs::create_directories(parent, error);
+
+    std::string tmpPath = s_IndexPath + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        file.write((const char*)&header, sizeof(header));
+        file.write((const char*)entries.data(), (std::streamsize)(entries.size() * sizeof(IndexEntry)));
+        file.write(strings.data(), (std::streamsize)strings.size());
+        if (!file)
+        {
+            CORE_WARN("[AssetDatabase] Failed to write {0}", tmpPath);
+            return false;
+        }
+    }
+    fs::rename(tmpPath, s_IndexPath, error);
+    if (error)
+    {
+        fs::remove(tmpPath, error);
+        return false;
+    }
+
+    s_Dirty = false;
+    return true;
+}
+
+void AssetDatabase::RegisterImporter(AssetType type, Importer importer)
+{
+    s_Importers[(uint32_t)type] = std::move(importer);
+}
+
+void AssetDatabase::AddChangeCallback(ChangeCallback callback)
+{
+    s_ChangeCallbacks.push_back(std::move(callback));
+}
+
+const AssetRecord* AssetDatabase::Find(Core::UUID id)
+{
+    auto it = s_ByID.find(id);
+    return it == s_ByID.end() ? nullptr : &s_Records[it->second];
+}
+
+const AssetRecord* AssetDatabase::FindByPath(const std::string& path)
+{
+    auto it = s_ByPath.find(path);
+    return it == s_ByPath.end() ? nullptr : &s_Records[it->second];
+}
+
+std::vector<const AssetRecord*> AssetDatabase::FindByHash(uint64_t contentHash)
+{
+    std::vector<const AssetRecord*> records;
+    auto range = s_ByHash.equal_range(contentHash);
+    for (auto it = range.first; it != range.second; ++it)
+        records.push_back(&s_Records[it->second]);
+    return records;
+}
+
+const AssetDatabase::Directory* AssetDatabase::GetDirectory(const std::string& path)
+{
+    auto it = s_Directories.find(path);
+    return it == s_Directories.end() ? nullptr : &it->second;
+}
+
+std::string AssetDatabase::GetAbsolutePath(const AssetRecord& record)
+{
+    return s_Root + "/" + record.Path;
+}
+
+const std::string& AssetDatabase::GetRoot()
+{
+    return s_Root;
+}
+
+size_t AssetDatabase::GetAssetCount()
+{
+    return s_Records.size();
+}
+
+uint64_t AssetDatabase::GetRevision()
+{
+    return s_Revision;
+}
+
+uint32_t AssetDatabase::GetPendingImports()
+{
+    return (uint32_t)s_InFlight.size();
+}
+
+AssetType AssetDatabase::GetTypeFromPath(const std::string& path)
+{
+    static const std::unordered_map<std::string, AssetType> s_Extensions = {
+        { ".png", AssetType::Texture }, { ".jpg", AssetType::Texture }, { ".jpeg", AssetType::Texture },
+        { ".tga", AssetType::Texture }, { ".bmp", AssetType::Texture }, { ".ppm", AssetType::Texture },
+        { ".pgm", AssetType::Texture }, { ".psd", AssetType::Texture }, { ".hdr", AssetType::Texture },
+        { ".obj", AssetType::Model },   { ".fbx", AssetType::Model },   { ".gltf", AssetType::Model },
+        { ".glb", AssetType::Model },
+        { ".scene", AssetType::Scene }, { ".sc", AssetType::Scene },
+        { ".glsl", AssetType::Shader }, { ".vert", AssetType::Shader }, { ".frag", AssetType::Shader },
+        { ".wav", AssetType::Audio },   { ".ogg", AssetType::Audio },   { ".mp3", AssetType::Audio },
+        { ".lua", AssetType::Script },
+    };
+
+    auto it = s_Extensions.find(GetExtension(path));
+    return it == s_Extensions.end() ? AssetType::Unknown : it->second;
+}
+
+const char* AssetDatabase::GetTypeName(AssetType type)
+{
+    switch (type)
+    {
+    case AssetType::Texture: return "Texture";
+    case AssetType::Model:   return "Model";
+    case AssetType::Scene:   return "Scene";
+    case AssetType::Shader:  return "Shader";
+    case AssetType::Audio:   return "Audio";
+    case AssetType::Script:  return "Script";
+    default:                 return "File";
+    }
+}
+
+AssetDatabase::Stats AssetDatabase::GetStats()
+{
+    return s_Stats;
+}
+
+void AssetDatabase::LogStats()
+{
+    const Stats& stats = s_Stats;
+    CORE_INFO("[AssetDatabase] {0} assets in {1} ms (walk {2} ms, hash {3} ms / {4} KB)",
+              stats.Files, stats.TotalMs, stats.WalkMs, stats.HashMs, stats.HashedBytes / 1024);
+    CORE_INFO("[AssetDatabase]   {0} unchanged, {1} touched, {2} added, {3} modified, {4} moved, {5} removed, {6} imports queued",
+              stats.Unchanged, stats.Touched, stats.Added, stats.Modified, stats.Moved, stats.Removed, stats.ImportsQueued);
+}
@@ -0,0 +1,131 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <Core/UUID.hpp>
+
+// ============================================================================
+// AssetDatabase - registry of every file under the project's asset root
+// ============================================================================
+// Each file gets a stable Core::UUID, its size, mtime and content hash
+// (FNV-1a 64), and the hash + importer settings of its last import. All of it
+// lives in a small binary index (cache/assets.db) that survives restarts.
+//
+// Refresh() walks the root and only reads files whose size or mtime differ
+// from the index - an unchanged 100k-file project costs one directory walk.
+// Files that need hashing are hashed on all cores. A new path with the
+// content of a vanished one is a move and keeps its UUID. Files modified in
+// the last two seconds are re-hashed on the next scan as well (an edit in
+// the same mtime tick would otherwise go unnoticed).
+//
+// Imports: an asset is re-imported when its content hash or its importer's
+// settings differ from the last import. Importers run on AsyncLoader
+// workers; completion is recorded on the main thread in
+// ResourceManager::Update(). A full Refresh() saves the index; later edits
+// are saved by Update() once things settle, and by Shutdown().
+// Built in: textures -> <path>.ctex (CookedTexture), OBJ models -> <path>.Float32.lod0.cmesh
+// (the artifact LoadModel uses with default settings).
+// Cooked artifacts themselves are not assets.
+//
+// Hot reload: a FileWatcher reports edits; Update() refreshes just those
+// paths - patching the lookups in place rather than rebuilding them - and
+// announces changed content through the change callbacks, after the
+// re-import for types that have an importer, so listeners never read a
+// half-written artifact.
+// ============================================================================
+enum class AssetType : uint32_t
+{
+    Unknown = 0,
+    Texture,
+    Model,
+    Scene,
+    Shader,
+    Audio,
+    Script,
+    Count
+};
+
+struct AssetRecord
+{
+    Core::UUID ID = 0;
+    std::string Path;               // Relative to the root, '/' separated
+    AssetType Type = AssetType::Unknown;
+    uint64_t Size = 0;
+    int64_t ModifiedTime = 0;       // file_time ticks; 0 = re-hash on the next scan
+    uint64_t ContentHash = 0;
+    uint64_t ImportedHash = 0;      // ContentHash at the last successful import, 0 = never
+    uint64_t ImportSettings = 0;    // Importer settings used for that import
+};
+
+namespace AssetDatabase
+{
+    struct Stats
+    {
+        uint32_t Files = 0;          // Assets after the scan
+        uint32_t Unchanged = 0;      // Size + mtime matched - not read
+        uint32_t Touched = 0;        // Re-hashed, same content
+        uint32_t Added = 0;
+        uint32_t Modified = 0;
+        uint32_t Moved = 0;          // Same content under a new path - UUID kept
+        uint32_t Removed = 0;
+        uint32_t ImportsQueued = 0;
+        uint64_t HashedBytes = 0;
+        double WalkMs = 0.0;         // Directory enumeration + stat
+        double HashMs = 0.0;         // Wall time, all threads
+        double TotalMs = 0.0;
+    };
+
+    struct Importer
+    {
+        std::function<uint64_t()> GetSettings;                      // Current settings key
+        std::function<bool(const std::string& path)> Import;        // Worker thread; path includes the root
+    };
+
+    // Directory tree for browsers; names sorted
+    struct Directory
+    {
+        std::vector<std::string> Children;   // Relative directory paths
+        std::vector<Core::UUID> Assets;
+    };
+
+    // Main thread: called with an asset whose content changed. Must not call Refresh().
+    using ChangeCallback = std::function<void(const AssetRecord& asset)>;
+
+    // Loads the index, starts watching the root (watch) and runs a first Refresh()
+    bool Init(const std::string& root = "assets", const std::string& indexPath = "cache/assets.db", bool watch = true);
+    // Saves the index and drops the change callbacks; pending imports re-run next time
+    void Shutdown();
+
+    // Rescan the root. Main thread.
+    Stats Refresh(bool import = true);
+    // Rescan only these paths - files or directories, existing or gone. "" rescans everything.
+    Stats Refresh(const std::vector<std::string>& paths, bool import = true);
+    // Main thread, once per frame: applies the watcher's debounced changes, saves when settled
+    void Update();
+    bool Save();
+
+    void RegisterImporter(AssetType type, Importer importer);
+    void AddChangeCallback(ChangeCallback callback);
+
+    const AssetRecord* Find(Core::UUID id);
+    const AssetRecord* FindByPath(const std::string& path);
+    // Content-addressed lookup: every asset with these bytes
+    std::vector<const AssetRecord*> FindByHash(uint64_t contentHash);
+    // nullptr for a directory that does not exist; "" is the root
+    const Directory* GetDirectory(const std::string& path);
+
+    std::string GetAbsolutePath(const AssetRecord& record);
+    const std::string& GetRoot();
+    size_t GetAssetCount();
+    // Bumped whenever an asset is added, removed, moved or modified
+    uint64_t GetRevision();
+    uint32_t GetPendingImports();
+
+    AssetType GetTypeFromPath(const std::string& path);
+    const char* GetTypeName(AssetType type);
+
+    Stats GetStats();          // Last Refresh()
+    void LogStats();
+}
@@ -0,0 +1,193 @@
+#include "AsyncLoader.hpp"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Core/Log.hpp>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Job
+    {
+        AsyncLoader::Work Work;
+        AsyncLoader::Upload Upload;
+    };
+
+    std::mutex s_Mutex;
+    std::condition_variable s_WorkAvailable;
+    std::deque<Job> s_Queue;        // Waiting for a worker
+    std::deque<Job> s_Finished;     // Waiting for Update()
+    std::vector<std::thread> s_Workers;
+    uint32_t s_Pending = 0;         // Submitted, not yet uploaded or dropped
+    bool s_Stopping = false;
+
+    AsyncLoader::Stats s_Stats;
+    Clock::time_point s_BatchStart;
+    bool s_BatchLogged = true;
+
+    double MsSince(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    void WorkerLoop()
+    {
+        for (;;)
+        {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(s_Mutex);
+                s_WorkAvailable.wait(lock, []() { return s_Stopping || !s_Queue.empty(); });
+                if (s_Stopping) return;
+                job = std::move(s_Queue.front());
+                s_Queue.pop_front();
+            }
+
+            auto start = Clock::now();
+            if (job.Work) job.Work();
+            double ms = MsSince(start);
+
+            std::lock_guard<std::mutex> lock(s_Mutex);
+            s_Stats.WorkMs += ms;
+            if (s_Stopping) return;
+            s_Finished.push_back(std::move(job));
+        }
+    }
+
+    // Caller holds s_Mutex
+    void StartWorkers()
+    {
+        // Leave one core to the main thread; hardware_concurrency() may report 0
+        uint32_t cores = std::thread::hardware_concurrency();
+        uint32_t count = cores > 1 ? cores - 1 : 1;
+        s_Stopping = false;
+        s_Workers.reserve(count);
+        for (uint32_t i = 0; i < count; i++)
+            s_Workers.emplace_back(WorkerLoop);
+        s_Stats.Workers = count;
+    }
+}
+
+void AsyncLoader::Submit(Work work, Upload upload)
+{
+    {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        if (s_Workers.empty())
+            StartWorkers();
+
+        if (s_Pending == 0)
+        {
+            uint32_t workers = s_Stats.Workers;
+            s_Stats = Stats();
+            s_Stats.Workers = workers;
+            s_BatchStart = Clock::now();
+            s_BatchLogged = false;
+        }
+
+        s_Queue.push_back({ std::move(work), std::move(upload) });
+        s_Pending++;
+        s_Stats.Submitted++;
+    }
+    s_WorkAvailable.notify_one();
+}
+
+uint32_t AsyncLoader::Update(double budgetMs)
+{
+    auto start = Clock::now();
+    uint32_t uploaded = 0;
+
+    for (;;)
+    {
+        Job job;
+        {
+            std::lock_guard<std::mutex> lock(s_Mutex);
+            if (s_Finished.empty()) break;
+            job = std::move(s_Finished.front());
+            s_Finished.pop_front();
+        }
+
+        // Outside the lock - uploads may Submit follow-up jobs
+        if (job.Upload) job.Upload();
+        uploaded++;
+
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        s_Pending--;
+        s_Stats.Uploaded++;
+        if (s_Stats.Uploaded == 1)
+            s_Stats.FirstReadyMs = MsSince(s_BatchStart);
+        if (s_Pending == 0)
+            s_Stats.AllReadyMs = MsSince(s_BatchStart);
+
+        if (MsSince(start) >= budgetMs) break;
+    }
+
+    if (uploaded == 0) return 0;
+
+    double ms = MsSince(start);
+    bool drained;
+    {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        s_Stats.UploadMs += ms;
+        s_Stats.MaxFrameUploadMs = std::max(s_Stats.MaxFrameUploadMs, ms);
+        s_Stats.Frames++;
+        drained = s_Pending == 0 && !s_BatchLogged;
+        if (drained) s_BatchLogged = true;
+    }
+
+    if (drained)
+        LogStats();
+    return uploaded;
+}
+
+uint32_t AsyncLoader::GetPendingCount()
+{
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    return s_Pending;
+}
+
+bool AsyncLoader::IsIdle()
+{
+    return GetPendingCount() == 0;
+}
+
+AsyncLoader::Stats AsyncLoader::GetStats()
+{
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    return s_Stats;
+}
+
+void AsyncLoader::LogStats()
+{
+    Stats stats = GetStats();
+    CORE_INFO("[AsyncLoader] {0} loads on {1} workers: first ready {2} ms, all ready {3} ms",
+              stats.Uploaded, stats.Workers, stats.FirstReadyMs, stats.AllReadyMs);
+    CORE_INFO("[AsyncLoader]   worker time {0} ms, main-thread upload {1} ms over {2} frames (max {3} ms/frame)",
+              stats.WorkMs, stats.UploadMs, stats.Frames, stats.MaxFrameUploadMs);
+}
+
+void AsyncLoader::Shutdown()
+{
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        s_Stopping = true;
+        s_Queue.clear();
+        workers.swap(s_Workers);
+    }
+    s_WorkAvailable.notify_all();
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    s_Finished.clear();
+    s_Pending = 0;
+    s_Stopping = false;
+    s_BatchLogged = true;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+
+// ============================================================================
+// AsyncLoader - worker threads for IO/decode, budgeted main-thread upload
+// ============================================================================
+// A job has two halves: Work runs on a worker thread (file IO, parsing,
+// cooking - anything without GL), Upload runs on the main thread inside
+// Update() once Work has finished. Update() runs finished uploads until the
+// frame's budget is spent, so a burst of loads is spread over frames
+// instead of stalling one.
+//
+// Workers start on the first Submit(). Shutdown() drops queued jobs, waits
+// for the ones in flight and discards their uploads - callers must make
+// Upload safe to skip (ResourceManager checks handle generations).
+// ============================================================================
+namespace AsyncLoader
+{
+    using Work = std::function<void()>;
+    using Upload = std::function<void()>;
+
+    struct Stats
+    {
+        uint32_t Submitted = 0;
+        uint32_t Uploaded = 0;
+        uint32_t Workers = 0;
+        double FirstReadyMs = 0.0;     // Submit of the batch -> first upload done
+        double AllReadyMs = 0.0;       // Submit of the batch -> queue drained
+        double WorkMs = 0.0;           // Summed over workers
+        double UploadMs = 0.0;         // Summed over frames
+        double MaxFrameUploadMs = 0.0; // Worst single Update()
+        uint32_t Frames = 0;           // Update() calls that uploaded something
+    };
+
+    // Thread-safe
+    void Submit(Work work, Upload upload);
+
+    // Main thread, once per frame. Always runs at least one finished upload,
+    // then stops once budgetMs is spent. Returns the number of uploads run.
+    uint32_t Update(double budgetMs = 2.0);
+
+    // Jobs submitted but not yet uploaded
+    uint32_t GetPendingCount();
+    bool IsIdle();
+
+    // Stats of the current (or last finished) batch - a batch starts when a
+    // job is submitted to an idle loader
+    Stats GetStats();
+    void LogStats();
+
+    void Shutdown();
+}
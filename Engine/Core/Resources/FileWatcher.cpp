@@ -0,0 +1,292 @@
+#include "FileWatcher.hpp"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+#include <Core/Log.hpp>
+
+#ifdef __linux__
+    #include <cerrno>
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    // How often a blocked watcher thread checks whether it should stop
+    constexpr int WAKE_INTERVAL_MS = 50;
+
+    bool IsHidden(const std::string& name)
+    {
+        return !name.empty() && name[0] == '.';
+    }
+
+#ifdef __linux__
+    constexpr uint32_t WATCH_MASK = IN_CLOSE_WRITE | IN_MODIFY | IN_CREATE | IN_DELETE |
+                                    IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR;
+#endif
+
+    struct FileState
+    {
+        uint64_t Size;
+        int64_t ModifiedTime;
+
+        bool operator!=(const FileState& other) const { return Size != other.Size || ModifiedTime != other.ModifiedTime; }
+    };
+
+    // Polling backend: size + mtime of every visible file under the root
+    void TakeSnapshot(const std::string& root, std::unordered_map<std::string, FileState>& snapshot)
+    {
+        snapshot.clear();
+        const size_t prefix = root.size() + 1;
+
+        std::error_code error;
+        fs::recursive_directory_iterator it(root, fs::directory_options::skip_permission_denied, error), end;
+        for (; !error && it != end; it.increment(error))
+        {
+            std::error_code entryError;
+            if (IsHidden(it->path().filename().string()))
+            {
+                if (it->is_directory(entryError)) it.disable_recursion_pending();
+                continue;
+            }
+            if (!it->is_regular_file(entryError)) continue;
+
+            FileState state;
+            state.Size = it->file_size(entryError);
+            state.ModifiedTime = (int64_t)it->last_write_time(entryError).time_since_epoch().count();
+            if (!entryError)
+                snapshot.emplace(it->path().generic_string().substr(prefix), state);
+        }
+    }
+}
+
+bool FileWatcher::Start(const std::string& root, const Settings& settings)
+{
+    Stop();
+
+    std::error_code error;
+    if (!fs::is_directory(root, error))
+    {
+        CORE_WARN("[FileWatcher] '{0}' is not a directory - not watching", root);
+        return false;
+    }
+
+    m_Root = fs::path(root).lexically_normal().generic_string();
+    while (m_Root.size() > 1 && m_Root.back() == '/')
+        m_Root.pop_back();
+    m_Settings = settings;
+    m_Pending.clear();
+    m_Stats = Stats();
+    m_Backend = Backend::Polling;
+
+#ifdef __linux__
+    // Watches are added here, before Start returns - nothing after it is missed
+    if (!settings.ForcePolling)
+    {
+        m_InotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_InotifyFd >= 0 && AddWatches(""))
+        {
+            m_Backend = Backend::Inotify;
+        }
+        else
+        {
+            CORE_WARN("[FileWatcher] inotify unavailable ({0}) - polling every {1} ms", std::strerror(errno), settings.PollIntervalMs);
+            if (m_InotifyFd >= 0) close(m_InotifyFd);
+            m_InotifyFd = -1;
+            m_Watches.clear();
+        }
+    }
+#endif
+
+    m_Running = true;
+    m_Thread = std::thread(m_Backend == Backend::Inotify ? &FileWatcher::RunInotify : &FileWatcher::RunPolling, this);
+
+    CORE_INFO("[FileWatcher] Watching '{0}' ({1}, debounce {2} ms)", m_Root, GetBackendName(m_Backend), settings.DebounceMs);
+    return true;
+}
+
+void FileWatcher::Stop()
+{
+    if (!m_Thread.joinable()) return;
+
+    m_Running = false;
+    m_Thread.join();
+
+#ifdef __linux__
+    if (m_InotifyFd >= 0) close(m_InotifyFd);
+#endif
+    m_InotifyFd = -1;
+    m_Watches.clear();
+    m_Backend = Backend::None;
+}
+
+std::vector<std::string> FileWatcher::Poll()
+{
+    std::vector<std::string> ready;
+    auto toDuration = [](double ms) { return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(ms)); };
+    const Clock::time_point now = Clock::now();
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_Pending.empty()) return ready;
+
+    bool settled = now - m_LastEvent >= toDuration(m_Settings.DebounceMs);
+    for (auto it = m_Pending.begin(); !settled && it != m_Pending.end(); ++it)
+        settled = now - it->second >= toDuration(m_Settings.MaxDelayMs);
+    if (!settled) return ready;
+
+    ready.reserve(m_Pending.size());
+    for (auto& [path, firstEvent] : m_Pending)
+        ready.push_back(path);
+    m_Pending.clear();
+    m_Stats.Delivered += ready.size();
+
+    std::sort(ready.begin(), ready.end());
+    return ready;
+}
+
+FileWatcher::Stats FileWatcher::GetStats()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Stats;
+}
+
+const char* FileWatcher::GetBackendName(Backend backend)
+{
+    switch (backend)
+    {
+    case Backend::Inotify: return "inotify";
+    case Backend::Polling: return "polling";
+    default:               return "none";
+    }
+}
+
+void FileWatcher::Push(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Stats.Events++;
+
+    m_LastEvent = Clock::now(); // Restarts the debounce
+    if (!m_Pending.try_emplace(path, m_LastEvent).second)
+        m_Stats.Coalesced++;
+}
+
+bool FileWatcher::AddWatches(const std::string& directory)
+{
+#ifdef __linux__
+    auto addWatch = [this](const std::string& relative)
+    {
+        std::string absolute = relative.empty() ? m_Root : m_Root + "/" + relative;
+        int wd = inotify_add_watch(m_InotifyFd, absolute.c_str(), WATCH_MASK);
+        if (wd < 0) return false;
+        m_Watches[wd] = relative;
+        return true;
+    };
+
+    if (!addWatch(directory)) return false;
+
+    std::error_code error;
+    const size_t prefix = m_Root.size() + 1;
+    fs::recursive_directory_iterator it(directory.empty() ? m_Root : m_Root + "/" + directory,
+                                        fs::directory_options::skip_permission_denied, error), end;
+    for (; !error && it != end; it.increment(error))
+    {
+        std::error_code entryError;
+        if (!it->is_directory(entryError)) continue;
+        if (IsHidden(it->path().filename().string()))
+        {
+            it.disable_recursion_pending();
+            continue;
+        }
+        if (!addWatch(it->path().generic_string().substr(prefix)))
+            return false; // Out of watches (fs.inotify.max_user_watches)
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Stats.Watches = (uint32_t)m_Watches.size();
+    return true;
+#else
+    (void)directory;
+    return false;
+#endif
+}
+
+void FileWatcher::RunInotify()
+{
+#ifdef __linux__
+    alignas(inotify_event) char buffer[64 * 1024];
+
+    while (m_Running)
+    {
+        pollfd descriptor{ m_InotifyFd, POLLIN, 0 };
+        if (poll(&descriptor, 1, WAKE_INTERVAL_MS) <= 0) continue;
+
+        ssize_t length = read(m_InotifyFd, buffer, sizeof(buffer));
+        for (ssize_t offset = 0; offset < length;)
+        {
+            const inotify_event* event = (const inotify_event*)(buffer + offset);
+            offset += sizeof(inotify_event) + event->len;
+
+            if (event->mask & IN_Q_OVERFLOW)
+            {
+                Push(""); // Lost events - the consumer rescans everything
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Stats.Overflows++;
+                continue;
+            }
+
+            auto watch = m_Watches.find(event->wd);
+            if (watch == m_Watches.end()) continue;
+            if (event->mask & IN_IGNORED)
+            {
+                m_Watches.erase(watch); // Directory deleted or moved away
+                continue;
+            }
+            if (event->len == 0 || IsHidden(event->name)) continue;
+
+            std::string path = watch->second.empty() ? std::string(event->name) : watch->second + "/" + event->name;
+
+            // New directories are watched too; their path tells the consumer to scan what is already inside
+            if ((event->mask & IN_ISDIR) && (event->mask & (IN_CREATE | IN_MOVED_TO)) && !AddWatches(path))
+            {
+                CORE_WARN("[FileWatcher] Out of inotify watches - changes under '{0}' are not seen", path);
+            }
+            Push(path);
+        }
+    }
+#endif
+}
+
+void FileWatcher::RunPolling()
+{
+    std::unordered_map<std::string, FileState> previous, current;
+    TakeSnapshot(m_Root, previous);
+
+    while (m_Running)
+    {
+        // Sleep in short steps so Stop() does not wait a whole interval
+        auto wake = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double, std::milli>(m_Settings.PollIntervalMs));
+        while (m_Running && Clock::now() < wake)
+            std::this_thread::sleep_for(std::chrono::milliseconds(WAKE_INTERVAL_MS));
+        if (!m_Running) break;
+
+        TakeSnapshot(m_Root, current);
+        for (const auto& [path, state] : current)
+        {
+            auto it = previous.find(path);
+            if (it == previous.end() || it->second != state) Push(path);
+        }
+        for (const auto& [path, state] : previous)
+        {
+            if (!current.count(path)) Push(path);
+        }
+        previous.swap(current);
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stats.Watches = (uint32_t)previous.size();
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// ============================================================================
+// FileWatcher - change notifications for a directory tree
+// ============================================================================
+// A background thread collects changes: inotify on Linux (one watch per
+// directory, new directories are watched as they appear), otherwise - or if
+// inotify is unavailable or out of watches - a polling walk that compares
+// size + mtime snapshots.
+//
+// Events are coalesced per path and debounced as a batch: Poll() (main
+// thread) hands out every pending path once the tree has been quiet for
+// DebounceMs - or once the oldest one has waited MaxDelayMs, so constant
+// activity cannot hold changes back forever. An editor writing a file in
+// several chunks, a save through temp file + rename, or both halves of a
+// directory move therefore arrive together. Paths are relative to the root,
+// '/' separated. An empty path means "events were lost, rescan everything"
+// (inotify queue overflow).
+// ============================================================================
+class FileWatcher
+{
+public:
+    enum class Backend : uint8_t
+    {
+        None = 0,
+        Inotify,
+        Polling
+    };
+
+    struct Settings
+    {
+        double DebounceMs = 100.0;      // Quiet time before a batch is delivered
+        double MaxDelayMs = 1000.0;     // Delivered regardless after this long
+        double PollIntervalMs = 1000.0; // Polling backend only
+        bool ForcePolling = false;
+    };
+
+    struct Stats
+    {
+        uint64_t Events = 0;            // Raw backend events
+        uint64_t Coalesced = 0;         // Events merged into an already pending path
+        uint64_t Delivered = 0;         // Paths returned by Poll()
+        uint32_t Overflows = 0;         // Lost-event rescans
+        uint32_t Watches = 0;           // inotify watches / polled files
+    };
+
+    FileWatcher() = default;
+    ~FileWatcher() { Stop(); }
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    // False if `root` is not a directory
+    bool Start(const std::string& root, const Settings& settings);
+    bool Start(const std::string& root) { return Start(root, Settings()); }
+    void Stop();
+
+    // Every changed path of a settled batch, each once; empty while events are still arriving
+    std::vector<std::string> Poll();
+
+    bool IsRunning() const { return m_Thread.joinable(); }
+    Backend GetBackend() const { return m_Backend; }
+    const std::string& GetRoot() const { return m_Root; }
+    Stats GetStats();
+
+    static const char* GetBackendName(Backend backend);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // Watcher thread
+    void RunInotify();
+    void RunPolling();
+    bool AddWatches(const std::string& directory);
+    void Push(const std::string& path);
+
+    std::string m_Root;
+    Settings m_Settings;
+    Backend m_Backend = Backend::None;
+    int m_InotifyFd = -1;
+    std::unordered_map<int, std::string> m_Watches;             // inotify wd -> directory; watcher thread after Start
+
+    std::thread m_Thread;
+    std::atomic<bool> m_Running{ false };
+
+    std::mutex m_Mutex;                                         // Guards the ones below
+    std::unordered_map<std::string, Clock::time_point> m_Pending; // Path -> first event
+    Clock::time_point m_LastEvent;
+    Stats m_Stats;
+};
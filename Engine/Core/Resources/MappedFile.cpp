@@ -0,0 +1,98 @@
+#include "MappedFile.hpp"
+#include <Core/Log.hpp>
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+bool MappedFile::Open(const std::string& path)
+{
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        CORE_ERROR("[MappedFile] Cannot open '{0}'", path);
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        CORE_ERROR("[MappedFile] '{0}' is empty", path);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view)
+    {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        CORE_ERROR("[MappedFile] Cannot map '{0}'", path);
+        return false;
+    }
+
+    m_File = file;
+    m_Mapping = mapping;
+    m_Data = (const char*)view;
+    m_Size = (size_t)size.QuadPart;
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        CORE_ERROR("[MappedFile] Cannot open '{0}'", path);
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0)
+    {
+        close(fd);
+        CORE_ERROR("[MappedFile] '{0}' is empty", path);
+        return false;
+    }
+
+    void* view = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // The mapping keeps its own reference
+    if (view == MAP_FAILED)
+    {
+        CORE_ERROR("[MappedFile] Cannot map '{0}'", path);
+        return false;
+    }
+    madvise(view, (size_t)info.st_size, MADV_SEQUENTIAL);
+
+    m_Data = (const char*)view;
+    m_Size = (size_t)info.st_size;
+#endif
+
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (!m_Data) return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(m_Data);
+    CloseHandle((HANDLE)m_Mapping);
+    CloseHandle((HANDLE)m_File);
+    m_File = nullptr;
+    m_Mapping = nullptr;
+#else
+    munmap((void*)m_Data, m_Size);
+#endif
+
+    m_Data = nullptr;
+    m_Size = 0;
+}
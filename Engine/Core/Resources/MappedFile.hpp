@@ -0,0 +1,37 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+// ============================================================================
+// MappedFile - read-only memory map of a whole file
+// ============================================================================
+// The OS pages the file in on demand, so large assets can be parsed straight
+// from the mapping without first copying them into a std::string. Parsers
+// must not rely on a terminating '\0' - use GetSize().
+// ============================================================================
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string& path) { Open(path); }
+    ~MappedFile() { Close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const std::string& path);
+    void Close();
+
+    bool IsOpen() const { return m_Data != nullptr; }
+    const char* GetData() const { return m_Data; }
+    size_t GetSize() const { return m_Size; }
+
+private:
+    const char* m_Data = nullptr;
+    size_t m_Size = 0;
+
+#ifdef _WIN32
+    void* m_File = nullptr;
+    void* m_Mapping = nullptr;
+#endif
+};
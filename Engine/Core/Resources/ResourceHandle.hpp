@@ -0,0 +1,179 @@
+#pragma once
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ============================================================================
+// ResourceHandle - generational index into a ResourcePool slot array
+// ============================================================================
+// Index picks the slot, Generation must match the slot's current generation.
+// Unloading (or ResourceManager::Clear) bumps the slot's generation, so old
+// handles go stale instead of silently pointing at whatever reuses the slot.
+// T only keeps handles of different resource types apart.
+// ============================================================================
+enum class ResourceState : uint8_t
+{
+    Invalid = 0,   // Stale or default handle
+    Loading,       // Queued or in flight - Get returns the placeholder
+    Ready,
+    Failed         // Get keeps returning the placeholder
+};
+
+template<typename T>
+struct ResourceHandle
+{
+    static constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+    uint32_t Index = InvalidIndex;
+    uint32_t Generation = 0;
+
+    bool IsValid() const { return Index != InvalidIndex; }
+
+    bool operator==(const ResourceHandle& other) const { return Index == other.Index && Generation == other.Generation; }
+    bool operator!=(const ResourceHandle& other) const { return !(*this == other); }
+};
+
+// Named slots for one resource type. Main thread only - loaders hand their
+// results back through AsyncLoader uploads, which run on the main thread.
+template<typename T>
+class ResourcePool
+{
+public:
+    using Handle = ResourceHandle<T>;
+    using Future = std::shared_future<std::shared_ptr<T>>;
+
+    // New slot in the Loading state, registered under `name`
+    Handle Allocate(const std::string& name)
+    {
+        uint32_t index;
+        if (!m_FreeSlots.empty())
+        {
+            index = m_FreeSlots.back();
+            m_FreeSlots.pop_back();
+        }
+        else
+        {
+            index = (uint32_t)m_Slots.size();
+            m_Slots.emplace_back();
+        }
+
+        Slot& slot = m_Slots[index];
+        slot.Name = name;
+        slot.State = ResourceState::Loading;
+        slot.Promise = std::make_shared<std::promise<std::shared_ptr<T>>>();
+        slot.Future = slot.Promise->get_future().share();
+
+        Handle handle{ index, slot.Generation };
+        m_Names.emplace(name, handle);
+        return handle;
+    }
+
+    // Ready with a resource, Failed with nullptr. Ignored for stale handles.
+    void Finish(Handle handle, const std::shared_ptr<T>& resource)
+    {
+        Slot* slot = GetSlot(handle);
+        if (!slot || !slot->Promise) return;
+
+        slot->Resource = resource;
+        slot->State = resource ? ResourceState::Ready : ResourceState::Failed;
+        slot->Promise->set_value(resource);
+        slot->Promise.reset();
+    }
+
+    // Hot reload: a new resource for a live slot. Handles resolve to it from
+    // the next Get on; shared_ptrs taken before keep the old one.
+    void Replace(Handle handle, const std::shared_ptr<T>& resource)
+    {
+        Slot* slot = GetSlot(handle);
+        if (!slot || !resource) return;
+        if (slot->Promise)
+        {
+            Finish(handle, resource);
+            return;
+        }
+        slot->Resource = resource;
+        slot->State = ResourceState::Ready;
+    }
+
+    void Unload(Handle handle)
+    {
+        Slot* slot = GetSlot(handle);
+        if (!slot) return;
+
+        if (slot->Promise) slot->Promise->set_value(nullptr); // Nobody waits forever
+        m_Names.erase(slot->Name);
+
+        uint32_t generation = slot->Generation + 1;
+        *slot = Slot();
+        slot->Generation = generation;
+        m_FreeSlots.push_back(handle.Index);
+    }
+
+    // Keeps the slots (with bumped generations) so outstanding handles go stale
+    void Clear()
+    {
+        for (uint32_t i = 0; i < (uint32_t)m_Slots.size(); i++)
+        {
+            if (m_Slots[i].State != ResourceState::Invalid)
+                Unload({ i, m_Slots[i].Generation });
+        }
+    }
+
+    // Invalid handle if the name is unknown
+    Handle Find(const std::string& name) const
+    {
+        auto it = m_Names.find(name);
+        return it != m_Names.end() ? it->second : Handle();
+    }
+
+    bool IsCurrent(Handle handle) const { return GetSlot(handle) != nullptr; }
+
+    ResourceState GetState(Handle handle) const
+    {
+        const Slot* slot = GetSlot(handle);
+        return slot ? slot->State : ResourceState::Invalid;
+    }
+
+    // nullptr unless Ready
+    std::shared_ptr<T> Get(Handle handle) const
+    {
+        const Slot* slot = GetSlot(handle);
+        return slot ? slot->Resource : nullptr;
+    }
+
+    Future GetFuture(Handle handle) const
+    {
+        const Slot* slot = GetSlot(handle);
+        return slot ? slot->Future : Future();
+    }
+
+private:
+    struct Slot
+    {
+        std::string Name;
+        std::shared_ptr<T> Resource;
+        ResourceState State = ResourceState::Invalid;
+        uint32_t Generation = 1;
+        std::shared_ptr<std::promise<std::shared_ptr<T>>> Promise;
+        std::shared_future<std::shared_ptr<T>> Future;
+    };
+
+    const Slot* GetSlot(Handle handle) const
+    {
+        if (handle.Index >= m_Slots.size()) return nullptr;
+        const Slot& slot = m_Slots[handle.Index];
+        return slot.Generation == handle.Generation && slot.State != ResourceState::Invalid ? &slot : nullptr;
+    }
+
+    Slot* GetSlot(Handle handle)
+    {
+        return const_cast<Slot*>(static_cast<const ResourcePool*>(this)->GetSlot(handle));
+    }
+
+    std::unordered_map<std::string, Handle> m_Names;
+    std::vector<Slot> m_Slots;
+    std::vector<uint32_t> m_FreeSlots;
+};
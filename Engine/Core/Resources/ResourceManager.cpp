@@ -1,17 +1,249 @@
 #include "ResourceManager.hpp"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <mutex>
+#include <sstream>
+#include <unordered_set>
+#include <Core/Hash.hpp>
 #include <Core/Log.hpp>
+#include <Core/Resources/AsyncLoader.hpp>
+#include <Core/Resources/MappedFile.hpp>
+#include <Rendering/CookedTexture.hpp>
+#include <Rendering/Image.hpp>
+#include <Rendering/TextureStreamer.hpp>
+#include <Rendering/Mesh/CookedMesh.hpp>
+#include <Rendering/Mesh/ObjImporter.hpp>
 
 // Define static storage
 std::unordered_map<std::string, std::shared_ptr<Shader>> ResourceManager::s_Shaders;
-std::unordered_map<std::string, std::shared_ptr<Texture2D>> ResourceManager::s_Textures;
+ResourcePool<Texture2D> ResourceManager::s_Textures;
+ResourcePool<Mesh> ResourceManager::s_Models;
+std::shared_ptr<Mesh> ResourceManager::s_PlaceholderModel;
+std::shared_ptr<Texture2D> ResourceManager::s_PlaceholderTexture;
+
+namespace
+{
+    // Hot reload: source file of every named resource, lexically normalized
+    struct ModelParams
+    {
+        std::string Path;
+        VertexFormat Format;
+        uint32_t LODLevels;
+    };
+    std::unordered_map<std::string, std::string> s_ShaderPaths;
+    std::unordered_map<std::string, std::string> s_TexturePaths;
+    std::unordered_map<std::string, ModelParams> s_ModelPaths;
+
+    std::string NormalizePath(const std::string& path)
+    {
+        return std::filesystem::path(path).lexically_normal().generic_string();
+    }
+
+    double MsSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Splits "#type vertex" / "#type fragment" sections; false unless both are present
+    bool ReadShaderFile(const std::string& path, std::string& vertexSource, std::string& fragmentSource)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) return false;
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        const std::string text = buffer.str();
+
+        static const std::string s_Token = "#type";
+        vertexSource.clear();
+        fragmentSource.clear();
+        for (size_t position = text.find(s_Token); position != std::string::npos;)
+        {
+            size_t lineEnd = text.find_first_of("\r\n", position);
+            if (lineEnd == std::string::npos) break;
+
+            std::string type = text.substr(position + s_Token.size(), lineEnd - position - s_Token.size());
+            type.erase(0, type.find_first_not_of(" \t"));
+            type.erase(type.find_last_not_of(" \t") + 1);
+
+            size_t begin = text.find_first_not_of("\r\n", lineEnd);
+            position = begin == std::string::npos ? begin : text.find(s_Token, begin);
+            std::string source = begin == std::string::npos ? std::string() : text.substr(begin, position - begin);
+
+            if (type == "vertex") vertexSource = std::move(source);
+            else if (type == "fragment" || type == "pixel") fragmentSource = std::move(source);
+            else CORE_WARN("ResourceManager: Unknown shader section '#type {0}' in '{1}'", type, path);
+        }
+        return !vertexSource.empty() && !fragmentSource.empty();
+    }
+
+    // CPU half of a model load - no GL, safe on a worker thread
+    struct ModelSource
+    {
+        std::string CookedPath;           // Upload from this file when set
+        CookedMesh::Data Cooked;          // Otherwise the cooked levels in memory (file not writable)
+    };
+
+    bool IsCookedPath(const std::string& path)
+    {
+        return path.size() >= 6 && path.compare(path.size() - 6, 6, CookedMesh::Extension) == 0;
+    }
+
+    // .cmesh loads directly. Source models are cooked next to themselves, one
+    // file per format / LOD count (CookedMesh::GetCookedPath), on first use
+    // and loaded from there afterwards.
+    void PrepareModel(const std::string& path, VertexFormat format, uint32_t lodLevels, ModelSource& source)
+    {
+        if (IsCookedPath(path)) {
+            source.CookedPath = path;
+            return;
+        }
+
+        std::string cookedPath = CookedMesh::GetCookedPath(path, format, lodLevels);
+        // A cooked file that fails Load()'s checks is stale too - recook instead of failing the load
+        if (!CookedMesh::IsUpToDate(cookedPath, path, format, lodLevels) || !CookedMesh::Verify(cookedPath)) {
+            std::vector<Vertex> vertices;
+            std::vector<uint32_t> indices;
+            ObjImporter::Stats imported;
+            if (!ObjImporter::Load(path, vertices, indices, &imported))
+                return;
+            CORE_INFO("ResourceManager: Imported '{0}' at {1} MB/s ({2} ms)", path, imported.GetMBPerSecond(), imported.TotalMs);
+            // Optimize, LODs and encode happen here either way - the main thread only uploads
+            if (!CookedMesh::Build(vertices, indices, format, lodLevels, source.Cooked, imported.TotalMs))
+                return;
+            if (!CookedMesh::Write(cookedPath, source.Cooked))
+                return; // Read-only location - upload the built levels from memory
+            source.Cooked = {};
+        }
+        source.CookedPath = cookedPath;
+    }
+
+    // Touch every page so the main thread's mapping does not fault to disk
+    void PrefetchFile(const std::string& path)
+    {
+        MappedFile file(path);
+        char sum = 0;
+        for (size_t offset = 0; offset < file.GetSize(); offset += 4096)
+            sum += file.GetData()[offset];
+        volatile char sink = sum;
+        (void)sink;
+    }
+
+    // GL half - main thread
+    std::shared_ptr<Mesh> UploadModel(const std::string& name, ModelSource& source)
+    {
+        if (source.CookedPath.empty())
+            return CookedMesh::Upload(source.Cooked);
+
+        CookedMesh::Stats cooked;
+        std::shared_ptr<Mesh> mesh = CookedMesh::Load(source.CookedPath, &cooked);
+        if (mesh && cooked.Ms > 0.0)
+            CORE_INFO("ResourceManager: Model '{0}' cooked load {1} ms ({2} MB/s) vs {3} ms import + cook",
+                      name, cooked.Ms, cooked.GetMBPerSecond(), cooked.ImportMs);
+        return mesh;
+    }
+
+    // CPU half of a texture load
+    struct TextureSource
+    {
+        uint64_t Hash = 0;
+        bool Read = false;
+        std::string CookedPath;           // Streamed from here when set
+        Image Pixels;                     // Empty if the hash was already known
+    };
+
+    // Hashes of every texture created so far - lets workers skip decoding
+    // duplicates. May hold expired entries; the upload re-checks on the main
+    // thread and decodes there in that (rare) case.
+    std::mutex s_KnownHashMutex;
+    std::unordered_set<uint64_t> s_KnownHashes;
+
+    // Main thread only - weak, so the cache never keeps a texture alive
+    std::unordered_map<uint64_t, std::weak_ptr<Texture2D>> s_TextureHashes;
+
+    bool IsKnownHash(uint64_t hash)
+    {
+        std::lock_guard<std::mutex> lock(s_KnownHashMutex);
+        return s_KnownHashes.count(hash) != 0;
+    }
+
+    void PrepareTexture(const std::string& path, TextureSource& source, bool skipKnown)
+    {
+        MappedFile file(path);
+        if (!file.IsOpen()) {
+            CORE_ERROR("ResourceManager: Cannot open texture '{0}'", path);
+            return;
+        }
+
+        source.Read = true;
+        source.Hash = Hash::Fnv1a64(file.GetData(), file.GetSize());
+        if (skipKnown && IsKnownHash(source.Hash)) return;
+
+        // .ctex loads directly. With cooking enabled, source images are cooked
+        // next to themselves (<path>.ctex) on first use and loaded from there.
+        std::string cookedPath;
+        if (CookedTexture::IsCookedPath(path)) {
+            cookedPath = path;
+        }
+        else if (CookedTexture::GetSettings().Enabled) {
+            cookedPath = path + CookedTexture::Extension;
+            if (!CookedTexture::IsUpToDate(cookedPath, path) && !CookedTexture::Cook(cookedPath, path))
+                cookedPath.clear(); // Read-only location - load uncompressed
+        }
+
+        if (!cookedPath.empty() && CookedTexture::Load(cookedPath, source.Pixels)) {
+            source.CookedPath = cookedPath;
+            return;
+        }
+
+        if (!ImageLoader::Load(file.GetData(), file.GetSize(), source.Pixels))
+            CORE_ERROR("ResourceManager: '{0}' is not a supported image", path);
+    }
+
+    // Content-hash cache lookup, else upload of the decoded pixels - main thread
+    std::shared_ptr<Texture2D> ResolveTexture(const std::string& name, const std::string& path, TextureSource& source)
+    {
+        if (!source.Read) return nullptr;
+
+        auto it = s_TextureHashes.find(source.Hash);
+        if (it != s_TextureHashes.end()) {
+            if (std::shared_ptr<Texture2D> shared = it->second.lock()) {
+                CORE_INFO("ResourceManager: Texture '{0}' has the same content as a loaded one - sharing it ({1} KB saved)",
+                          name, shared->GetMemorySize() / 1024);
+                return shared;
+            }
+        }
+
+        if (!source.Pixels.IsValid())
+            PrepareTexture(path, source, false); // Known hash, but that texture is gone
+
+        // Streamed textures start at their tail mip and sharpen on request
+        const Image& pixels = source.Pixels;
+        std::shared_ptr<Texture2D> texture = Texture2D::Create(pixels, TextureStreamer::GetInitialMip(pixels.GetWidth(), pixels.GetHeight()));
+        if (!texture) return nullptr;
+        TextureStreamer::Register(texture, source.CookedPath.empty() ? path : source.CookedPath);
+
+        s_TextureHashes[source.Hash] = texture;
+        {
+            std::lock_guard<std::mutex> lock(s_KnownHashMutex);
+            s_KnownHashes.insert(source.Hash);
+        }
+
+        CORE_INFO("ResourceManager: Loaded Texture '{0}' ({1}x{2} {3}, {4} mips, {5} KB)", name,
+                  texture->GetWidth(), texture->GetHeight(), Image::GetFormatName(texture->GetFormat()),
+                  texture->GetMipCount(), texture->GetMemorySize() / 1024);
+        return texture;
+    }
+}
 
 std::shared_ptr<Shader> ResourceManager::LoadShader(const std::string& name, const std::string& vertexSource, const std::string& fragmentSource)
 {
     // Check if exists
-    if (s_Shaders.find(name) != s_Shaders.end()) {
+    auto it = s_Shaders.find(name);
+    if (it != s_Shaders.end()) {
         CORE_WARN("ResourceManager: Shader '{0}' already exists! Returning cached.", name);
-        return s_Shaders[name];
+        return it->second;
     }
 
     // Load (Create shader from strings for now, or file if extended)
@@ -20,49 +252,330 @@ std::shared_ptr<Shader> ResourceManager::LoadShader(const std::string& name, con
     // For now, mirroring current Shader constructor which takes strings.
     
     std::shared_ptr<Shader> shader = std::make_shared<Shader>(vertexSource, fragmentSource);
-    s_Shaders[name] = shader;
+    s_Shaders.emplace(name, shader);
     
     CORE_INFO("ResourceManager: Loaded Shader '{0}'", name);
     return shader;
 }
 
+std::shared_ptr<Shader> ResourceManager::LoadShaderFromFile(const std::string& name, const std::string& path)
+{
+    auto it = s_Shaders.find(name);
+    if (it != s_Shaders.end()) {
+        CORE_WARN("ResourceManager: Shader '{0}' already exists! Returning cached.", name);
+        return it->second;
+    }
+
+    std::string vertexSource, fragmentSource;
+    if (!ReadShaderFile(path, vertexSource, fragmentSource)) {
+        CORE_ERROR("ResourceManager: '{0}' is missing or lacks '#type vertex' / '#type fragment' sections", path);
+        return nullptr;
+    }
+
+    // Registered even if it does not compile - fixing the file reloads it
+    std::shared_ptr<Shader> shader = LoadShader(name, vertexSource, fragmentSource);
+    s_ShaderPaths[name] = NormalizePath(path);
+    return shader;
+}
+
 std::shared_ptr<Shader> ResourceManager::GetShader(const std::string& name)
 {
-    if (s_Shaders.find(name) == s_Shaders.end()) {
+    auto it = s_Shaders.find(name);
+    if (it == s_Shaders.end()) {
         CORE_ERROR("ResourceManager: Shader '{0}' not found!", name);
         return nullptr;
     }
-    return s_Shaders[name];
+    return it->second;
 }
 
 std::shared_ptr<Texture2D> ResourceManager::LoadTexture(const std::string& name, const std::string& path)
 {
-    if (s_Textures.find(name) != s_Textures.end()) {
+    TextureHandle existing = s_Textures.Find(name);
+    if (existing.IsValid()) {
         CORE_WARN("ResourceManager: Texture '{0}' already exists! Returning cached.", name);
-        return s_Textures[name];
+        return GetTexture(existing);
     }
 
-    // Backbone implementation: Logic would go here
-    // std::shared_ptr<Texture2D> texture = Texture2D::Create(path);
-    // s_Textures[name] = texture;
-    
-    CORE_INFO("ResourceManager: Loaded Texture '{0}' (Backbone: Simulated)", name);
-    
-    // Return empty for now as requested (stub)
-    return nullptr; 
+    TextureSource source;
+    PrepareTexture(path, source, true);
+    std::shared_ptr<Texture2D> texture = ResolveTexture(name, path, source);
+
+    if (!texture) {
+        CORE_ERROR("ResourceManager: Failed to load Texture '{0}' from '{1}'", name, path);
+        return nullptr;
+    }
+
+    s_Textures.Finish(s_Textures.Allocate(name), texture);
+    s_TexturePaths[name] = NormalizePath(path);
+    return texture;
 }
 
 std::shared_ptr<Texture2D> ResourceManager::GetTexture(const std::string& name)
 {
-    if (s_Textures.find(name) == s_Textures.end()) {
+    TextureHandle handle = s_Textures.Find(name);
+    if (!handle.IsValid()) {
         CORE_ERROR("ResourceManager: Texture '{0}' not found!", name);
         return nullptr;
     }
-    return s_Textures[name];
+    return GetTexture(handle);
+}
+
+TextureHandle ResourceManager::LoadTextureAsync(const std::string& name, const std::string& path)
+{
+    TextureHandle existing = s_Textures.Find(name);
+    if (existing.IsValid())
+        return existing;
+
+    TextureHandle handle = s_Textures.Allocate(name);
+    s_TexturePaths[name] = NormalizePath(path);
+
+    auto source = std::make_shared<TextureSource>();
+    AsyncLoader::Submit(
+        [source, path]() { PrepareTexture(path, *source, true); },
+        [source, handle, name, path]()
+        {
+            if (!s_Textures.IsCurrent(handle)) return; // Unloaded or cleared meanwhile
+
+            std::shared_ptr<Texture2D> texture = ResolveTexture(name, path, *source);
+            if (!texture)
+                CORE_ERROR("ResourceManager: Failed to load Texture '{0}' from '{1}'", name, path);
+            s_Textures.Finish(handle, texture);
+        });
+
+    return handle;
+}
+
+std::shared_ptr<Texture2D> ResourceManager::GetTexture(TextureHandle handle)
+{
+    if (!s_Textures.IsCurrent(handle)) return nullptr;
+    std::shared_ptr<Texture2D> texture = s_Textures.Get(handle);
+    return texture ? texture : GetPlaceholderTexture();
+}
+
+ResourceState ResourceManager::GetState(TextureHandle handle)
+{
+    return s_Textures.GetState(handle);
+}
+
+std::shared_future<std::shared_ptr<Texture2D>> ResourceManager::GetTextureFuture(TextureHandle handle)
+{
+    return s_Textures.GetFuture(handle);
+}
+
+void ResourceManager::UnloadTexture(TextureHandle handle)
+{
+    s_Textures.Unload(handle);
+}
+
+const std::shared_ptr<Texture2D>& ResourceManager::GetPlaceholderTexture()
+{
+    if (!s_PlaceholderTexture) {
+        Image white;
+        white.Levels.resize(1);
+        white.Levels[0].Width = 1;
+        white.Levels[0].Height = 1;
+        white.Levels[0].Pixels.assign(4, 255);
+        s_PlaceholderTexture = Texture2D::Create(white);
+    }
+    return s_PlaceholderTexture;
+}
+
+std::shared_ptr<Mesh> ResourceManager::LoadModel(const std::string& name, const std::string& path,
+                                                 VertexFormat format, uint32_t lodLevels)
+{
+    ModelHandle existing = s_Models.Find(name);
+    if (existing.IsValid()) {
+        CORE_WARN("ResourceManager: Model '{0}' already exists! Returning cached.", name);
+        return GetModel(existing);
+    }
+
+    ModelSource source;
+    PrepareModel(path, format, lodLevels, source);
+    std::shared_ptr<Mesh> mesh = UploadModel(name, source);
+
+    if (!mesh || !mesh->IsValid()) {
+        CORE_ERROR("ResourceManager: Failed to load Model '{0}' from '{1}'", name, path);
+        return nullptr;
+    }
+
+    s_Models.Finish(s_Models.Allocate(name), mesh);
+    s_ModelPaths[name] = { NormalizePath(path), format, lodLevels };
+    CORE_INFO("ResourceManager: Loaded Model '{0}'", name);
+    return mesh;
+}
+
+std::shared_ptr<Mesh> ResourceManager::GetModel(const std::string& name)
+{
+    ModelHandle handle = s_Models.Find(name);
+    if (!handle.IsValid()) {
+        CORE_ERROR("ResourceManager: Model '{0}' not found!", name);
+        return nullptr;
+    }
+    return GetModel(handle);
+}
+
+ModelHandle ResourceManager::LoadModelAsync(const std::string& name, const std::string& path,
+                                            VertexFormat format, uint32_t lodLevels)
+{
+    ModelHandle existing = s_Models.Find(name);
+    if (existing.IsValid())
+        return existing;
+
+    ModelHandle handle = s_Models.Allocate(name);
+    s_ModelPaths[name] = { NormalizePath(path), format, lodLevels };
+
+    // Shared between the worker (fills it) and the upload (consumes it)
+    auto source = std::make_shared<ModelSource>();
+    AsyncLoader::Submit(
+        [source, path, format, lodLevels]()
+        {
+            PrepareModel(path, format, lodLevels, *source);
+            if (!source->CookedPath.empty())
+                PrefetchFile(source->CookedPath);
+        },
+        [source, handle, name, path]()
+        {
+            if (!s_Models.IsCurrent(handle)) return; // Unloaded or cleared meanwhile
+
+            std::shared_ptr<Mesh> mesh = UploadModel(name, *source);
+            if (!mesh || !mesh->IsValid()) {
+                CORE_ERROR("ResourceManager: Failed to load Model '{0}' from '{1}'", name, path);
+                mesh = nullptr;
+            }
+            s_Models.Finish(handle, mesh);
+        });
+
+    return handle;
+}
+
+std::shared_ptr<Mesh> ResourceManager::GetModel(ModelHandle handle)
+{
+    if (!s_Models.IsCurrent(handle)) return nullptr;
+    std::shared_ptr<Mesh> mesh = s_Models.Get(handle);
+    return mesh ? mesh : GetPlaceholderModel();
+}
+
+ResourceState ResourceManager::GetState(ModelHandle handle)
+{
+    return s_Models.GetState(handle);
+}
+
+std::shared_future<std::shared_ptr<Mesh>> ResourceManager::GetModelFuture(ModelHandle handle)
+{
+    return s_Models.GetFuture(handle);
+}
+
+void ResourceManager::UnloadModel(ModelHandle handle)
+{
+    s_Models.Unload(handle);
+}
+
+const std::shared_ptr<Mesh>& ResourceManager::GetPlaceholderModel()
+{
+    if (!s_PlaceholderModel)
+        s_PlaceholderModel = Mesh::CreateCube();
+    return s_PlaceholderModel;
+}
+
+void ResourceManager::Update(double uploadBudgetMs)
+{
+    TextureStreamer::Update();
+    AsyncLoader::Update(uploadBudgetMs);
+}
+
+uint32_t ResourceManager::Reload(const std::string& path)
+{
+    const std::string normalized = NormalizePath(path);
+    uint32_t count = 0;
+
+    for (const auto& entry : s_ShaderPaths) {
+        auto it = s_Shaders.find(entry.first);
+        if (entry.second != normalized || it == s_Shaders.end()) continue;
+
+        auto start = std::chrono::steady_clock::now();
+        std::string vertexSource, fragmentSource;
+        if (ReadShaderFile(entry.second, vertexSource, fragmentSource) && it->second->Reload(vertexSource, fragmentSource))
+            CORE_INFO("ResourceManager: Reloaded Shader '{0}' in {1} ms", entry.first, MsSince(start));
+        else
+            CORE_ERROR("ResourceManager: Reload of Shader '{0}' failed - keeping the previous program", entry.first);
+        count++;
+    }
+
+    for (const auto& entry : s_TexturePaths) {
+        TextureHandle handle = s_Textures.Find(entry.first);
+        if (entry.second != normalized || !handle.IsValid()) continue;
+
+        auto source = std::make_shared<TextureSource>();
+        AsyncLoader::Submit(
+            [source, path = entry.second]() { PrepareTexture(path, *source, false); },
+            [source, handle, name = entry.first, path = entry.second]()
+            {
+                if (!s_Textures.IsCurrent(handle)) return;
+
+                std::shared_ptr<Texture2D> texture = ResolveTexture(name, path, *source);
+                if (!texture) {
+                    CORE_ERROR("ResourceManager: Reload of Texture '{0}' failed - keeping the previous version", name);
+                    return;
+                }
+                s_Textures.Replace(handle, texture);
+            });
+        count++;
+    }
+
+    for (const auto& entry : s_ModelPaths) {
+        ModelHandle handle = s_Models.Find(entry.first);
+        if (entry.second.Path != normalized || !handle.IsValid()) continue;
+
+        auto source = std::make_shared<ModelSource>();
+        const ModelParams params = entry.second;
+        AsyncLoader::Submit(
+            [source, params]()
+            {
+                PrepareModel(params.Path, params.Format, params.LODLevels, *source);
+                if (!source->CookedPath.empty())
+                    PrefetchFile(source->CookedPath);
+            },
+            [source, handle, name = entry.first]()
+            {
+                if (!s_Models.IsCurrent(handle)) return;
+
+                std::shared_ptr<Mesh> mesh = UploadModel(name, *source);
+                if (!mesh || !mesh->IsValid()) {
+                    CORE_ERROR("ResourceManager: Reload of Model '{0}' failed - keeping the previous version", name);
+                    return;
+                }
+
+                // In place: entities hold the mesh itself, not the handle
+                if (std::shared_ptr<Mesh> current = s_Models.Get(handle))
+                    current->Swap(*mesh);
+                else
+                    s_Models.Replace(handle, mesh);
+                CORE_INFO("ResourceManager: Reloaded Model '{0}'", name);
+            });
+        count++;
+    }
+
+    return count;
 }
 
 void ResourceManager::Clear()
 {
+    // Workers first - nothing may upload into slots that are going away
+    AsyncLoader::Shutdown();
+    TextureStreamer::Clear();
+
     s_Shaders.clear();
-    s_Textures.clear();
+    s_Textures.Clear();
+    s_Models.Clear();
+    s_ShaderPaths.clear();
+    s_TexturePaths.clear();
+    s_ModelPaths.clear();
+
+    s_TextureHashes.clear();
+    {
+        std::lock_guard<std::mutex> lock(s_KnownHashMutex);
+        s_KnownHashes.clear();
+    }
+    s_PlaceholderModel.reset();
+    s_PlaceholderTexture.reset();
 }
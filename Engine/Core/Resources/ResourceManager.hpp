@@ -3,8 +3,12 @@
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <future>
+#include <vector>
+#include <Core/Resources/ResourceHandle.hpp>
 #include <Rendering/Shaders/Shader.hpp>
 #include <Rendering/Texture.hpp>
+#include <Rendering/Mesh/Mesh.hpp>
 
 /**
  * ============================================================================
@@ -20,24 +24,69 @@
  * - Centralized asset access
  * 
  * Usage:
- * auto shader = ResourceManager::LoadShader("FlatColor", "assets/shaders/flat.glsl");
- * auto texture = ResourceManager::LoadTexture("Wood", "assets/textures/wood.png");
+ * auto shader = ResourceManager::LoadShaderFromFile("FlatColor", "assets/shaders/flat.glsl");
+ * auto texture = ResourceManager::LoadTexture("Wood", "assets/textures/wood.tga");
+ * auto model = ResourceManager::LoadModel("Player", "assets/models/player.obj");
+ * 
+ * Async loads: LoadModelAsync / LoadTextureAsync return a handle immediately.
+ * Import, cooking and decoding run on AsyncLoader workers, the GPU upload
+ * happens in Update() (once per frame, time-budgeted). Until then the handle
+ * resolves to a placeholder, so nothing ever waits on a load.
  * 
  * ============================================================================
  */
 
+using ModelHandle = ResourceHandle<Mesh>;
+using TextureHandle = ResourceHandle<Texture2D>;
+
 class ResourceManager {
 public:
     // Shaders
     static std::shared_ptr<Shader> LoadShader(const std::string& name, const std::string& vertexSource, const std::string& fragmentSource);
+    // One GLSL file with "#type vertex" and "#type fragment" sections. nullptr if
+    // the file is missing or lacks a section; the path is kept for Reload().
+    static std::shared_ptr<Shader> LoadShaderFromFile(const std::string& name, const std::string& path);
     static std::shared_ptr<Shader> GetShader(const std::string& name);
 
-    // Textures (Backbone ready)
+    // Textures (ImageLoader + Texture2D). Files with identical bytes share one
+    // GPU texture, whatever their name or path. Source images are cooked to a
+    // block-compressed <path>.ctex on first load (CookedTexture::Settings).
     static std::shared_ptr<Texture2D> LoadTexture(const std::string& name, const std::string& path);
     static std::shared_ptr<Texture2D> GetTexture(const std::string& name);
 
-    // Models (Backbone ready - to be implemented)
-    // static std::shared_ptr<Model> LoadModel(const std::string& name, const std::string& path);
+    // Async textures: decode, mips and cooking on a worker, upload in Update()
+    static TextureHandle LoadTextureAsync(const std::string& name, const std::string& path);
+    // 1x1 white placeholder while loading or failed, nullptr for stale handles
+    static std::shared_ptr<Texture2D> GetTexture(TextureHandle handle);
+    static ResourceState GetState(TextureHandle handle);
+    static std::shared_future<std::shared_ptr<Texture2D>> GetTextureFuture(TextureHandle handle);
+    static void UnloadTexture(TextureHandle handle);
+
+    // Models (.obj via ObjImporter, cooked to <path>.<format>.lod<N>.cmesh on first load; or .cmesh directly)
+    static std::shared_ptr<Mesh> LoadModel(const std::string& name, const std::string& path,
+                                           VertexFormat format = Mesh::DefaultFormat, uint32_t lodLevels = 0);
+    static std::shared_ptr<Mesh> GetModel(const std::string& name);
+
+    // Async models (same caching and cooking as LoadModel). Loading the same
+    // name again returns the existing handle.
+    static ModelHandle LoadModelAsync(const std::string& name, const std::string& path,
+                                      VertexFormat format = Mesh::DefaultFormat, uint32_t lodLevels = 0);
+    // Placeholder cube while loading or failed, nullptr for stale handles
+    static std::shared_ptr<Mesh> GetModel(ModelHandle handle);
+    static ResourceState GetState(ModelHandle handle);
+    // Becomes ready on the main thread, in Update() - poll it there, block on it elsewhere
+    static std::shared_future<std::shared_ptr<Mesh>> GetModelFuture(ModelHandle handle);
+    static void UnloadModel(ModelHandle handle);
+
+    // Main thread, once per frame: runs finished uploads within the budget
+    static void Update(double uploadBudgetMs = 2.0);
+
+    // Hot reload of everything loaded from `path`. Shaders recompile in place
+    // right away (a failed compile keeps the old program). Textures and models
+    // reload on a worker and swap in Update(): a model in place, so every
+    // holder sees it; a texture in its slot, so handles see it. Returns the
+    // number of resources reloaded or queued.
+    static uint32_t Reload(const std::string& path);
 
     static void Clear();
 
@@ -45,11 +94,17 @@ private:
     // Private constructor (Static class)
     ResourceManager() {}
 
-    // Methods to actually load from file
-    static std::shared_ptr<Shader> LoadShaderFromFile(const std::string& vShaderFile, const std::string& fShaderFile);
-    static std::shared_ptr<Texture2D> LoadTextureFromFile(const std::string& file);
+    static const std::shared_ptr<Mesh>& GetPlaceholderModel();
+    static const std::shared_ptr<Texture2D>& GetPlaceholderTexture();
+
 
     // Storage Cache
     static std::unordered_map<std::string, std::shared_ptr<Shader>> s_Shaders;
-    static std::unordered_map<std::string, std::shared_ptr<Texture2D>> s_Textures;
+
+    // Textures and models live in generational slots; names map to handles
+    static ResourcePool<Texture2D> s_Textures;
+    static ResourcePool<Mesh> s_Models;
+
+    static std::shared_ptr<Mesh> s_PlaceholderModel;
+    static std::shared_ptr<Texture2D> s_PlaceholderTexture;
 };
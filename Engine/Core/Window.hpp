@@ -9,6 +9,8 @@ struct WindowProps
     std::string Title;
     uint32_t Width;
     uint32_t Height;
+    bool Visible = true; // false = headless (hidden window, GL context still valid)
+    bool VSync = true;
 
     WindowProps(const std::string& title = "Groove Engine Pre builds",
         uint32_t width = 1280,
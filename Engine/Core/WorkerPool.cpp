@@ -0,0 +1,92 @@
+#include "WorkerPool.hpp"
+#include <algorithm>
+
+WorkerPool::WorkerPool(uint32_t threadCount)
+{
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    m_Threads.reserve(threadCount - 1);
+    for (uint32_t i = 1; i < threadCount; i++)
+        m_Threads.emplace_back([this]() { WorkerLoop(); });
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stop = true;
+    }
+    m_Wake.notify_all();
+
+    for (std::thread& thread : m_Threads)
+        thread.join();
+}
+
+void WorkerPool::Run(uint32_t count, const Task& task)
+{
+    if (count == 0) return;
+    if (m_Threads.empty() || count == 1)
+    {
+        for (uint32_t i = 0; i < count; i++)
+            task(i);
+        return;
+    }
+
+    {
+        // A worker that woke too late for the previous Run() may still be on its way out
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Done.wait(lock, [this]() { return m_Active == 0; });
+
+        m_Task = &task;
+        m_Count = count;
+        m_Next.store(0, std::memory_order_relaxed);
+        m_Pending = count;
+        m_Generation++;
+    }
+    m_Wake.notify_all();
+
+    uint32_t ran = Execute();
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_Pending -= ran;
+    m_Done.wait(lock, [this]() { return m_Pending == 0 && m_Active == 0; });
+    m_Task = nullptr;
+    m_Count = 0;
+}
+
+void WorkerPool::WorkerLoop()
+{
+    uint64_t seen = 0;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_Wake.wait(lock, [&]() { return m_Stop || m_Generation != seen; });
+            if (m_Stop) return;
+            seen = m_Generation;
+            m_Active++;
+        }
+
+        uint32_t ran = Execute();
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Pending -= ran;
+            m_Active--;
+        }
+        m_Done.notify_all();
+    }
+}
+
+uint32_t WorkerPool::Execute()
+{
+    uint32_t ran = 0;
+    for (uint32_t i = m_Next.fetch_add(1, std::memory_order_relaxed); i < m_Count;
+         i = m_Next.fetch_add(1, std::memory_order_relaxed))
+    {
+        (*m_Task)(i);
+        ran++;
+    }
+    return ran;
+}
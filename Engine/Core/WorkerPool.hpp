@@ -0,0 +1,55 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// WorkerPool - persistent threads for blocking parallel-for work
+// ============================================================================
+// Threads are created once and sleep between calls, so per-frame work (a
+// level of transform propagation, ...) pays a wake-up instead of a thread
+// creation. Run() hands out task indices to the workers and the calling
+// thread alike and returns when every task has finished.
+//
+// Not for IO or long jobs - AsyncLoader owns those. One Run() at a time.
+// ============================================================================
+class WorkerPool
+{
+public:
+    using Task = std::function<void(uint32_t)>;
+
+    // threadCount includes the calling thread; 0 = all cores
+    explicit WorkerPool(uint32_t threadCount = 0);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    uint32_t GetThreadCount() const { return (uint32_t)m_Threads.size() + 1; }
+
+    // task(i) for every i in [0, count); blocks until all have run
+    void Run(uint32_t count, const Task& task);
+
+private:
+    void WorkerLoop();
+    // Claims and runs indices until none are left; returns how many it ran
+    uint32_t Execute();
+
+    std::vector<std::thread> m_Threads;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_Wake;
+    std::condition_variable m_Done;
+    uint64_t m_Generation = 0;     // Bumped by every Run()
+    uint32_t m_Active = 0;         // Workers inside Execute()
+    uint32_t m_Pending = 0;        // Tasks of the current Run() not finished yet
+    bool m_Stop = false;
+
+    const Task* m_Task = nullptr;
+    uint32_t m_Count = 0;
+    std::atomic<uint32_t> m_Next{ 0 };
+};
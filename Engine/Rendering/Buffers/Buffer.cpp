@@ -1,26 +1,28 @@
 #include "Buffer.hpp"
 #include <glad/glad.h>
+#include <Rendering/GLState.hpp>
 
 VertexBuffer::VertexBuffer(const void* data, uint32_t size)
 {
     glGenBuffers(1, &m_RendererID);
-    glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
     glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
 }
 
 VertexBuffer::~VertexBuffer()
 {
     glDeleteBuffers(1, &m_RendererID);
+    GLState::OnBufferDeleted(m_RendererID);
 }
 
 void VertexBuffer::Bind() const
 {
-    glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
 }
 
 void VertexBuffer::Unbind() const
 {
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
 IndexBuffer::IndexBuffer(const uint32_t* data, uint32_t count)
@@ -10,6 +10,8 @@ public:
     void Bind() const;
     void Unbind() const;
 
+    uint32_t GetRendererID() const { return m_RendererID; }
+
 private:
     uint32_t m_RendererID = 0;
 };
@@ -24,6 +26,7 @@ public:
     void Unbind() const;
 
     uint32_t GetCount() const { return m_Count; }
+    uint32_t GetRendererID() const { return m_RendererID; }
 
 private:
     uint32_t m_RendererID = 0;
@@ -0,0 +1,145 @@
+#include "StreamingBuffer.hpp"
+#include <glad/glad.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include <Core/Log.hpp>
+#include <Rendering/Renderer.hpp>
+#include <Rendering/GLState.hpp>
+
+namespace
+{
+    // Region starts stay aligned for any UBO/SSBO offset alignment in practice
+    constexpr uint32_t REGION_ALIGNMENT = 256;
+}
+
+StreamingBuffer::StreamingBuffer(uint32_t bytesPerFrame, Mode mode)
+    : m_Mode(mode)
+{
+    Allocate(bytesPerFrame);
+}
+
+StreamingBuffer::~StreamingBuffer()
+{
+    Release();
+}
+
+void StreamingBuffer::Allocate(uint32_t bytesPerFrame)
+{
+    m_BytesPerFrame = (bytesPerFrame + REGION_ALIGNMENT - 1) / REGION_ALIGNMENT * REGION_ALIGNMENT;
+    GLsizeiptr totalSize = (GLsizeiptr)m_BytesPerFrame * FrameCount;
+
+    glGenBuffers(1, &m_RendererID);
+    GLState::BindBuffer(GL_COPY_WRITE_BUFFER, m_RendererID);
+
+    if (m_Mode == Mode::Persistent && GLAD_GL_VERSION_4_4)
+    {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_COPY_WRITE_BUFFER, totalSize, nullptr, flags);
+        m_Mapped = (uint8_t*)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, totalSize, flags);
+    }
+
+    if (!m_Mapped)
+    {
+        glBufferData(GL_COPY_WRITE_BUFFER, totalSize, nullptr, GL_STREAM_DRAW);
+        if (m_Mode == Mode::Persistent && m_Stats.Grows == 0)
+            CORE_INFO("[StreamingBuffer] Persistent mapping unavailable - using glBufferSubData");
+    }
+}
+
+void StreamingBuffer::Release()
+{
+    for (void*& fence : m_Fences)
+    {
+        if (fence) glDeleteSync((GLsync)fence);
+        fence = nullptr;
+    }
+
+    if (m_Mapped)
+    {
+        GLState::BindBuffer(GL_COPY_WRITE_BUFFER, m_RendererID);
+        glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+        m_Mapped = nullptr;
+    }
+    glDeleteBuffers(1, &m_RendererID);
+    GLState::OnBufferDeleted(m_RendererID);
+    m_RendererID = 0;
+}
+
+void StreamingBuffer::Reserve(uint32_t bytes)
+{
+    if (m_Head + bytes > m_BytesPerFrame)
+        Grow(bytes);
+}
+
+void StreamingBuffer::Grow(uint32_t bytes)
+{
+    // Deleting does not wait: storage in use by issued draws outlives the name
+    uint32_t previous = m_BytesPerFrame;
+    Release();
+    Allocate(std::max(bytes, previous * 2));
+    m_Head = 0;
+    m_Stats.Grows++;
+    CORE_INFO("[StreamingBuffer] Frame region grown {0} -> {1} bytes", previous, m_BytesPerFrame);
+}
+
+void StreamingBuffer::BeginFrame()
+{
+    m_Frame = (m_Frame + 1) % FrameCount;
+    m_Head = 0;
+    m_Stats.BytesThisFrame = 0;
+    m_Stats.UploadMsThisFrame = 0.0;
+
+    // Region was last used FrameCount - 1 frames ago; normally already signaled
+    if (GLsync fence = (GLsync)m_Fences[m_Frame])
+    {
+        GLenum result = glClientWaitSync(fence, 0, 0);
+        if (result == GL_TIMEOUT_EXPIRED)
+        {
+            m_Stats.Stalls++;
+            glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+        }
+        glDeleteSync(fence);
+        m_Fences[m_Frame] = nullptr;
+    }
+}
+
+void StreamingBuffer::EndFrame()
+{
+    if (m_Fences[m_Frame])
+        glDeleteSync((GLsync)m_Fences[m_Frame]);
+    m_Fences[m_Frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+uint32_t StreamingBuffer::Append(const void* data, uint32_t size, uint32_t alignment)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    uint32_t head = (m_Head + alignment - 1) / alignment * alignment;
+    if (head + size > m_BytesPerFrame)
+    {
+        // Nobody reserved enough - move to a larger buffer and continue there
+        Grow(size);
+        head = 0;
+    }
+
+    uint32_t offset = m_Frame * m_BytesPerFrame + head;
+    m_Head = head + size;
+
+    if (m_Mapped)
+    {
+        std::memcpy(m_Mapped + offset, data, size);
+    }
+    else
+    {
+        if (GLState::BindBuffer(GL_COPY_WRITE_BUFFER, m_RendererID))
+            Renderer::GetStats().BufferBinds++;
+        glBufferSubData(GL_COPY_WRITE_BUFFER, offset, size, data);
+        Renderer::GetStats().BufferUploads++;
+    }
+
+    m_Stats.BytesThisFrame += size;
+    m_Stats.UploadMsThisFrame += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return offset;
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * ============================================================================
+ * STREAMING BUFFER - per-frame dynamic data (debug lines, gizmos, UBO blocks)
+ * ============================================================================
+ *
+ * One GL buffer split into FrameCount regions. Each frame appends into its
+ * own region; EndFrame() drops a fence on it and BeginFrame() only waits on
+ * the fence of the region it is about to reuse, which the GPU finished
+ * FrameCount - 1 frames ago. In steady state the CPU never waits.
+ *
+ * Mode::Persistent (GL 4.4+): glBufferStorage + persistent coherent map,
+ * Append() is a memcpy. Mode::SubData: plain glBufferSubData per Append(),
+ * used as fallback and as the baseline for the upload stats.
+ *
+ * Regions grow on demand: Reserve() sizes them for a frame's known total
+ * before the first Append(), and an Append() that does not fit moves to a
+ * buffer twice the size. The old buffer is deleted without waiting - GL keeps
+ * its storage alive until the draws already issued from it have run - and
+ * the new one starts with no fences, so growing never stalls the CPU.
+ * ============================================================================
+ */
+class StreamingBuffer
+{
+public:
+    static constexpr uint32_t FrameCount = 3;
+    static constexpr uint32_t InvalidOffset = 0xFFFFFFFFu;
+
+    enum class Mode
+    {
+        Persistent,  // Falls back to SubData if the driver lacks GL 4.4
+        SubData
+    };
+
+    struct Stats
+    {
+        uint64_t BytesThisFrame = 0;
+        double UploadMsThisFrame = 0.0;  // CPU time spent inside Append()
+        uint32_t Stalls = 0;             // Fence waits that actually blocked
+        uint32_t Grows = 0;              // Reallocations to a larger frame region
+
+        double GetMBPerSecond() const
+        {
+            return UploadMsThisFrame > 0.0 ? (BytesThisFrame / (1024.0 * 1024.0)) / (UploadMsThisFrame / 1000.0) : 0.0;
+        }
+    };
+
+    // Usable as vertex, index or uniform storage - uploads go through
+    // GL_COPY_WRITE_BUFFER so they never disturb the bound VAO
+    StreamingBuffer(uint32_t bytesPerFrame, Mode mode = Mode::Persistent);
+    ~StreamingBuffer();
+
+    StreamingBuffer(const StreamingBuffer&) = delete;
+    StreamingBuffer& operator=(const StreamingBuffer&) = delete;
+
+    void BeginFrame();
+    void EndFrame();
+
+    // Grows the frame regions so `bytes` (alignment padding included) fit this
+    // frame; call before the frame's first Append()
+    void Reserve(uint32_t bytes);
+
+    // Copies data into the current frame's region, returns its byte offset in
+    // the buffer. The buffer may be reallocated - read GetRendererID() after.
+    uint32_t Append(const void* data, uint32_t size, uint32_t alignment = 4);
+
+    uint32_t GetRendererID() const { return m_RendererID; }
+    uint32_t GetBytesPerFrame() const { return m_BytesPerFrame; }
+    bool IsPersistent() const { return m_Mapped != nullptr; }
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    void Allocate(uint32_t bytesPerFrame);
+    void Release();
+    // New buffer with regions of at least `bytes`, current frame restarts at 0
+    void Grow(uint32_t bytes);
+
+    uint32_t m_RendererID = 0;
+    uint32_t m_BytesPerFrame = 0;
+    Mode m_Mode = Mode::Persistent;
+
+    uint8_t* m_Mapped = nullptr;
+
+    uint32_t m_Frame = 0;
+    uint32_t m_Head = 0; // Offset within the current frame's region
+    void* m_Fences[FrameCount] = {};
+
+    Stats m_Stats;
+};
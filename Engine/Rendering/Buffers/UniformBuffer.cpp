@@ -0,0 +1,65 @@
+#include "UniformBuffer.hpp"
+#include <glad/glad.h>
+#include <cstring>
+
+#include <Rendering/Renderer.hpp>
+#include <Rendering/GLState.hpp>
+
+int UniformBinding::FromBlockName(const char* name)
+{
+    if (std::strcmp(name, "Camera") == 0) return (int)Camera;
+    if (std::strcmp(name, "Object") == 0) return (int)Object;
+    return -1;
+}
+
+// ============================================================================
+// UniformBuffer
+// ============================================================================
+UniformBuffer::UniformBuffer(uint32_t size, uint32_t binding)
+    : m_Binding(binding)
+{
+    glGenBuffers(1, &m_RendererID);
+    GLState::BindBuffer(GL_UNIFORM_BUFFER, m_RendererID);
+    glBufferData(GL_UNIFORM_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+
+    // Bound once - the binding point never changes
+    glBindBufferBase(GL_UNIFORM_BUFFER, m_Binding, m_RendererID);
+}
+
+UniformBuffer::~UniformBuffer()
+{
+    glDeleteBuffers(1, &m_RendererID);
+    GLState::OnBufferDeleted(m_RendererID);
+}
+
+void UniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+{
+    if (GLState::BindBuffer(GL_UNIFORM_BUFFER, m_RendererID))
+        Renderer::GetStats().BufferBinds++;
+    glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+    Renderer::GetStats().BufferUploads++;
+}
+
+// ============================================================================
+// UniformRingBuffer
+// ============================================================================
+UniformRingBuffer::UniformRingBuffer(uint32_t bytesPerFrame, uint32_t binding, StreamingBuffer::Mode mode)
+    : m_Binding(binding)
+{
+    GLint alignment = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    if (alignment > 0)
+        m_Alignment = (uint32_t)alignment;
+
+    m_Buffer = std::make_unique<StreamingBuffer>(bytesPerFrame, mode);
+}
+
+void UniformRingBuffer::Push(const void* data, uint32_t size)
+{
+    uint32_t offset = m_Buffer->Append(data, size, m_Alignment);
+    if (offset == StreamingBuffer::InvalidOffset)
+        return;
+
+    GLState::BindUniformBufferRange(m_Binding, m_Buffer->GetRendererID(), offset, size);
+    Renderer::GetStats().BufferBinds++;
+}
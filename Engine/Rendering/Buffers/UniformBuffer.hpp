@@ -0,0 +1,75 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <glm/glm.hpp>
+
+#include "StreamingBuffer.hpp"
+
+// ============================================================================
+// Uniform block binding points - shared by every shader
+// ============================================================================
+// Shaders declare blocks by name (GLSL 410 has no layout(binding = N)); the
+// Shader class maps known block names to these points right after link.
+namespace UniformBinding
+{
+    constexpr uint32_t Camera = 0; // uniform Camera { mat4 u_ViewProj; }
+    constexpr uint32_t Object = 1; // uniform Object { mat4 u_Model; vec4 u_Color; }
+
+    // Returns the binding point for a block name, or -1 if unknown
+    int FromBlockName(const char* name);
+}
+
+// std140 layouts - must match the GLSL declarations above
+struct CameraBlock
+{
+    glm::mat4 ViewProj;
+};
+
+struct ObjectBlock
+{
+    glm::mat4 Model;
+    glm::vec4 Color;
+};
+
+// ============================================================================
+// UniformBuffer - single std140 block, updated with glBufferSubData
+// ============================================================================
+class UniformBuffer
+{
+public:
+    UniformBuffer(uint32_t size, uint32_t binding);
+    ~UniformBuffer();
+
+    void SetData(const void* data, uint32_t size, uint32_t offset = 0);
+
+private:
+    uint32_t m_RendererID = 0;
+    uint32_t m_Binding = 0;
+};
+
+// ============================================================================
+// UniformRingBuffer - per-draw blocks streamed through a StreamingBuffer
+// ============================================================================
+// Each Push() appends the block at the UBO offset alignment and binds it with
+// glBindBufferRange. Frame fencing is handled by the StreamingBuffer.
+// ============================================================================
+class UniformRingBuffer
+{
+public:
+    UniformRingBuffer(uint32_t bytesPerFrame, uint32_t binding,
+                      StreamingBuffer::Mode mode = StreamingBuffer::Mode::Persistent);
+
+    void BeginFrame() { m_Buffer->BeginFrame(); }
+    void EndFrame() { m_Buffer->EndFrame(); }
+
+    // Copies the block into the ring and binds it to this buffer's binding point
+    void Push(const void* data, uint32_t size);
+
+    bool IsPersistent() const { return m_Buffer->IsPersistent(); }
+    const StreamingBuffer::Stats& GetStats() const { return m_Buffer->GetStats(); }
+
+private:
+    std::unique_ptr<StreamingBuffer> m_Buffer;
+    uint32_t m_Binding = 0;
+    uint32_t m_Alignment = 256;
+};
@@ -1,5 +1,6 @@
 #include "VertexArray.hpp"
 #include <glad/glad.h>
+#include <Rendering/GLState.hpp>
 
 VertexArray::VertexArray()
 {
@@ -9,17 +10,18 @@ VertexArray::VertexArray()
 VertexArray::~VertexArray()
 {
     glDeleteVertexArrays(1, &m_RendererID);
+    GLState::OnVertexArrayDeleted(m_RendererID);
     // unique_ptr automatically deletes buffers - no manual delete needed
 }
 
-void VertexArray::Bind() const
+bool VertexArray::Bind() const
 {
-    glBindVertexArray(m_RendererID);
+    return GLState::BindVertexArray(m_RendererID);
 }
 
 void VertexArray::Unbind() const
 {
-    glBindVertexArray(0);
+    GLState::BindVertexArray(0);
 }
 
 void VertexArray::AddVertexBuffer(std::unique_ptr<VertexBuffer> vb)
@@ -14,13 +14,15 @@ public:
     VertexArray();
     ~VertexArray();
 
-    void Bind() const;
+    // Returns false if this VAO was already bound (no GL call issued)
+    bool Bind() const;
     void Unbind() const;
 
     // Takes ownership of buffers - transfers ownership via unique_ptr
     void AddVertexBuffer(std::unique_ptr<VertexBuffer> vb);
     void SetIndexBuffer(std::unique_ptr<IndexBuffer> ib);
 
+    VertexBuffer* GetVertexBuffer() const { return m_VertexBuffer.get(); }
     IndexBuffer* GetIndexBuffer() const { return m_IndexBuffer.get(); }
 
 private:
@@ -0,0 +1,199 @@
+#include "CookedTexture.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <Core/Log.hpp>
+#include <Core/Resources/MappedFile.hpp>
+
+namespace
+{
+    constexpr uint64_t BLOCK_ALIGNMENT = 16;
+
+    CookedTexture::Settings s_Settings;
+
+    uint64_t AlignUp(uint64_t value)
+    {
+        return (value + BLOCK_ALIGNMENT - 1) & ~(BLOCK_ALIGNMENT - 1);
+    }
+}
+
+void CookedTexture::SetSettings(const Settings& settings)
+{
+    s_Settings = settings;
+}
+
+const CookedTexture::Settings& CookedTexture::GetSettings()
+{
+    return s_Settings;
+}
+
+uint32_t CookedTexture::GetSettingsKey()
+{
+    return (uint32_t)s_Settings.OpaqueFormat | ((uint32_t)s_Settings.AlphaFormat << 8) | ((uint32_t)s_Settings.Quality << 16);
+}
+
+bool CookedTexture::Cook(const std::string& path, const std::string& sourcePath)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    Image source;
+    if (!ImageLoader::Load(sourcePath, source)) return false;
+
+    const bool alpha = TextureCompressor::HasAlpha(source);
+    CookedTextureHeader header;
+    header.Format = (uint32_t)(alpha ? s_Settings.AlphaFormat : s_Settings.OpaqueFormat);
+    header.Width = source.GetWidth();
+    header.Height = source.GetHeight();
+    header.MipCount = (uint32_t)source.Levels.size();
+    header.SettingsKey = GetSettingsKey();
+
+    Image compressed;
+    if (!TextureCompressor::Compress(source, (TextureFormat)header.Format, s_Settings.Quality, compressed))
+    {
+        CORE_ERROR("[CookedTexture] Cannot encode '{0}' as {1}", sourcePath, Image::GetFormatName((TextureFormat)header.Format));
+        return false;
+    }
+    header.PSNR = (float)TextureCompressor::ComputePSNR(source, compressed);
+    header.AlphaPSNR = alpha ? (float)TextureCompressor::ComputePSNR(source, compressed, 0, true) : 0.0f;
+
+    std::vector<CookedTextureLevel> table(compressed.Levels.size());
+    uint64_t offset = AlignUp(sizeof(CookedTextureHeader) + table.size() * sizeof(CookedTextureLevel));
+    for (size_t i = 0; i < table.size(); i++)
+    {
+        table[i].Offset = offset;
+        table[i].Size = (uint32_t)compressed.Levels[i].Pixels.size();
+        offset = AlignUp(offset + table[i].Size);
+    }
+
+    double cookMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    header.CookMs = (float)cookMs;
+
+    // Renamed into place once complete: TextureStreamer workers may be mapping the old file,
+    // and a per-thread name keeps two cooks of the same source apart
+    const std::string tmpPath = path + "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + ".tmp";
+    std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        CORE_ERROR("[CookedTexture] Cannot write '{0}'", tmpPath);
+        return false;
+    }
+
+    static const char s_Padding[BLOCK_ALIGNMENT] = {};
+    auto pad = [&file]()
+    {
+        uint64_t position = (uint64_t)file.tellp();
+        file.write(s_Padding, (std::streamsize)(AlignUp(position) - position));
+    };
+
+    file.write((const char*)&header, sizeof(header));
+    file.write((const char*)table.data(), (std::streamsize)(table.size() * sizeof(CookedTextureLevel)));
+    pad();
+    for (const Image::Level& level : compressed.Levels)
+    {
+        file.write((const char*)level.Pixels.data(), (std::streamsize)level.Pixels.size());
+        pad();
+    }
+
+    file.close();
+    std::error_code error;
+    if (!file)
+    {
+        CORE_ERROR("[CookedTexture] Write to '{0}' failed", tmpPath);
+        std::filesystem::remove(tmpPath, error);
+        return false;
+    }
+
+    std::filesystem::rename(tmpPath, path, error);
+    if (error)
+    {
+        CORE_ERROR("[CookedTexture] Cannot replace '{0}': {1}", path, error.message());
+        std::filesystem::remove(tmpPath, error);
+        return false;
+    }
+
+    CORE_INFO("[CookedTexture] Cooked '{0}': {1} {2}x{3}, {4} mips, {5} KB ({6}:1), PSNR {7} dB, {8} ms",
+              path, Image::GetFormatName((TextureFormat)header.Format), header.Width, header.Height, header.MipCount,
+              offset / 1024, source.GetByteSize() / std::max<uint64_t>(1, compressed.GetByteSize()), header.PSNR, cookMs);
+    return true;
+}
+
+bool CookedTexture::Load(const std::string& path, Image& image, uint32_t firstLevel)
+{
+    MappedFile file(path);
+    if (!file.IsOpen()) return false;
+
+    const char* data = file.GetData();
+    const uint64_t size = file.GetSize();
+
+    if (size < sizeof(CookedTextureHeader))
+    {
+        CORE_ERROR("[CookedTexture] '{0}' is truncated", path);
+        return false;
+    }
+
+    CookedTextureHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (header.Magic != CookedTextureHeader::MagicValue || header.Version != CookedTextureHeader::CurrentVersion ||
+        header.Format == (uint32_t)TextureFormat::RGBA8 || header.Format >= (uint32_t)TextureFormat::Count ||
+        header.MipCount == 0 || header.MipCount != ImageLoader::GetMipCount(header.Width, header.Height) ||
+        sizeof(CookedTextureHeader) + (uint64_t)header.MipCount * sizeof(CookedTextureLevel) > size)
+    {
+        CORE_ERROR("[CookedTexture] '{0}' is not a version {1} cooked texture", path, CookedTextureHeader::CurrentVersion);
+        return false;
+    }
+
+    const TextureFormat format = (TextureFormat)header.Format;
+    const CookedTextureLevel* table = (const CookedTextureLevel*)(data + sizeof(CookedTextureHeader));
+
+    Image result;
+    result.Format = format;
+    result.Levels.resize(header.MipCount);
+    firstLevel = std::min(firstLevel, header.MipCount - 1);
+    for (uint32_t i = 0; i < header.MipCount; i++)
+    {
+        Image::Level& level = result.Levels[i];
+        level.Width = std::max(1u, header.Width >> i);
+        level.Height = std::max(1u, header.Height >> i);
+
+        const CookedTextureLevel& entry = table[i];
+        if (entry.Offset + entry.Size > size || entry.Offset % BLOCK_ALIGNMENT != 0 ||
+            entry.Size != Image::GetLevelBytes(format, level.Width, level.Height))
+        {
+            CORE_ERROR("[CookedTexture] '{0}' has a corrupt level table", path);
+            return false;
+        }
+        if (i >= firstLevel)
+            level.Pixels.assign(data + entry.Offset, data + entry.Offset + entry.Size);
+    }
+
+    image = std::move(result);
+    return true;
+}
+
+bool CookedTexture::IsUpToDate(const std::string& cookedPath, const std::string& sourcePath)
+{
+    std::error_code error;
+    auto cookedTime = std::filesystem::last_write_time(cookedPath, error);
+    if (error) return false;
+    auto sourceTime = std::filesystem::last_write_time(sourcePath, error);
+    if (!error && sourceTime > cookedTime) return false;
+
+    std::ifstream file(cookedPath, std::ios::binary);
+    CookedTextureHeader header;
+    if (!file.read((char*)&header, sizeof(header))) return false;
+
+    return header.Magic == CookedTextureHeader::MagicValue && header.Version == CookedTextureHeader::CurrentVersion &&
+           header.SettingsKey == GetSettingsKey();
+}
+
+bool CookedTexture::IsCookedPath(const std::string& path)
+{
+    const size_t length = std::strlen(Extension);
+    return path.size() >= length && path.compare(path.size() - length, length, Extension) == 0;
+}
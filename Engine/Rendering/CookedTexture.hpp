@@ -0,0 +1,86 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+#include <Rendering/Image.hpp>
+#include <Rendering/TextureCompressor.hpp>
+
+/**
+ * ============================================================================
+ * COOKED TEXTURE - engine-native block-compressed texture (.ctex)
+ * ============================================================================
+ *
+ * Layout (little endian, every level 16-byte aligned):
+ *
+ *   CookedTextureHeader                   64 bytes
+ *   CookedTextureLevel[MipCount]          16 bytes each, level 0 first
+ *   level data                            offsets from the level table
+ *
+ * Every mip is stored already encoded (TextureCompressor), so loading is a
+ * mapped-file copy straight into Image levels - no decode, no mip build.
+ * Load() can skip the levels above a streamed base mip: TextureStreamer
+ * reads only what it uploads.
+ *
+ * Cook() decodes the source, builds mips and encodes with the current
+ * Settings: opaque images get OpaqueFormat, images with any alpha below 255
+ * get AlphaFormat. The header keeps the settings (up-to-date check) and
+ * the level-0 PSNR measured while cooking.
+ * ============================================================================
+ */
+struct CookedTextureHeader
+{
+    static constexpr uint32_t MagicValue = 0x58455443; // "CTEX"
+    static constexpr uint32_t CurrentVersion = 1;
+
+    uint32_t Magic = MagicValue;
+    uint32_t Version = CurrentVersion;
+    uint32_t Format = 0;          // TextureFormat
+    uint32_t Width = 0;
+    uint32_t Height = 0;
+    uint32_t MipCount = 0;
+    uint32_t SettingsKey = 0;     // CookedTexture::Settings packed (up-to-date check)
+    float PSNR = 0.0f;            // RGB, level 0
+    float AlphaPSNR = 0.0f;       // 0 without alpha
+    float CookMs = 0.0f;          // Decode + mips + encode
+    uint32_t Reserved[6] = {};
+};
+static_assert(sizeof(CookedTextureHeader) == 64, "CookedTextureHeader is part of the file format");
+
+struct CookedTextureLevel
+{
+    uint64_t Offset = 0;
+    uint32_t Size = 0;
+    uint32_t Reserved = 0;
+};
+static_assert(sizeof(CookedTextureLevel) == 16, "CookedTextureLevel is part of the file format");
+
+namespace CookedTexture
+{
+    constexpr const char* Extension = ".ctex";
+
+    struct Settings
+    {
+        bool Enabled = true;                                    // false: textures load uncompressed
+        TextureFormat OpaqueFormat = TextureFormat::BC1;
+        TextureFormat AlphaFormat = TextureFormat::BC3;
+        TextureCompressor::Quality Quality = TextureCompressor::Quality::Normal;
+    };
+
+    // Read by loader workers - change before loading textures
+    void SetSettings(const Settings& settings);
+    const Settings& GetSettings();
+    // Current settings packed into one value - changes whenever a re-cook is needed
+    uint32_t GetSettingsKey();
+
+    // Decodes `sourcePath`, builds mips, encodes and writes `path`
+    bool Cook(const std::string& path, const std::string& sourcePath);
+
+    // Levels below firstLevel keep their size but no data. False if the
+    // file is missing, truncated or from another version.
+    bool Load(const std::string& path, Image& image, uint32_t firstLevel = 0);
+
+    // True if `cookedPath` exists, is newer than `sourcePath` and was cooked with the current settings
+    bool IsUpToDate(const std::string& cookedPath, const std::string& sourcePath);
+
+    bool IsCookedPath(const std::string& path);
+}
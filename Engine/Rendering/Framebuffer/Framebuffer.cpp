@@ -1,7 +1,7 @@
 #include "Framebuffer.hpp"
 #include <Core/GLDebug.hpp>
 #include <Core/Log.hpp>
-#include <Core/Application.hpp>
+#include <Rendering/GLState.hpp>
 
 // Professional game engine limits (Unity/Unreal standards)
 constexpr uint32_t MAX_FRAMEBUFFER_SIZE = 16384; // 16K max dimension
@@ -15,6 +15,7 @@ Framebuffer::Framebuffer(uint32_t width, uint32_t height)
 Framebuffer::~Framebuffer()
 {
     GL_CALL(glDeleteFramebuffers(1, &m_RendererID));
+    GLState::OnFramebufferDeleted(m_RendererID);
     GL_CALL(glDeleteTextures(1, &m_ColorAttachment));
     GL_CALL(glDeleteRenderbuffers(1, &m_DepthAttachment));
 }
@@ -24,13 +25,14 @@ void Framebuffer::Invalidate()
     if (m_RendererID)
     {
         GL_CALL(glDeleteFramebuffers(1, &m_RendererID));
+        GLState::OnFramebufferDeleted(m_RendererID);
         GL_CALL(glDeleteTextures(1, &m_ColorAttachment));
         GL_CALL(glDeleteRenderbuffers(1, &m_DepthAttachment));
     }
 
     // Create framebuffer
     GL_CALL(glGenFramebuffers(1, &m_RendererID));
-    GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID));
+    GLState::BindFramebuffer(m_RendererID);
 
     // --- Color Texture Attachment ---
     GL_CALL(glGenTextures(1, &m_ColorAttachment));
@@ -55,27 +57,24 @@ void Framebuffer::Invalidate()
         CORE_ERROR("[Framebuffer] Incomplete! Status: 0x{0:X}", status);
     }
 
-    GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, 0));
+    GLState::BindFramebuffer(0);
 }
 
 void Framebuffer::Bind()
 {
-    GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID));
-    GL_CALL(glViewport(0, 0, m_Width, m_Height));
+    // Remember whatever viewport was active (from the state cache, no GL query)
+    GLState::GetViewport(m_PreviousViewport);
+
+    GLState::BindFramebuffer(m_RendererID);
+    GLState::SetViewport(0, 0, (int)m_Width, (int)m_Height);
 }
 
 void Framebuffer::Unbind()
 {
-    GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, 0));
+    GLState::BindFramebuffer(0);
 
-    // Restore viewport to window size - cache window pointer to avoid double fetch
-    Window* window = Application::Get().GetWindow();
-    if (window)
-    {
-        uint32_t w = window->GetWidth();
-        uint32_t h = window->GetHeight();
-        GL_CALL(glViewport(0, 0, w, h));
-    }
+    const int* v = m_PreviousViewport;
+    GLState::SetViewport(v[0], v[1], v[2], v[3]);
 }
 
 void Framebuffer::Resize(uint32_t width, uint32_t height)
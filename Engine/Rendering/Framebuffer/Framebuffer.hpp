@@ -27,4 +27,6 @@ private:
     uint32_t m_DepthAttachment = 0;
 
     uint32_t m_Width, m_Height;
+
+    int m_PreviousViewport[4] = { 0, 0, 0, 0 }; // Restored by Unbind
 };
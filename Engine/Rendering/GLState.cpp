@@ -0,0 +1,192 @@
+#include "GLState.hpp"
+#include <glad/glad.h>
+#include <Core/GLDebug.hpp>
+
+namespace
+{
+    constexpr uint32_t UNKNOWN = 0xFFFFFFFFu;
+
+    struct CachedState
+    {
+        uint32_t Program = UNKNOWN;
+        uint32_t VertexArray = UNKNOWN;
+        uint32_t Framebuffer = UNKNOWN;
+        uint32_t ArrayBuffer = UNKNOWN;
+        uint32_t UniformBuffer = UNKNOWN;
+        uint32_t DrawIndirectBuffer = UNKNOWN;
+
+        bool ViewportKnown = false;
+        int Viewport[4] = { 0, 0, 0, 0 };
+
+        // Tri-state: -1 unknown, 0 off, 1 on
+        int DepthTest = -1;
+        int Wireframe = -1;
+        float LineWidth = -1.0f;
+    };
+
+    CachedState s_State;
+    GLState::Stats s_Stats;
+
+    // Returns true if the call must be issued, and records the new value
+    template<typename T>
+    bool Update(T& cached, T value)
+    {
+        if (cached == value)
+        {
+            s_Stats.Redundant++;
+            return false;
+        }
+        cached = value;
+        s_Stats.Issued++;
+        return true;
+    }
+}
+
+void GLState::Invalidate()
+{
+    s_State = {};
+}
+
+bool GLState::UseProgram(uint32_t program)
+{
+    if (!Update(s_State.Program, program)) return false;
+    GL_CALL(glUseProgram(program));
+    return true;
+}
+
+bool GLState::BindVertexArray(uint32_t vertexArray)
+{
+    if (!Update(s_State.VertexArray, vertexArray)) return false;
+    GL_CALL(glBindVertexArray(vertexArray));
+    return true;
+}
+
+bool GLState::BindFramebuffer(uint32_t framebuffer)
+{
+    if (!Update(s_State.Framebuffer, framebuffer)) return false;
+    GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, framebuffer));
+    return true;
+}
+
+bool GLState::BindBuffer(uint32_t target, uint32_t buffer)
+{
+    uint32_t* cached = nullptr;
+    switch (target)
+    {
+        case GL_ARRAY_BUFFER:   cached = &s_State.ArrayBuffer; break;
+        case GL_UNIFORM_BUFFER: cached = &s_State.UniformBuffer; break;
+        case GL_DRAW_INDIRECT_BUFFER: cached = &s_State.DrawIndirectBuffer; break;
+        default: break;
+    }
+
+    if (!cached)
+    {
+        // Untracked target - always forward
+        s_Stats.Issued++;
+        GL_CALL(glBindBuffer(target, buffer));
+        return true;
+    }
+
+    if (!Update(*cached, buffer)) return false;
+    GL_CALL(glBindBuffer(target, buffer));
+    return true;
+}
+
+void GLState::BindUniformBufferRange(uint32_t index, uint32_t buffer, size_t offset, size_t size)
+{
+    // Ranges move every draw with a ring buffer, so they are not de-duplicated
+    s_Stats.Issued++;
+    GL_CALL(glBindBufferRange(GL_UNIFORM_BUFFER, index, buffer, (GLintptr)offset, (GLsizeiptr)size));
+    s_State.UniformBuffer = buffer;
+}
+
+void GLState::BindStorageBufferRange(uint32_t index, uint32_t buffer, size_t offset, size_t size)
+{
+    // Generic GL_SHADER_STORAGE_BUFFER binding is not tracked, so nothing to update
+    s_Stats.Issued++;
+    GL_CALL(glBindBufferRange(GL_SHADER_STORAGE_BUFFER, index, buffer, (GLintptr)offset, (GLsizeiptr)size));
+}
+
+void GLState::SetViewport(int x, int y, int width, int height)
+{
+    int* v = s_State.Viewport;
+    if (s_State.ViewportKnown && v[0] == x && v[1] == y && v[2] == width && v[3] == height)
+    {
+        s_Stats.Redundant++;
+        return;
+    }
+
+    v[0] = x; v[1] = y; v[2] = width; v[3] = height;
+    s_State.ViewportKnown = true;
+    s_Stats.Issued++;
+    GL_CALL(glViewport(x, y, width, height));
+}
+
+void GLState::GetViewport(int viewport[4])
+{
+    if (!s_State.ViewportKnown)
+    {
+        glGetIntegerv(GL_VIEWPORT, s_State.Viewport);
+        s_State.ViewportKnown = true;
+    }
+
+    for (int i = 0; i < 4; i++)
+        viewport[i] = s_State.Viewport[i];
+}
+
+void GLState::SetDepthTest(bool enabled)
+{
+    if (!Update(s_State.DepthTest, enabled ? 1 : 0))
+        return;
+
+    if (enabled) GL_CALL(glEnable(GL_DEPTH_TEST));
+    else         GL_CALL(glDisable(GL_DEPTH_TEST));
+}
+
+void GLState::SetWireframe(bool enabled)
+{
+    if (Update(s_State.Wireframe, enabled ? 1 : 0))
+        GL_CALL(glPolygonMode(GL_FRONT_AND_BACK, enabled ? GL_LINE : GL_FILL));
+}
+
+void GLState::SetLineWidth(float width)
+{
+    if (Update(s_State.LineWidth, width))
+        GL_CALL(glLineWidth(width));
+}
+
+// ============================================================================
+// Deletion hooks - GL resets a deleted bound object to 0
+// ============================================================================
+void GLState::OnProgramDeleted(uint32_t program)
+{
+    // A deleted program stays current until replaced - force the next UseProgram through
+    if (s_State.Program == program) s_State.Program = UNKNOWN;
+}
+
+void GLState::OnVertexArrayDeleted(uint32_t vertexArray)
+{
+    if (s_State.VertexArray == vertexArray) s_State.VertexArray = 0;
+}
+
+void GLState::OnFramebufferDeleted(uint32_t framebuffer)
+{
+    if (s_State.Framebuffer == framebuffer) s_State.Framebuffer = 0;
+}
+
+void GLState::OnBufferDeleted(uint32_t buffer)
+{
+    if (s_State.ArrayBuffer == buffer) s_State.ArrayBuffer = 0;
+    if (s_State.UniformBuffer == buffer) s_State.UniformBuffer = 0;
+    if (s_State.DrawIndirectBuffer == buffer) s_State.DrawIndirectBuffer = 0;
+}
+
+GLState::Stats& GLState::GetStats()
+{
+    return s_Stats;
+}
+
+void GLState::ResetStats()
+{
+    s_Stats = {};
+}
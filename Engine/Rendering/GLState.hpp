@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * ============================================================================
+ * GL STATE CACHE - every bind / enable in the renderer goes through here
+ * ============================================================================
+ *
+ * Shadows the bits of GL context state the engine touches and drops calls
+ * that would set a value that is already current. Anything the engine does
+ * not route through GLState (ImGui backend, third party code) must be
+ * followed by Invalidate() so the shadow copy is re-learned.
+ *
+ * Deleting an object that may be bound must go through the matching
+ * On*Deleted() hook: GL reverts the binding to 0 and the name can be reused.
+ *
+ * GL_ELEMENT_ARRAY_BUFFER is VAO state and is intentionally not tracked.
+ * ============================================================================
+ */
+class GLState
+{
+public:
+    struct Stats
+    {
+        uint32_t Issued = 0;    // Calls forwarded to GL
+        uint32_t Redundant = 0; // Calls skipped because the value was already set
+    };
+
+    // Forget everything - next call of each kind always reaches GL
+    static void Invalidate();
+
+    // Binds return true if the call actually reached GL
+    static bool UseProgram(uint32_t program);
+    static bool BindVertexArray(uint32_t vertexArray);
+    static bool BindFramebuffer(uint32_t framebuffer);
+
+    // GL_ARRAY_BUFFER / GL_UNIFORM_BUFFER / GL_DRAW_INDIRECT_BUFFER (generic binding points)
+    static bool BindBuffer(uint32_t target, uint32_t buffer);
+    // Indexed uniform binding - also changes the generic GL_UNIFORM_BUFFER binding
+    static void BindUniformBufferRange(uint32_t index, uint32_t buffer, size_t offset, size_t size);
+    static void BindStorageBufferRange(uint32_t index, uint32_t buffer, size_t offset, size_t size);
+
+    static void SetViewport(int x, int y, int width, int height);
+    static void GetViewport(int viewport[4]);
+
+    static void SetDepthTest(bool enabled);
+    static void SetWireframe(bool enabled);
+    static void SetLineWidth(float width);
+
+    static void OnProgramDeleted(uint32_t program);
+    static void OnVertexArrayDeleted(uint32_t vertexArray);
+    static void OnFramebufferDeleted(uint32_t framebuffer);
+    static void OnBufferDeleted(uint32_t buffer);
+
+    static Stats& GetStats();
+    static void ResetStats();
+};
@@ -0,0 +1,413 @@
+#include "Image.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+
+#include <Core/Log.hpp>
+#include <Core/Resources/MappedFile.hpp>
+
+#if __has_include(<stb_image.h>)
+    #define STB_IMAGE_IMPLEMENTATION
+    #include <stb_image.h>
+    #define IMAGE_HAS_STB 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define IMAGE_MIPS_SSE2 1
+#endif
+
+namespace
+{
+    std::mutex s_StatsMutex;
+    ImageLoader::Stats s_Stats;
+
+    uint16_t ReadU16(const uint8_t* p) { uint16_t v; std::memcpy(&v, p, 2); return v; }
+    uint32_t ReadU32(const uint8_t* p) { uint32_t v; std::memcpy(&v, p, 4); return v; }
+    int32_t ReadI32(const uint8_t* p) { int32_t v; std::memcpy(&v, p, 4); return v; }
+
+    // Keeps a corrupt header from allocating gigabytes
+    constexpr uint32_t MAX_DIMENSION = 16384;
+
+    bool Allocate(Image& image, uint32_t width, uint32_t height)
+    {
+        if (width == 0 || height == 0 || width > MAX_DIMENSION || height > MAX_DIMENSION) return false;
+        image.Format = TextureFormat::RGBA8;
+        image.Levels.assign(1, Image::Level());
+        image.Levels[0].Width = width;
+        image.Levels[0].Height = height;
+        image.Levels[0].Pixels.resize((size_t)width * height * 4);
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    // BMP - uncompressed 24/32-bit
+    // ------------------------------------------------------------------------
+    bool DecodeBMP(const uint8_t* data, size_t size, Image& image)
+    {
+        if (size < 54 || data[0] != 'B' || data[1] != 'M') return false;
+
+        uint32_t pixelOffset = ReadU32(data + 10);
+        int32_t width = ReadI32(data + 18);
+        int32_t height = ReadI32(data + 22);
+        uint16_t bpp = ReadU16(data + 28);
+        uint32_t compression = ReadU32(data + 30);
+        if (compression != 0 || (bpp != 24 && bpp != 32) || width <= 0 || height == 0) return false;
+
+        bool topDown = height < 0;
+        uint32_t w = (uint32_t)width, h = (uint32_t)(topDown ? -(int64_t)height : height);
+        size_t stride = (((size_t)bpp * w + 31) / 32) * 4;
+        if (pixelOffset + stride * h > size || !Allocate(image, w, h)) return false;
+
+        uint32_t bytesPerPixel = bpp / 8;
+        uint8_t* dst = image.Levels[0].Pixels.data();
+        for (uint32_t y = 0; y < h; y++)
+        {
+            const uint8_t* row = data + pixelOffset + stride * (topDown ? y : h - 1 - y);
+            for (uint32_t x = 0; x < w; x++, dst += 4)
+            {
+                const uint8_t* px = row + x * bytesPerPixel;
+                dst[0] = px[2];
+                dst[1] = px[1];
+                dst[2] = px[0];
+                dst[3] = 255; // BI_RGB alpha is undefined
+            }
+        }
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    // PPM / PGM - binary, maxval <= 255
+    // ------------------------------------------------------------------------
+    bool ReadPnmNumber(const uint8_t* data, size_t size, size_t& pos, uint32_t& value)
+    {
+        for (;;)
+        {
+            while (pos < size && (data[pos] == ' ' || data[pos] == '\t' || data[pos] == '\r' || data[pos] == '\n')) pos++;
+            if (pos < size && data[pos] == '#')
+            {
+                while (pos < size && data[pos] != '\n') pos++;
+                continue;
+            }
+            break;
+        }
+        if (pos >= size || data[pos] < '0' || data[pos] > '9') return false;
+
+        value = 0;
+        while (pos < size && data[pos] >= '0' && data[pos] <= '9' && value < 1000000)
+            value = value * 10 + (data[pos++] - '0');
+        return true;
+    }
+
+    bool DecodePNM(const uint8_t* data, size_t size, Image& image)
+    {
+        if (size < 3 || data[0] != 'P' || (data[1] != '5' && data[1] != '6')) return false;
+
+        uint32_t channels = data[1] == '6' ? 3 : 1;
+        size_t pos = 2;
+        uint32_t width, height, maxValue;
+        if (!ReadPnmNumber(data, size, pos, width) || !ReadPnmNumber(data, size, pos, height) ||
+            !ReadPnmNumber(data, size, pos, maxValue) || maxValue == 0 || maxValue > 255)
+            return false;
+        pos++; // Single whitespace before the raster
+
+        if (pos + (size_t)width * height * channels > size || !Allocate(image, width, height)) return false;
+
+        const uint8_t* src = data + pos;
+        uint8_t* dst = image.Levels[0].Pixels.data();
+        size_t count = (size_t)width * height;
+        for (size_t i = 0; i < count; i++, dst += 4, src += channels)
+        {
+            dst[0] = (uint8_t)(src[0] * 255u / maxValue);
+            dst[1] = (uint8_t)(src[channels == 3 ? 1 : 0] * 255u / maxValue);
+            dst[2] = (uint8_t)(src[channels == 3 ? 2 : 0] * 255u / maxValue);
+            dst[3] = 255;
+        }
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    // TGA - true color (24/32) or grayscale (8), raw or RLE
+    // ------------------------------------------------------------------------
+    bool DecodeTGA(const uint8_t* data, size_t size, Image& image)
+    {
+        if (size < 18) return false;
+
+        uint8_t idLength = data[0];
+        uint8_t colorMapType = data[1];
+        uint8_t imageType = data[2];
+        uint32_t width = ReadU16(data + 12);
+        uint32_t height = ReadU16(data + 14);
+        uint8_t depth = data[16];
+        uint8_t descriptor = data[17];
+
+        bool rle = imageType == 10 || imageType == 11;
+        bool gray = imageType == 3 || imageType == 11;
+        if (colorMapType != 0 || (imageType != 2 && imageType != 3 && !rle)) return false;
+        if (gray ? depth != 8 : (depth != 24 && depth != 32)) return false;
+        if (!Allocate(image, width, height)) return false;
+
+        const uint32_t bytesPerPixel = depth / 8;
+        const bool topDown = (descriptor & 0x20) != 0;
+        const size_t count = (size_t)width * height;
+        const uint8_t* src = data + 18 + idLength;
+        const uint8_t* end = data + size;
+        uint8_t* pixels = image.Levels[0].Pixels.data();
+
+        // Output cursor - bottom-up files fill rows from the end
+        uint32_t x = 0;
+        uint8_t* row = pixels + (size_t)(topDown ? 0 : height - 1) * width * 4;
+        const ptrdiff_t rowStep = topDown ? (ptrdiff_t)width * 4 : -(ptrdiff_t)width * 4;
+
+        auto store = [&](const uint8_t* px)
+        {
+            uint8_t* dst = row + x * 4;
+            if (gray)
+            {
+                dst[0] = dst[1] = dst[2] = px[0];
+                dst[3] = 255;
+            }
+            else
+            {
+                dst[0] = px[2];
+                dst[1] = px[1];
+                dst[2] = px[0];
+                dst[3] = bytesPerPixel == 4 ? px[3] : 255;
+            }
+            if (++x == width)
+            {
+                x = 0;
+                row += rowStep;
+            }
+        };
+
+        if (!rle)
+        {
+            if (src + count * bytesPerPixel > end) return false;
+            for (size_t i = 0; i < count; i++, src += bytesPerPixel)
+                store(src);
+            return true;
+        }
+
+        for (size_t i = 0; i < count; )
+        {
+            if (src >= end) return false;
+            uint8_t packet = *src++;
+            size_t run = std::min<size_t>((packet & 0x7F) + 1, count - i);
+            i += run;
+            if (packet & 0x80)
+            {
+                if (src + bytesPerPixel > end) return false;
+                for (size_t r = 0; r < run; r++)
+                    store(src);
+                src += bytesPerPixel;
+            }
+            else
+            {
+                if (src + run * bytesPerPixel > end) return false;
+                for (size_t r = 0; r < run; r++, src += bytesPerPixel)
+                    store(src);
+            }
+        }
+        return true;
+    }
+
+#ifdef IMAGE_HAS_STB
+    bool DecodeSTB(const uint8_t* data, size_t size, Image& image)
+    {
+        int width, height, channels;
+        stbi_uc* pixels = stbi_load_from_memory(data, (int)size, &width, &height, &channels, 4);
+        if (!pixels) return false;
+
+        bool ok = Allocate(image, (uint32_t)width, (uint32_t)height);
+        if (ok) std::memcpy(image.Levels[0].Pixels.data(), pixels, image.Levels[0].Pixels.size());
+        stbi_image_free(pixels);
+        return ok;
+    }
+#endif
+
+    // ------------------------------------------------------------------------
+    // Mips
+    // ------------------------------------------------------------------------
+    void Downsample(const Image::Level& src, Image::Level& dst)
+    {
+        dst.Width = std::max(1u, src.Width / 2);
+        dst.Height = std::max(1u, src.Height / 2);
+        dst.Pixels.resize((size_t)dst.Width * dst.Height * 4);
+
+        const size_t srcStride = (size_t)src.Width * 4;
+        for (uint32_t y = 0; y < dst.Height; y++)
+        {
+            const uint8_t* row0 = src.Pixels.data() + std::min(2 * y, src.Height - 1) * srcStride;
+            const uint8_t* row1 = src.Pixels.data() + std::min(2 * y + 1, src.Height - 1) * srcStride;
+            uint8_t* out = dst.Pixels.data() + (size_t)y * dst.Width * 4;
+            uint32_t x = 0;
+
+#ifdef IMAGE_MIPS_SSE2
+            // 8 source pixels per row -> 4 output pixels. Width >= 2 means
+            // 2x + 1 never leaves the row, so no clamping is needed here.
+            if (src.Width >= 2)
+            {
+                const __m128i zero = _mm_setzero_si128();
+                const __m128i round = _mm_set1_epi16(2);
+                for (; x + 4 <= dst.Width; x += 4)
+                {
+                    __m128i a0 = _mm_loadu_si128((const __m128i*)(row0 + x * 8));
+                    __m128i a1 = _mm_loadu_si128((const __m128i*)(row0 + x * 8 + 16));
+                    __m128i b0 = _mm_loadu_si128((const __m128i*)(row1 + x * 8));
+                    __m128i b1 = _mm_loadu_si128((const __m128i*)(row1 + x * 8 + 16));
+
+                    // Vertical sums, two pixels per register
+                    __m128i s0 = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+                    __m128i s1 = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+                    __m128i s2 = _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+                    __m128i s3 = _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+
+                    // Horizontal pair sums land in the low 64 bits
+                    s0 = _mm_add_epi16(s0, _mm_srli_si128(s0, 8));
+                    s1 = _mm_add_epi16(s1, _mm_srli_si128(s1, 8));
+                    s2 = _mm_add_epi16(s2, _mm_srli_si128(s2, 8));
+                    s3 = _mm_add_epi16(s3, _mm_srli_si128(s3, 8));
+
+                    __m128i lo = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(s0, s1), round), 2);
+                    __m128i hi = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(s2, s3), round), 2);
+                    _mm_storeu_si128((__m128i*)(out + x * 4), _mm_packus_epi16(lo, hi));
+                }
+            }
+#endif
+            for (; x < dst.Width; x++)
+            {
+                const uint32_t x0 = std::min(2 * x, src.Width - 1) * 4;
+                const uint32_t x1 = std::min(2 * x + 1, src.Width - 1) * 4;
+                for (uint32_t c = 0; c < 4; c++)
+                    out[x * 4 + c] = (uint8_t)((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) >> 2);
+            }
+        }
+    }
+
+    double MsSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+uint64_t Image::GetByteSize() const
+{
+    uint64_t bytes = 0;
+    for (const Level& level : Levels)
+        bytes += level.Pixels.size();
+    return bytes;
+}
+
+uint64_t Image::GetLevelBytes(TextureFormat format, uint32_t width, uint32_t height)
+{
+    uint64_t blocks = (uint64_t)((width + 3) / 4) * ((height + 3) / 4);
+    switch (format)
+    {
+    case TextureFormat::RGBA8: return (uint64_t)width * height * 4;
+    case TextureFormat::BC1:   return blocks * 8;
+    case TextureFormat::BC3:
+    case TextureFormat::BC7:   return blocks * 16;
+    default:                   return 0;
+    }
+}
+
+const char* Image::GetFormatName(TextureFormat format)
+{
+    switch (format)
+    {
+    case TextureFormat::RGBA8: return "RGBA8";
+    case TextureFormat::BC1:   return "BC1";
+    case TextureFormat::BC3:   return "BC3";
+    case TextureFormat::BC7:   return "BC7";
+    default:                   return "Unknown";
+    }
+}
+
+bool ImageLoader::Decode(const void* data, size_t size, Image& image)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+    if (!bytes || size == 0) return false;
+
+    // Formats with a signature first - TGA has none and goes last
+    if (DecodeBMP(bytes, size, image)) return true;
+    if (DecodePNM(bytes, size, image)) return true;
+#ifdef IMAGE_HAS_STB
+    if (DecodeSTB(bytes, size, image)) return true;
+#endif
+    if (DecodeTGA(bytes, size, image)) return true;
+
+    image.Levels.clear();
+    return false;
+}
+
+bool ImageLoader::Load(const void* data, size_t size, Image& image, bool mips)
+{
+    auto start = std::chrono::steady_clock::now();
+    if (!Decode(data, size, image)) return false;
+    double decodeMs = MsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    if (mips) GenerateMips(image);
+    double mipMs = MsSince(start);
+
+    std::lock_guard<std::mutex> lock(s_StatsMutex);
+    s_Stats.Images++;
+    s_Stats.FileBytes += size;
+    s_Stats.DecodedBytes += image.Levels[0].Pixels.size();
+    s_Stats.MipBytes += image.GetByteSize() - image.Levels[0].Pixels.size();
+    s_Stats.DecodeMs += decodeMs;
+    s_Stats.MipMs += mipMs;
+    return true;
+}
+
+bool ImageLoader::Load(const std::string& path, Image& image, bool mips)
+{
+    MappedFile file(path);
+    if (!file.IsOpen())
+    {
+        CORE_ERROR("[ImageLoader] Cannot open '{0}'", path);
+        return false;
+    }
+
+    if (!Load(file.GetData(), file.GetSize(), image, mips))
+    {
+        CORE_ERROR("[ImageLoader] '{0}' is not a supported image", path);
+        return false;
+    }
+    return true;
+}
+
+void ImageLoader::GenerateMips(Image& image)
+{
+    if (!image.IsValid() || image.IsCompressed()) return;
+
+    uint32_t count = GetMipCount(image.GetWidth(), image.GetHeight());
+    image.Levels.resize(count);
+    for (uint32_t i = 1; i < count; i++)
+        Downsample(image.Levels[i - 1], image.Levels[i]);
+}
+
+uint32_t ImageLoader::GetMipCount(uint32_t width, uint32_t height)
+{
+    uint32_t count = 1;
+    for (uint32_t size = std::max(width, height); size > 1; size >>= 1)
+        count++;
+    return count;
+}
+
+ImageLoader::Stats ImageLoader::GetStats()
+{
+    std::lock_guard<std::mutex> lock(s_StatsMutex);
+    return s_Stats;
+}
+
+void ImageLoader::LogStats()
+{
+    Stats stats = GetStats();
+    CORE_INFO("[ImageLoader] {0} images, {1} KB files -> {2} KB pixels + {3} KB mips",
+              stats.Images, stats.FileBytes / 1024, stats.DecodedBytes / 1024, stats.MipBytes / 1024);
+    CORE_INFO("[ImageLoader]   decode {0} MB/s ({1} ms), mips {2} MB/s ({3} ms)",
+              stats.GetDecodeMBPerSecond(), stats.DecodeMs, stats.GetMipMBPerSecond(), stats.MipMs);
+}
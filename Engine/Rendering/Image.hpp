@@ -0,0 +1,91 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * ============================================================================
+ * IMAGE - decoded RGBA8 pixels plus mip chain, no GL
+ * ============================================================================
+ *
+ * ImageLoader turns file bytes into an Image on any thread; Texture2D
+ * uploads it later on the main thread. Every level is tightly packed RGBA8,
+ * rows top to bottom.
+ *
+ * Decoders: BMP (24/32-bit BI_RGB), binary PPM/PGM (P6/P5, 8-bit) and TGA
+ * (true color / grayscale, raw or RLE) are built in. When stb_image.h is on
+ * the include path (vendor/stb) it handles every other format (PNG, JPEG...).
+ *
+ * GenerateMips() box-filters 2x2 blocks of each level into the next. Sizes
+ * round down like GL's own chain (an odd last row/column is dropped), and
+ * SSE2 produces four output pixels per step.
+ *
+ * Block-compressed images (TextureCompressor, CookedTexture) use the same
+ * struct: each level then holds rows of 4x4 blocks instead of texels.
+ * ============================================================================
+ */
+enum class TextureFormat : uint32_t
+{
+    RGBA8 = 0,
+    BC1,        // 8 bytes per 4x4 block - RGB
+    BC3,        // 16 bytes per block - BC1 color + interpolated alpha
+    BC7,        // 16 bytes per block - RGBA (mode 6)
+    Count
+};
+
+struct Image
+{
+    struct Level
+    {
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        std::vector<uint8_t> Pixels;   // GetLevelBytes(Format, Width, Height); empty below a streamed base mip
+    };
+
+    TextureFormat Format = TextureFormat::RGBA8;
+    std::vector<Level> Levels;         // Level 0 = full size
+
+    bool IsValid() const { return !Levels.empty() && !Levels.back().Pixels.empty(); }
+    bool IsCompressed() const { return Format != TextureFormat::RGBA8; }
+    uint32_t GetWidth() const { return Levels.empty() ? 0 : Levels[0].Width; }
+    uint32_t GetHeight() const { return Levels.empty() ? 0 : Levels[0].Height; }
+    uint64_t GetByteSize() const;      // All levels
+
+    // A level smaller than a block still takes a whole block
+    static uint64_t GetLevelBytes(TextureFormat format, uint32_t width, uint32_t height);
+    static const char* GetFormatName(TextureFormat format);
+};
+
+namespace ImageLoader
+{
+    struct Stats
+    {
+        uint32_t Images = 0;
+        uint64_t FileBytes = 0;
+        uint64_t DecodedBytes = 0;     // Level 0
+        uint64_t MipBytes = 0;         // Levels 1+
+        double DecodeMs = 0.0;         // Summed over threads
+        double MipMs = 0.0;
+
+        double GetDecodeMBPerSecond() const { return DecodeMs > 0.0 ? (DecodedBytes / (1024.0 * 1024.0)) / (DecodeMs / 1000.0) : 0.0; }
+        double GetMipMBPerSecond() const { return MipMs > 0.0 ? (MipBytes / (1024.0 * 1024.0)) / (MipMs / 1000.0) : 0.0; }
+    };
+
+    // Level 0 only; false for unknown or corrupt data
+    bool Decode(const void* data, size_t size, Image& image);
+
+    // Decode + GenerateMips, counted in the stats
+    bool Load(const void* data, size_t size, Image& image, bool mips = true);
+    // Same over a mapped file
+    bool Load(const std::string& path, Image& image, bool mips = true);
+
+    // Replaces levels 1+ with a full chain down to 1x1
+    void GenerateMips(Image& image);
+
+    uint32_t GetMipCount(uint32_t width, uint32_t height);
+
+    // Thread-safe accumulators
+    Stats GetStats();
+    void LogStats();
+}
@@ -0,0 +1,88 @@
+#include "IndirectDraw.hpp"
+#include <algorithm>
+#include <thread>
+
+#include <Core/WorkerPool.hpp>
+#include <Rendering/Mesh/Mesh.hpp>
+
+IndirectDrawBuilder::IndirectDrawBuilder() = default;
+IndirectDrawBuilder::~IndirectDrawBuilder() = default;
+
+void IndirectDrawBuilder::Clear()
+{
+    for (auto& bucket : m_Buckets)
+        bucket.clear();
+}
+
+void IndirectDrawBuilder::Add(const glm::mat4& model, const Mesh& mesh)
+{
+    m_Buckets[(size_t)mesh.GetFormat()].push_back({ &model, mesh.GetIndexCount(), mesh.GetFirstIndex(), (int32_t)mesh.GetBaseVertex() });
+}
+
+void IndirectDrawBuilder::Add(const glm::mat4& model, const MeshArena::Allocation& allocation)
+{
+    m_Buckets[(size_t)allocation.Format].push_back({ &model, allocation.IndexCount, allocation.FirstIndex, (int32_t)allocation.BaseVertex });
+}
+
+uint32_t IndirectDrawBuilder::GetCount() const
+{
+    size_t count = 0;
+    for (const auto& bucket : m_Buckets)
+        count += bucket.size();
+    return (uint32_t)count;
+}
+
+void IndirectDrawBuilder::Build(const glm::vec4& color, uint32_t workerCount)
+{
+    uint32_t count = GetCount();
+
+    m_Items.clear();
+    m_Items.reserve(count);
+    for (size_t f = 0; f < (size_t)VertexFormat::Count; f++)
+    {
+        m_Ranges[f] = { (uint32_t)m_Items.size(), (uint32_t)m_Buckets[f].size() };
+        m_Items.insert(m_Items.end(), m_Buckets[f].begin(), m_Buckets[f].end());
+    }
+
+    m_Commands.resize(count);
+    m_Instances.resize(count);
+
+    const uint32_t threads = workerCount ? workerCount : std::max(1u, std::thread::hardware_concurrency());
+    workerCount = std::max(1u, std::min(threads, count / MinItemsPerWorker));
+    if (workerCount <= 1)
+    {
+        BuildRange(0, count, color);
+        return;
+    }
+
+    if (!m_Workers || m_Workers->GetThreadCount() != threads)
+        m_Workers = std::make_unique<WorkerPool>(threads);
+
+    // Disjoint output slots per chunk - no synchronization needed
+    uint32_t chunk = (count + workerCount - 1) / workerCount;
+    m_Workers->Run(workerCount, [&](uint32_t w)
+    {
+        uint32_t begin = w * chunk;
+        if (begin < count)
+            BuildRange(begin, std::min(count, begin + chunk), color);
+    });
+}
+
+void IndirectDrawBuilder::BuildRange(uint32_t begin, uint32_t end, const glm::vec4& color)
+{
+    for (uint32_t i = begin; i < end; i++)
+    {
+        const Item& item = m_Items[i];
+
+        DrawElementsIndirectCommand& cmd = m_Commands[i];
+        cmd.Count = item.IndexCount;
+        cmd.InstanceCount = 1;
+        cmd.FirstIndex = item.FirstIndex;
+        cmd.BaseVertex = item.BaseVertex;
+        cmd.BaseInstance = i;
+
+        InstanceData& instance = m_Instances[i];
+        instance.Model = *item.Model;
+        instance.Color = color;
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <glm/glm.hpp>
+#include <Rendering/Mesh/MeshArena.hpp>
+
+class Mesh;
+class WorkerPool;
+
+// Layout fixed by GL (glMultiDrawElementsIndirect)
+struct DrawElementsIndirectCommand
+{
+    uint32_t Count;
+    uint32_t InstanceCount;
+    uint32_t FirstIndex;
+    int32_t BaseVertex;
+    uint32_t BaseInstance;
+};
+
+// std430 element of the instance SSBO - must match the MDI shader
+struct InstanceData
+{
+    glm::mat4 Model;
+    glm::vec4 Color;
+};
+
+/**
+ * ============================================================================
+ * INDIRECT DRAW BUILDER - ECS -> DrawElementsIndirectCommand[] + InstanceData[]
+ * ============================================================================
+ *
+ * CPU only, no GL. Clear() starts a frame; Add() records the world matrix
+ * pointer and the mesh's arena range for each draw; Build() then fills slot i
+ * of both output arrays from item i, so any range of items can be processed
+ * independently. With workerCount > 1 and enough items, the items are split
+ * into contiguous chunks run on a WorkerPool the builder keeps across frames.
+ *
+ * Command i points at instance i (BaseInstance = i); the MDI vertex shader
+ * turns that into an SSBO index through the arena's draw-ID attribute.
+ *
+ * Items are bucketed by vertex format as they are added; Build() lays the
+ * buckets out back to back so each format is one contiguous range
+ * (GetRange) that draws from a single arena VAO.
+ * ============================================================================
+ */
+class IndirectDrawBuilder
+{
+public:
+    struct Item
+    {
+        const glm::mat4* Model;         // WorldTransformComponent::Matrix
+        uint32_t IndexCount;
+        uint32_t FirstIndex;
+        int32_t BaseVertex;
+    };
+
+    struct Range
+    {
+        uint32_t First = 0;
+        uint32_t Count = 0;
+    };
+
+    IndirectDrawBuilder();
+    ~IndirectDrawBuilder();
+
+    IndirectDrawBuilder(const IndirectDrawBuilder&) = delete;
+    IndirectDrawBuilder& operator=(const IndirectDrawBuilder&) = delete;
+
+    void Clear();
+    void Add(const glm::mat4& model, const Mesh& mesh);
+    // Same from an arena range directly - `model` must outlive Build()
+    void Add(const glm::mat4& model, const MeshArena::Allocation& allocation);
+
+    uint32_t GetCount() const;
+
+    // Fills commands/instances (resized to GetCount()); every draw uses the same color.
+    // workerCount 0 = all cores.
+    void Build(const glm::vec4& color, uint32_t workerCount = 1);
+
+    // Build for items [begin, end) only - the unit of parallel work
+    void BuildRange(uint32_t begin, uint32_t end, const glm::vec4& color);
+
+    const std::vector<DrawElementsIndirectCommand>& GetCommands() const { return m_Commands; }
+    const std::vector<InstanceData>& GetInstances() const { return m_Instances; }
+
+    // Commands/instances of one vertex format after Build()
+    Range GetRange(VertexFormat format) const { return m_Ranges[(size_t)format]; }
+
+    // Below this many items threading costs more than it saves
+    static constexpr uint32_t MinItemsPerWorker = 2048;
+
+private:
+    std::vector<Item> m_Buckets[(size_t)VertexFormat::Count];
+    std::vector<Item> m_Items;     // Buckets concatenated by Build()
+    Range m_Ranges[(size_t)VertexFormat::Count];
+    std::vector<DrawElementsIndirectCommand> m_Commands;
+    std::vector<InstanceData> m_Instances;
+
+    std::unique_ptr<WorkerPool> m_Workers; // Created on the first threaded Build()
+};
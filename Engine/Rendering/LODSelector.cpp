@@ -0,0 +1,22 @@
+#include "LODSelector.hpp"
+
+#include <Rendering/Mesh/Mesh.hpp>
+
+void LODSelector::SetCamera(const glm::vec3& position, const glm::mat4& projection, float viewportHeight)
+{
+    m_CameraPosition = position;
+
+    // projection[1][1] = 1 / tan(fov / 2): a unit at distance 1 spans half the viewport * that
+    m_ProjectionScale = projection[1][1] * viewportHeight * 0.5f;
+}
+
+float LODSelector::GetScreenSpaceError(float objectError, float distance) const
+{
+    return objectError * m_ProjectionScale / std::max(distance, 1e-4f);
+}
+
+uint32_t LODSelector::Select(const Mesh& mesh, const glm::mat4& model, uint32_t currentLOD) const
+{
+    return Select(mesh.GetLODCount(), [&mesh](uint32_t level) { return mesh.GetLODError(level); },
+                  mesh.GetMinAABB(), mesh.GetMaxAABB(), model, currentLOD);
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+class Mesh;
+
+/**
+ * ============================================================================
+ * LOD SELECTOR - screen-space error based level choice
+ * ============================================================================
+ *
+ * CPU only, no GL. SetCamera() takes the camera position, projection and
+ * viewport height once per frame; Select() then projects each level's
+ * object-space error (Mesh::GetLODError) to pixels at the distance of the
+ * mesh's bounding sphere and picks the coarsest level under the threshold.
+ *
+ * Hysteresis: a finer level is taken as soon as the current one exceeds
+ * the threshold, but a coarser level only once its error is below
+ * threshold * (1 - Hysteresis). Objects sitting right at a switch distance
+ * therefore do not pop back and forth every frame.
+ * ============================================================================
+ */
+class LODSelector
+{
+public:
+    float ThresholdPixels = 1.0f;
+    float Hysteresis = 0.25f;
+
+    void SetCamera(const glm::vec3& position, const glm::mat4& projection, float viewportHeight);
+
+    // Pixels covered by an object-space error at the given distance
+    float GetScreenSpaceError(float objectError, float distance) const;
+
+    // model: the mesh's world matrix
+    uint32_t Select(const Mesh& mesh, const glm::mat4& model, uint32_t currentLOD) const;
+
+    // Same choice from plain data: getError(level) is a level's object-space error
+    // (Mesh::GetLODError), minAABB / maxAABB the local bounds of level 0
+    template<typename GetError>
+    uint32_t Select(uint32_t levelCount, GetError&& getError, const glm::vec3& minAABB, const glm::vec3& maxAABB,
+                    const glm::mat4& model, uint32_t currentLOD) const;
+
+private:
+    glm::vec3 m_CameraPosition{ 0.0f };
+    float m_ProjectionScale = 1.0f;   // Pixels per unit at distance 1
+};
+
+template<typename GetError>
+uint32_t LODSelector::Select(uint32_t levelCount, GetError&& getError, const glm::vec3& minAABB, const glm::vec3& maxAABB,
+                             const glm::mat4& model, uint32_t currentLOD) const
+{
+    if (levelCount <= 1) return 0;
+
+    // Bounding sphere in world space - distance to its surface, not its centre
+    glm::vec3 localCenter = (minAABB + maxAABB) * 0.5f;
+    glm::vec3 center = glm::vec3(model * glm::vec4(localCenter, 1.0f));
+
+    // Largest axis scale, parents included
+    float scale = std::max({ glm::length(glm::vec3(model[0])), glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2])) });
+    float radius = glm::length(maxAABB - localCenter) * scale;
+    float distance = glm::length(center - m_CameraPosition) - radius;
+    if (distance <= 0.0f) return 0;
+
+    uint32_t level = std::min(currentLOD, levelCount - 1);
+
+    // Refine while the current level is visibly wrong
+    while (level > 0 && GetScreenSpaceError(getError(level) * scale, distance) > ThresholdPixels)
+        level--;
+
+    // Coarsen only with margin
+    const float coarsenThreshold = ThresholdPixels * (1.0f - Hysteresis);
+    while (level + 1 < levelCount && GetScreenSpaceError(getError(level + 1) * scale, distance) <= coarsenThreshold)
+        level++;
+
+    return level;
+}
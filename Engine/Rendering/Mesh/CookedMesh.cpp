@@ -0,0 +1,323 @@
+#include "CookedMesh.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <thread>
+
+#include "Mesh.hpp"
+#include "MeshOptimizer.hpp"
+#include "MeshSimplifier.hpp"
+#include <Core/Log.hpp>
+#include <Core/Resources/MappedFile.hpp>
+
+namespace
+{
+    constexpr uint64_t BLOCK_ALIGNMENT = 16;
+
+    uint64_t AlignUp(uint64_t value)
+    {
+        return (value + BLOCK_ALIGNMENT - 1) & ~(BLOCK_ALIGNMENT - 1);
+    }
+
+    CookedMesh::Level CookLevel(const std::vector<Vertex>& source, const std::vector<uint32_t>& sourceIndices,
+                                VertexFormat format, float error)
+    {
+        // Same processing as the Mesh constructor, minus the upload
+        std::vector<Vertex> vertices = source;
+        CookedMesh::Level level;
+        level.Indices = sourceIndices;
+        level.Error = error;
+        MeshOptimizer::Optimize(vertices, level.Indices);
+
+        level.VertexCount = (uint32_t)vertices.size();
+        level.Vertices.resize((size_t)level.VertexCount * VertexEncoder::GetLayout(format).Stride);
+        VertexEncoder::Encode(format, vertices.data(), level.VertexCount, level.Vertices.data());
+        return level;
+    }
+
+    // Level i's encoded vertices / indices come from getLevel(i) -> CookedMeshLOD + pointers
+    template<typename GetLevel>
+    std::shared_ptr<Mesh> CreateLevels(const CookedMeshHeader& header, GetLevel getLevel)
+    {
+        const VertexFormat format = (VertexFormat)header.Format;
+        glm::vec3 minAABB(header.MinAABB[0], header.MinAABB[1], header.MinAABB[2]);
+        glm::vec3 maxAABB(header.MaxAABB[0], header.MaxAABB[1], header.MaxAABB[2]);
+
+        std::shared_ptr<Mesh> mesh;
+        for (uint32_t i = 0; i < header.LODCount; i++)
+        {
+            const void* vertices = nullptr;
+            const uint32_t* indices = nullptr;
+            CookedMeshLOD lod = getLevel(i, vertices, indices);
+
+            auto level = Mesh::CreateEncoded(format, vertices, lod.VertexCount, indices, lod.IndexCount, minAABB, maxAABB);
+            if (!level->IsValid())
+            {
+                if (!mesh) return nullptr;
+                break;
+            }
+
+            if (!mesh) mesh = level;
+            else mesh->AddLOD(level, lod.Error);
+        }
+        return mesh;
+    }
+
+    // Header, LOD table and every index of a mapped file; nullptr if anything is out of range
+    const CookedMeshHeader* Validate(const std::string& path, const char* data, uint64_t size)
+    {
+        if (size < sizeof(CookedMeshHeader))
+        {
+            CORE_ERROR("[CookedMesh] '{0}' is truncated", path);
+            return nullptr;
+        }
+
+        const CookedMeshHeader& header = *(const CookedMeshHeader*)data;
+        if (header.Magic != CookedMeshHeader::MagicValue || header.Version != CookedMeshHeader::CurrentVersion ||
+            header.Format >= (uint32_t)VertexFormat::Count || header.LODCount == 0 ||
+            sizeof(CookedMeshHeader) + (uint64_t)header.LODCount * sizeof(CookedMeshLOD) > size)
+        {
+            CORE_ERROR("[CookedMesh] '{0}' is not a version {1} cooked mesh", path, CookedMeshHeader::CurrentVersion);
+            return nullptr;
+        }
+
+        const uint64_t stride = VertexEncoder::GetLayout((VertexFormat)header.Format).Stride;
+        const CookedMeshLOD* table = (const CookedMeshLOD*)(data + sizeof(CookedMeshHeader));
+        for (uint32_t i = 0; i < header.LODCount; i++)
+        {
+            const CookedMeshLOD& lod = table[i];
+            bool inside = lod.VertexOffset + lod.VertexCount * stride <= size &&
+                          lod.IndexOffset + (uint64_t)lod.IndexCount * sizeof(uint32_t) <= size;
+            bool aligned = lod.VertexOffset % BLOCK_ALIGNMENT == 0 && lod.IndexOffset % BLOCK_ALIGNMENT == 0;
+            if (!inside || !aligned || lod.VertexCount == 0 || lod.IndexCount == 0)
+            {
+                CORE_ERROR("[CookedMesh] '{0}' has a corrupt LOD table", path);
+                return nullptr;
+            }
+
+            // An index past the vertex block would read arena memory of another mesh
+            const uint32_t* indices = (const uint32_t*)(data + lod.IndexOffset);
+            uint32_t maxIndex = 0;
+            for (uint32_t j = 0; j < lod.IndexCount; j++)
+                maxIndex = std::max(maxIndex, indices[j]);
+            if (maxIndex >= lod.VertexCount)
+            {
+                CORE_ERROR("[CookedMesh] '{0}' LOD {1} indexes vertex {2} of {3}", path, i, maxIndex, lod.VertexCount);
+                return nullptr;
+            }
+        }
+        return &header;
+    }
+}
+
+bool CookedMesh::Build(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                       VertexFormat format, uint32_t lodLevels, Data& data, double importMs)
+{
+    auto start = std::chrono::steady_clock::now();
+    if (vertices.empty() || indices.empty() || format >= VertexFormat::Count) return false;
+
+    std::vector<Level>& levels = data.Levels;
+    levels.clear();
+    levels.push_back(CookLevel(vertices, indices, format, 0.0f));
+    for (const MeshSimplifier::Result& lod : MeshSimplifier::BuildChain(vertices, indices, lodLevels))
+        levels.push_back(CookLevel(vertices, lod.Indices, format, lod.Error));
+
+    CookedMeshHeader& header = data.Header;
+    header = CookedMeshHeader();
+    header.Format = (uint32_t)format;
+    header.LODCount = (uint32_t)levels.size();
+    header.RequestedLODs = lodLevels;
+
+    glm::vec3 minAABB = vertices[0].Position, maxAABB = vertices[0].Position;
+    for (const Vertex& v : vertices)
+    {
+        minAABB = glm::min(minAABB, v.Position);
+        maxAABB = glm::max(maxAABB, v.Position);
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        header.MinAABB[i] = minAABB[i];
+        header.MaxAABB[i] = maxAABB[i];
+    }
+
+    double cookMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    header.ImportMs = (float)(importMs + cookMs);
+    return true;
+}
+
+bool CookedMesh::Write(const std::string& path, const Data& data, Stats* stats)
+{
+    auto start = std::chrono::steady_clock::now();
+    const CookedMeshHeader& header = data.Header;
+    const std::vector<Level>& levels = data.Levels;
+    if (levels.empty() || header.LODCount != levels.size()) return false;
+
+    // Block offsets
+    std::vector<CookedMeshLOD> table(levels.size());
+    uint64_t offset = AlignUp(sizeof(CookedMeshHeader) + table.size() * sizeof(CookedMeshLOD));
+    for (size_t i = 0; i < levels.size(); i++)
+    {
+        table[i].VertexOffset = offset;
+        table[i].VertexCount = levels[i].VertexCount;
+        offset = AlignUp(offset + levels[i].Vertices.size());
+
+        table[i].IndexOffset = offset;
+        table[i].IndexCount = (uint32_t)levels[i].Indices.size();
+        offset = AlignUp(offset + levels[i].Indices.size() * sizeof(uint32_t));
+
+        table[i].Error = levels[i].Error;
+    }
+
+    // Written beside the live file and renamed over it: readers never see a partial file, and two
+    // threads cooking the same source each write their own temp file (the last rename wins)
+    const std::string tmpPath = path + "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + ".tmp";
+    std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        CORE_ERROR("[CookedMesh] Cannot write '{0}'", tmpPath);
+        return false;
+    }
+
+    static const char s_Padding[BLOCK_ALIGNMENT] = {};
+    auto pad = [&file]()
+    {
+        uint64_t position = (uint64_t)file.tellp();
+        file.write(s_Padding, (std::streamsize)(AlignUp(position) - position));
+    };
+
+    file.write((const char*)&header, sizeof(header));
+    file.write((const char*)table.data(), (std::streamsize)(table.size() * sizeof(CookedMeshLOD)));
+    pad();
+    for (const Level& level : levels)
+    {
+        file.write((const char*)level.Vertices.data(), (std::streamsize)level.Vertices.size());
+        pad();
+        file.write((const char*)level.Indices.data(), (std::streamsize)(level.Indices.size() * sizeof(uint32_t)));
+        pad();
+    }
+
+    file.close();
+    std::error_code error;
+    if (!file)
+    {
+        CORE_ERROR("[CookedMesh] Write to '{0}' failed", tmpPath);
+        std::filesystem::remove(tmpPath, error);
+        return false;
+    }
+
+    std::filesystem::rename(tmpPath, path, error);
+    if (error)
+    {
+        CORE_ERROR("[CookedMesh] Cannot replace '{0}': {1}", path, error.message());
+        std::filesystem::remove(tmpPath, error);
+        return false;
+    }
+
+    if (stats)
+    {
+        stats->Bytes = offset;
+        stats->Ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        stats->ImportMs = header.ImportMs;
+    }
+
+    CORE_INFO("[CookedMesh] Cooked '{0}': {1} LODs, {2} bytes ({3} ms import + cook)", path, levels.size(), offset, header.ImportMs);
+    return true;
+}
+
+bool CookedMesh::Cook(const std::string& path, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                      VertexFormat format, uint32_t lodLevels, double importMs, Stats* stats)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    Data data;
+    if (!Build(vertices, indices, format, lodLevels, data, importMs) || !Write(path, data, stats)) return false;
+
+    if (stats)
+    {
+        stats->Ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        stats->ImportMs = importMs;
+    }
+    return true;
+}
+
+std::shared_ptr<Mesh> CookedMesh::Upload(const Data& data)
+{
+    if (data.Levels.empty() || data.Header.LODCount != data.Levels.size()) return nullptr;
+
+    return CreateLevels(data.Header, [&data](uint32_t i, const void*& vertices, const uint32_t*& indices)
+    {
+        const Level& level = data.Levels[i];
+        vertices = level.Vertices.data();
+        indices = level.Indices.data();
+
+        CookedMeshLOD lod;
+        lod.VertexCount = level.VertexCount;
+        lod.IndexCount = (uint32_t)level.Indices.size();
+        lod.Error = level.Error;
+        return lod;
+    });
+}
+
+std::shared_ptr<Mesh> CookedMesh::Load(const std::string& path, Stats* stats)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    MappedFile file(path);
+    if (!file.IsOpen()) return nullptr;
+
+    const char* data = file.GetData();
+    const uint64_t size = file.GetSize();
+
+    const CookedMeshHeader* validated = Validate(path, data, size);
+    if (!validated) return nullptr;
+
+    const CookedMeshHeader& header = *validated;
+    const CookedMeshLOD* table = (const CookedMeshLOD*)(data + sizeof(CookedMeshHeader));
+
+    // Straight from the mapping into the arena
+    std::shared_ptr<Mesh> mesh = CreateLevels(header, [data, table](uint32_t i, const void*& vertices, const uint32_t*& indices)
+    {
+        vertices = data + table[i].VertexOffset;
+        indices = (const uint32_t*)(data + table[i].IndexOffset);
+        return table[i];
+    });
+    if (!mesh) return nullptr;
+
+    if (stats)
+    {
+        stats->Bytes = size;
+        stats->Ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        stats->ImportMs = header.ImportMs;
+    }
+    return mesh;
+}
+
+bool CookedMesh::Verify(const std::string& path)
+{
+    MappedFile file(path);
+    return file.IsOpen() && Validate(path, file.GetData(), file.GetSize()) != nullptr;
+}
+
+std::string CookedMesh::GetCookedPath(const std::string& sourcePath, VertexFormat format, uint32_t lodLevels)
+{
+    return sourcePath + "." + VertexEncoder::GetFormatName(format) + ".lod" + std::to_string(lodLevels) + Extension;
+}
+
+bool CookedMesh::IsUpToDate(const std::string& cookedPath, const std::string& sourcePath,
+                            VertexFormat format, uint32_t lodLevels)
+{
+    std::error_code error;
+    auto cookedTime = std::filesystem::last_write_time(cookedPath, error);
+    if (error) return false;
+    auto sourceTime = std::filesystem::last_write_time(sourcePath, error);
+    if (!error && sourceTime > cookedTime) return false;
+
+    std::ifstream file(cookedPath, std::ios::binary);
+    CookedMeshHeader header;
+    if (!file.read((char*)&header, sizeof(header))) return false;
+
+    return header.Magic == CookedMeshHeader::MagicValue && header.Version == CookedMeshHeader::CurrentVersion &&
+           header.Format == (uint32_t)format && header.RequestedLODs == lodLevels;
+}
@@ -0,0 +1,121 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Rendering/Mesh/VertexLayout.hpp>
+
+struct Vertex;
+class Mesh;
+
+/**
+ * ============================================================================
+ * COOKED MESH - engine-native binary mesh (.cmesh)
+ * ============================================================================
+ *
+ * Layout (little endian, every block 16-byte aligned):
+ *
+ *   CookedMeshHeader                      64 bytes
+ *   CookedMeshLOD[LODCount]               32 bytes each, level 0 first
+ *   per level: vertex block, index block  offsets from the LOD table
+ *
+ * Vertex blocks are already optimized (MeshOptimizer) and encoded in the
+ * header's VertexFormat; index blocks are uint32. Load() maps the file and
+ * hands the block pointers straight to MeshArena::AllocateEncoded, so the
+ * data goes from the page cache to glBufferSubData without a std::vector
+ * copy; the only CPU work is a range check of the indices.
+ *
+ * Cook() runs the full import pipeline (optimize, LOD chain, encode) once
+ * and renames a temp file over the old one, so readers only ever map
+ * complete files. The header remembers how long importing + cooking took
+ * so loads can report the saving. Build() / Upload() are the same pipeline
+ * without the file, for when it cannot be written: the CPU work stays on
+ * the worker and the main thread only uploads.
+ * ============================================================================
+ */
+struct CookedMeshHeader
+{
+    static constexpr uint32_t MagicValue = 0x48534D43; // "CMSH"
+    static constexpr uint32_t CurrentVersion = 1;
+
+    uint32_t Magic = MagicValue;
+    uint32_t Version = CurrentVersion;
+    uint32_t Format = 0;          // VertexFormat
+    uint32_t LODCount = 0;        // Level 0 included
+    uint32_t RequestedLODs = 0;   // lodLevels passed to Cook (up-to-date check)
+    float ImportMs = 0.0f;        // Source import + cook time
+    float MinAABB[3] = {};
+    float MaxAABB[3] = {};
+    uint32_t Reserved[4] = {};
+};
+static_assert(sizeof(CookedMeshHeader) == 64, "CookedMeshHeader is part of the file format");
+
+struct CookedMeshLOD
+{
+    uint64_t VertexOffset = 0;
+    uint64_t IndexOffset = 0;
+    uint32_t VertexCount = 0;
+    uint32_t IndexCount = 0;
+    float Error = 0.0f;
+    uint32_t Reserved = 0;
+};
+static_assert(sizeof(CookedMeshLOD) == 32, "CookedMeshLOD is part of the file format");
+
+namespace CookedMesh
+{
+    constexpr const char* Extension = ".cmesh";
+
+    struct Stats
+    {
+        uint64_t Bytes = 0;
+        double Ms = 0.0;
+        double ImportMs = 0.0;    // From the header (Load) or measured by the caller (Cook)
+
+        double GetMBPerSecond() const { return Ms > 0.0 ? (Bytes / (1024.0 * 1024.0)) / (Ms / 1000.0) : 0.0; }
+    };
+
+    struct Level
+    {
+        std::vector<uint8_t> Vertices;   // Encoded in the header's format
+        std::vector<uint32_t> Indices;
+        uint32_t VertexCount = 0;
+        float Error = 0.0f;
+    };
+
+    // A cooked mesh in memory - exactly what Cook() writes
+    struct Data
+    {
+        CookedMeshHeader Header;
+        std::vector<Level> Levels;
+    };
+
+    // Optimizes, builds lodLevels LODs and encodes (no GL - safe on worker threads).
+    // importMs is stored in the header (time spent producing vertices/indices).
+    bool Build(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+               VertexFormat format, uint32_t lodLevels, Data& data, double importMs = 0.0);
+
+    // Writes `data` to `path` through a temp file
+    bool Write(const std::string& path, const Data& data, Stats* stats = nullptr);
+
+    // Build() + Write()
+    bool Cook(const std::string& path, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+              VertexFormat format, uint32_t lodLevels, double importMs = 0.0, Stats* stats = nullptr);
+
+    // Main thread: uploads built levels as-is, no CPU processing
+    std::shared_ptr<Mesh> Upload(const Data& data);
+
+    // nullptr if the file is missing, truncated, from another version or indexes past its vertices
+    std::shared_ptr<Mesh> Load(const std::string& path, Stats* stats = nullptr);
+
+    // Load()'s checks without the upload (no GL - safe on worker threads)
+    bool Verify(const std::string& path);
+
+    // <sourcePath>.<format>.lod<N>.cmesh - one artifact per cook setting, so
+    // loads with different settings never overwrite each other's file
+    std::string GetCookedPath(const std::string& sourcePath, VertexFormat format, uint32_t lodLevels);
+
+    // True if `cookedPath` exists, is newer than `sourcePath` and was cooked with these settings
+    bool IsUpToDate(const std::string& cookedPath, const std::string& sourcePath,
+                    VertexFormat format, uint32_t lodLevels);
+}
@@ -2,10 +2,136 @@
 #include <vector>
 #include <cmath>
 
+#include "MeshOptimizer.hpp"
+#include "MeshSimplifier.hpp"
+#include <Core/Log.hpp>
+
+Mesh::Mesh(const std::vector<Vertex>& sourceVertices, const std::vector<uint32_t>& sourceIndices, VertexFormat format)
+{
+    // Reorder for the post-transform cache, overdraw and linear vertex fetch
+    std::vector<Vertex> vertices = sourceVertices;
+    std::vector<uint32_t> indices = sourceIndices;
+    MeshOptimizer::Optimize(vertices, indices);
+
+    // Geometry lives in the shared arena - the mesh only keeps its range
+    m_Allocation = MeshArena::Allocate(format, vertices.data(), (uint32_t)vertices.size(),
+                                       indices.data(), (uint32_t)indices.size());
+
+    // Calculate AABB
+    if (!vertices.empty())
+    {
+        m_MinAABB = vertices[0].Position;
+        m_MaxAABB = vertices[0].Position;
+        for (const auto& v : vertices)
+        {
+            m_MinAABB = glm::min(m_MinAABB, v.Position);
+            m_MaxAABB = glm::max(m_MaxAABB, v.Position);
+        }
+    }
+}
+
+// ============================================================================
+// Primitive cache - one shared mesh per (type, parameter)
+// ============================================================================
+// Primitives are immutable, so every entity asking for a cube can share the
+// same arena range. Entries are weak (PrimitiveCache): once the last
+// MeshComponent lets go, the mesh is destroyed and its arena range freed;
+// the next request rebuilds.
+namespace
+{
+    PrimitiveCache<Mesh> s_PrimitiveCache;
+
+    uint64_t PrimitiveKey(Mesh::PrimitiveType type, uint32_t param)
+    {
+        return ((uint64_t)type << 32) | param;
+    }
+}
+
+template<typename BuildFn>
+static std::shared_ptr<Mesh> GetOrBuildPrimitive(Mesh::PrimitiveType type, uint32_t param, BuildFn build)
+{
+    return s_PrimitiveCache.GetOrBuild(PrimitiveKey(type, param), build);
+}
+
+std::shared_ptr<Mesh> Mesh::CreateCube()
+{
+    return GetOrBuildPrimitive(PrimitiveType::Cube, 0, &Mesh::BuildCube);
+}
+
+std::shared_ptr<Mesh> Mesh::CreateTriangle3D()
+{
+    return GetOrBuildPrimitive(PrimitiveType::Triangle3D, 0, &Mesh::BuildTriangle3D);
+}
+
+std::shared_ptr<Mesh> Mesh::CreateCircle(uint32_t segments)
+{
+    if (segments < 3) segments = 3;
+    return GetOrBuildPrimitive(PrimitiveType::Circle, segments, [segments]() { return Mesh::BuildCircle(segments); });
+}
+
+std::shared_ptr<Mesh> Mesh::CreatePlane()
+{
+    return GetOrBuildPrimitive(PrimitiveType::Plane, 0, &Mesh::BuildPlane);
+}
+
+std::shared_ptr<Mesh> Mesh::Create(const std::vector<Vertex>& vertices,
+                                   const std::vector<uint32_t>& indices,
+                                   VertexFormat format,
+                                   uint32_t lodLevels)
+{
+    auto mesh = std::shared_ptr<Mesh>(new Mesh(vertices, indices, format));
+    if (lodLevels > 0 && mesh->IsValid())
+        mesh->BuildLODs(vertices, indices, lodLevels);
+    return mesh;
+}
+
+std::shared_ptr<Mesh> Mesh::CreateEncoded(VertexFormat format, const void* encodedVertices, uint32_t vertexCount,
+                                          const uint32_t* indices, uint32_t indexCount,
+                                          const glm::vec3& minAABB, const glm::vec3& maxAABB)
+{
+    auto mesh = std::shared_ptr<Mesh>(new Mesh());
+    mesh->m_Allocation = MeshArena::AllocateEncoded(format, encodedVertices, vertexCount, indices, indexCount);
+    mesh->m_MinAABB = minAABB;
+    mesh->m_MaxAABB = maxAABB;
+    return mesh;
+}
+
+void Mesh::BuildLODs(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, uint32_t levels)
+{
+    for (const MeshSimplifier::Result& level : MeshSimplifier::BuildChain(vertices, indices, levels))
+    {
+        auto lod = std::shared_ptr<Mesh>(new Mesh(vertices, level.Indices, GetFormat()));
+        if (!lod->IsValid())
+            break;
+
+        AddLOD(lod, level.Error);
+    }
+}
+
+void Mesh::AddLOD(const std::shared_ptr<Mesh>& level, float error)
+{
+    if (level && level.get() != this)
+        m_LODs.push_back({ level, error });
+}
+
+void Mesh::Swap(Mesh& other)
+{
+    std::swap(m_Allocation, other.m_Allocation);
+    std::swap(m_Type, other.m_Type);
+    std::swap(m_MinAABB, other.m_MinAABB);
+    std::swap(m_MaxAABB, other.m_MaxAABB);
+    m_LODs.swap(other.m_LODs);
+}
+
+Mesh::PrimitiveCacheStats Mesh::GetPrimitiveCacheStats()
+{
+    return s_PrimitiveCache.GetStats();
+}
+
 //
 // ---------- 3D CUBE ----------
 //
-std::shared_ptr<Mesh> Mesh::CreateCube()
+std::shared_ptr<Mesh> Mesh::BuildCube()
 {
     std::vector<Vertex> vertices =
     {
@@ -85,7 +211,7 @@ std::shared_ptr<Mesh> Mesh::CreateCube()
         20,21,22, 22,23,20
     };
 
-    auto mesh = std::shared_ptr<Mesh>(new Mesh(vertices, indices));
+    auto mesh = std::shared_ptr<Mesh>(new Mesh(vertices, indices, PrimitiveFormat));
     mesh->m_Type = PrimitiveType::Cube;
     return mesh;
 }
@@ -94,7 +220,7 @@ std::shared_ptr<Mesh> Mesh::CreateCube()
 //
 // ---------- 3D PYRAMID (Triangle3D) ----------
 //
-std::shared_ptr<Mesh> Mesh::CreateTriangle3D()
+std::shared_ptr<Mesh> Mesh::BuildTriangle3D()
 {
     // Creates a pyramid with a square base and triangular sides
     // Each side face needs its own normal for proper lighting
@@ -134,7 +260,7 @@ std::shared_ptr<Mesh> Mesh::CreateTriangle3D()
         3, 0, 7    // Left side:  uses apex vertex 7
     };
 
-    auto mesh = std::shared_ptr<Mesh>(new Mesh(vertices, indices));
+    auto mesh = std::shared_ptr<Mesh>(new Mesh(vertices, indices, PrimitiveFormat));
     mesh->m_Type = PrimitiveType::Triangle3D;
     return mesh;
 }
@@ -142,12 +268,10 @@ std::shared_ptr<Mesh> Mesh::CreateTriangle3D()
 //
 // ---------- CIRCLE (Flat Disc) ----------
 //
-std::shared_ptr<Mesh> Mesh::CreateCircle(uint32_t segments)
+std::shared_ptr<Mesh> Mesh::BuildCircle(uint32_t segments)
 {
     // Creates a flat circular disc using a triangle fan
-    // segments: Number of edge segments (minimum 3)
-    
-    if (segments < 3) segments = 3;
+    // segments: Number of edge segments (clamped to >= 3 by CreateCircle)
 
     std::vector<Vertex> vertices;
     std::vector<uint32_t> indices;
@@ -175,7 +299,7 @@ std::shared_ptr<Mesh> Mesh::CreateCircle(uint32_t segments)
         indices.push_back(i + 1);
     }
 
-    auto mesh = std::shared_ptr<Mesh>(new Mesh(vertices, indices));
+    auto mesh = std::shared_ptr<Mesh>(new Mesh(vertices, indices, PrimitiveFormat));
     mesh->m_Type = PrimitiveType::Circle;
     return mesh;
 }
@@ -183,7 +307,7 @@ std::shared_ptr<Mesh> Mesh::CreateCircle(uint32_t segments)
 //
 // ---------- PLANE (1x1 Quad) ----------
 //
-std::shared_ptr<Mesh> Mesh::CreatePlane()
+std::shared_ptr<Mesh> Mesh::BuildPlane()
 {
     std::vector<Vertex> vertices =
     {
@@ -195,7 +319,7 @@ std::shared_ptr<Mesh> Mesh::CreatePlane()
 
     std::vector<uint32_t> indices = { 0, 1, 2, 2, 3, 0 };
 
-    auto mesh = std::shared_ptr<Mesh>(new Mesh(vertices, indices));
+    auto mesh = std::shared_ptr<Mesh>(new Mesh(vertices, indices, PrimitiveFormat));
     mesh->m_Type = PrimitiveType::Plane;
     return mesh;
 }
\ No newline at end of file
@@ -5,7 +5,8 @@
 #include <vector>
 #include <cstdint>
 #include <glm/glm.hpp>
-#include <Rendering/Buffers/VertexArray.hpp>
+#include <Rendering/Mesh/MeshArena.hpp>
+#include <Rendering/Mesh/PrimitiveCache.hpp>
 
 struct Vertex
 {
@@ -26,67 +27,90 @@ public:
     };
 
     // New 3D mesh creation API
+    // Primitives are cached: repeated calls with the same parameters return
+    // the same shared mesh (O(1) after the first call, one arena range total)
     static std::shared_ptr<Mesh> CreateCube();
     static std::shared_ptr<Mesh> CreateTriangle3D();
     static std::shared_ptr<Mesh> CreateCircle(uint32_t segments = 32);
     static std::shared_ptr<Mesh> CreatePlane();
 
-    VertexArray* GetVertexArray() const { return m_VertexArray.get(); }
-    uint32_t GetIndexCount() const { return m_IndexCount; }
+    // Primitives are unit-sized - half positions and 10-bit normals lose
+    // nothing visible there, at half the bytes of Float32
+    static constexpr VertexFormat PrimitiveFormat = VertexFormat::Quantized;
+    // Imported models and user geometry: arbitrary extents, so full precision
+    // unless the caller opts into a compressed format
+    static constexpr VertexFormat DefaultFormat = VertexFormat::Float32;
+
+    // Geometry that is already optimized and encoded in `format` (cooked data) -
+    // uploaded as-is, no CPU processing
+    static std::shared_ptr<Mesh> CreateEncoded(VertexFormat format, const void* encodedVertices, uint32_t vertexCount,
+                                               const uint32_t* indices, uint32_t indexCount,
+                                               const glm::vec3& minAABB, const glm::vec3& maxAABB);
+
+    // Uncached mesh from raw geometry, stored in the arena of `format`.
+    // lodLevels > 0 also builds that many simplified levels (MeshSimplifier),
+    // each targeting half the triangles of the previous one.
+    static std::shared_ptr<Mesh> Create(const std::vector<Vertex>& vertices,
+                                        const std::vector<uint32_t>& indices,
+                                        VertexFormat format = DefaultFormat,
+                                        uint32_t lodLevels = 0);
+
+    using PrimitiveCacheStats = ::PrimitiveCacheStats;
+    static PrimitiveCacheStats GetPrimitiveCacheStats();
+
+    ~Mesh() { MeshArena::Free(m_Allocation); }
+
+    Mesh(const Mesh&) = delete;
+    Mesh& operator=(const Mesh&) = delete;
+
+    bool IsValid() const { return m_Allocation.IsValid(); }
+    uint32_t GetIndexCount() const { return m_Allocation.IndexCount; }
+    uint32_t GetFirstIndex() const { return m_Allocation.FirstIndex; }
+    uint32_t GetBaseVertex() const { return m_Allocation.BaseVertex; }
+    VertexFormat GetFormat() const { return m_Allocation.Format; }
     PrimitiveType GetType() const { return m_Type; }
 
     const glm::vec3& GetMinAABB() const { return m_MinAABB; }
     const glm::vec3& GetMaxAABB() const { return m_MaxAABB; }
 
+    // LOD chain - level 0 is this mesh, coarser levels are separate arena meshes
+    uint32_t GetLODCount() const { return 1 + (uint32_t)m_LODs.size(); }
+    const Mesh& GetLOD(uint32_t level) const { return level == 0 || level > m_LODs.size() ? *this : *m_LODs[level - 1].Level; }
+    // Object-space geometric error of a level against level 0
+    float GetLODError(uint32_t level) const { return level == 0 || level > m_LODs.size() ? 0.0f : m_LODs[level - 1].Error; }
+    // Appends the next coarser level (loaders that bring their own chain)
+    void AddLOD(const std::shared_ptr<Mesh>& level, float error);
+    // Exchanges all geometry with `other`. Hot reload swaps in place, so every
+    // holder of this mesh draws the new data from the next frame on.
+    void Swap(Mesh& other);
+
 private:
-    Mesh(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices)
-    {
-        m_IndexCount = (uint32_t)indices.size();
-
-        m_VertexArray = std::make_unique<VertexArray>();
-
-        // Create buffers with unique_ptr ownership
-        auto vb = std::make_unique<VertexBuffer>(vertices.data(), vertices.size() * sizeof(Vertex));
-        auto ib = std::make_unique<IndexBuffer>(indices.data(), (uint32_t)indices.size());
-
-        m_VertexArray->Bind();
-        // Transfer ownership to prevent VBO deletion (Update: AddVertexBuffer now just stores/binds, layout is set below)
-        m_VertexArray->AddVertexBuffer(std::move(vb));
-
-        // Position
-        glEnableVertexAttribArray(0);
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Position));
-
-        // Normal
-        glEnableVertexAttribArray(1);
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Normal));
-
-        // Transfer ownership to VertexArray (prevents memory leak)
-        m_VertexArray->SetIndexBuffer(std::move(ib));
-
-        // Calculate AABB
-        if (!vertices.empty())
-        {
-            m_MinAABB = vertices[0].Position;
-            m_MaxAABB = vertices[0].Position;
-            for (const auto& v : vertices)
-            {
-                m_MinAABB.x = std::min(m_MinAABB.x, v.Position.x);
-                m_MinAABB.y = std::min(m_MinAABB.y, v.Position.y);
-                m_MinAABB.z = std::min(m_MinAABB.z, v.Position.z);
-
-                m_MaxAABB.x = std::max(m_MaxAABB.x, v.Position.x);
-                m_MaxAABB.y = std::max(m_MaxAABB.y, v.Position.y);
-                m_MaxAABB.z = std::max(m_MaxAABB.z, v.Position.z);
-            }
-        }
-    }
+    // Uncached builders behind the Create* functions
+    static std::shared_ptr<Mesh> BuildCube();
+    static std::shared_ptr<Mesh> BuildTriangle3D();
+    static std::shared_ptr<Mesh> BuildCircle(uint32_t segments);
+    static std::shared_ptr<Mesh> BuildPlane();
+
+    Mesh() = default;
+
+    // Optimizes a copy of the geometry (MeshOptimizer), then uploads it to the arena
+    Mesh(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+         VertexFormat format = DefaultFormat);
+
+    void BuildLODs(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, uint32_t levels);
 
 private:
-    std::unique_ptr<VertexArray> m_VertexArray;
-    uint32_t m_IndexCount = 0;
+    struct LOD
+    {
+        std::shared_ptr<Mesh> Level;
+        float Error = 0.0f;
+    };
+
+    MeshArena::Allocation m_Allocation;
     PrimitiveType m_Type = PrimitiveType::None;
 
     glm::vec3 m_MinAABB{ 0.0f };
     glm::vec3 m_MaxAABB{ 0.0f };
+
+    std::vector<LOD> m_LODs;
 };
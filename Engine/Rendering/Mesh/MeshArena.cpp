@@ -0,0 +1,232 @@
+#include "MeshArena.hpp"
+#include <glad/glad.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "Mesh.hpp"
+#include <Core/Log.hpp>
+#include <Core/OffsetAllocator.hpp>
+#include <Rendering/GLState.hpp>
+#include <Rendering/Buffers/VertexArray.hpp>
+
+namespace
+{
+    constexpr uint32_t INITIAL_VERTEX_CAPACITY = 64 * 1024;
+    constexpr uint32_t INITIAL_INDEX_CAPACITY = 192 * 1024;
+
+    struct Arena
+    {
+        std::unique_ptr<VertexArray> VAO;
+        OffsetAllocator VertexAlloc;
+        OffsetAllocator IndexAlloc;
+        uint32_t Meshes = 0;
+        uint32_t Grows = 0;
+    };
+
+    Arena s_Arenas[(size_t)VertexFormat::Count];
+    std::unique_ptr<VertexBuffer> s_DrawIDs;   // Shared by every arena VAO
+    std::vector<uint8_t> s_EncodeScratch;
+
+    void CopyBuffer(uint32_t src, uint32_t dst, uint32_t bytes)
+    {
+        GLState::BindBuffer(GL_COPY_READ_BUFFER, src);
+        GLState::BindBuffer(GL_COPY_WRITE_BUFFER, dst);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, bytes);
+    }
+
+    void Upload(uint32_t buffer, uint32_t offsetBytes, uint32_t sizeBytes, const void* data)
+    {
+        // COPY_WRITE so the upload never touches the VAO's element buffer binding
+        GLState::BindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, offsetBytes, sizeBytes, data);
+    }
+
+    void GrowVertices(Arena& arena, VertexFormat format, uint32_t minCapacity)
+    {
+        const VertexLayout& layout = VertexEncoder::GetLayout(format);
+        uint32_t oldCapacity = arena.VertexAlloc.GetCapacity();
+        uint32_t newCapacity = std::max({ oldCapacity * 2, minCapacity, INITIAL_VERTEX_CAPACITY });
+
+        auto vb = std::make_unique<VertexBuffer>(nullptr, newCapacity * layout.Stride);
+        if (VertexBuffer* old = arena.VAO->GetVertexBuffer())
+            CopyBuffer(old->GetRendererID(), vb->GetRendererID(), oldCapacity * layout.Stride);
+
+        // Binds VAO + new VBO; the old buffer is released here
+        arena.VAO->AddVertexBuffer(std::move(vb));
+        layout.Apply();
+
+        arena.VertexAlloc.Grow(newCapacity);
+        if (oldCapacity > 0) arena.Grows++;
+    }
+
+    void GrowIndices(Arena& arena, uint32_t minCapacity)
+    {
+        uint32_t oldCapacity = arena.IndexAlloc.GetCapacity();
+        uint32_t newCapacity = std::max({ oldCapacity * 2, minCapacity, INITIAL_INDEX_CAPACITY });
+
+        // IndexBuffer binds GL_ELEMENT_ARRAY_BUFFER on creation - make sure it lands in our VAO
+        arena.VAO->Bind();
+        auto ib = std::make_unique<IndexBuffer>(nullptr, newCapacity);
+        if (IndexBuffer* old = arena.VAO->GetIndexBuffer())
+            CopyBuffer(old->GetRendererID(), ib->GetRendererID(), oldCapacity * (uint32_t)sizeof(uint32_t));
+
+        arena.VAO->SetIndexBuffer(std::move(ib));
+
+        arena.IndexAlloc.Grow(newCapacity);
+        if (oldCapacity > 0) arena.Grows++;
+    }
+
+    Arena& EnsureInitialized(VertexFormat format)
+    {
+        Arena& arena = s_Arenas[(size_t)format];
+        if (arena.VAO) return arena;
+
+        if (!s_DrawIDs)
+        {
+            // Draw IDs 0..MaxDrawIDs-1, stepped once per instance
+            std::vector<uint32_t> ids(MeshArena::MaxDrawIDs);
+            for (uint32_t i = 0; i < MeshArena::MaxDrawIDs; i++) ids[i] = i;
+            s_DrawIDs = std::make_unique<VertexBuffer>(ids.data(), (uint32_t)(ids.size() * sizeof(uint32_t)));
+        }
+
+        arena.VAO = std::make_unique<VertexArray>();
+        GrowVertices(arena, format, INITIAL_VERTEX_CAPACITY);
+        GrowIndices(arena, INITIAL_INDEX_CAPACITY);
+
+        arena.VAO->Bind();
+        s_DrawIDs->Bind();
+        glEnableVertexAttribArray(MeshArena::DrawIDAttribute);
+        glVertexAttribIPointer(MeshArena::DrawIDAttribute, 1, GL_UNSIGNED_INT, sizeof(uint32_t), (void*)0);
+        glVertexAttribDivisor(MeshArena::DrawIDAttribute, 1);
+        return arena;
+    }
+}
+
+MeshArena::Allocation MeshArena::Allocate(VertexFormat format, const Vertex* vertices, uint32_t vertexCount,
+                                          const uint32_t* indices, uint32_t indexCount)
+{
+    if (vertexCount == 0 || indexCount == 0 || format >= VertexFormat::Count) return {};
+
+    s_EncodeScratch.resize((size_t)vertexCount * VertexEncoder::GetLayout(format).Stride);
+    VertexEncoder::Encode(format, vertices, vertexCount, s_EncodeScratch.data());
+    return AllocateEncoded(format, s_EncodeScratch.data(), vertexCount, indices, indexCount);
+}
+
+MeshArena::Allocation MeshArena::AllocateEncoded(VertexFormat format, const void* encodedVertices, uint32_t vertexCount,
+                                                 const uint32_t* indices, uint32_t indexCount)
+{
+    Allocation result;
+    if (vertexCount == 0 || indexCount == 0 || format >= VertexFormat::Count) return result;
+
+    Arena& arena = EnsureInitialized(format);
+
+    uint32_t baseVertex = arena.VertexAlloc.Allocate(vertexCount);
+    if (baseVertex == OffsetAllocator::InvalidOffset)
+    {
+        GrowVertices(arena, format, arena.VertexAlloc.GetCapacity() + vertexCount);
+        baseVertex = arena.VertexAlloc.Allocate(vertexCount);
+    }
+
+    uint32_t firstIndex = arena.IndexAlloc.Allocate(indexCount);
+    if (firstIndex == OffsetAllocator::InvalidOffset)
+    {
+        GrowIndices(arena, arena.IndexAlloc.GetCapacity() + indexCount);
+        firstIndex = arena.IndexAlloc.Allocate(indexCount);
+    }
+
+    if (baseVertex == OffsetAllocator::InvalidOffset || firstIndex == OffsetAllocator::InvalidOffset)
+    {
+        CORE_ERROR("[MeshArena] Out of space for {0} vertices / {1} indices ({2})",
+                   vertexCount, indexCount, VertexEncoder::GetFormatName(format));
+        arena.VertexAlloc.Free(baseVertex, vertexCount);
+        arena.IndexAlloc.Free(firstIndex, indexCount);
+        return result;
+    }
+
+    const uint32_t stride = VertexEncoder::GetLayout(format).Stride;
+    Upload(arena.VAO->GetVertexBuffer()->GetRendererID(),
+           baseVertex * stride, vertexCount * stride, encodedVertices);
+    Upload(arena.VAO->GetIndexBuffer()->GetRendererID(),
+           firstIndex * (uint32_t)sizeof(uint32_t), indexCount * (uint32_t)sizeof(uint32_t), indices);
+
+    result.BaseVertex = baseVertex;
+    result.VertexCount = vertexCount;
+    result.FirstIndex = firstIndex;
+    result.IndexCount = indexCount;
+    result.Format = format;
+    arena.Meshes++;
+    return result;
+}
+
+void MeshArena::Free(Allocation& allocation)
+{
+    if (!allocation.IsValid()) return;
+
+    Arena& arena = s_Arenas[(size_t)allocation.Format];
+    if (!arena.VAO) return;
+
+    arena.VertexAlloc.Free(allocation.BaseVertex, allocation.VertexCount);
+    arena.IndexAlloc.Free(allocation.FirstIndex, allocation.IndexCount);
+    arena.Meshes--;
+    allocation = {};
+}
+
+bool MeshArena::Bind(VertexFormat format)
+{
+    return EnsureInitialized(format).VAO->Bind();
+}
+
+void MeshArena::Shutdown()
+{
+    for (size_t f = 0; f < (size_t)VertexFormat::Count; f++)
+    {
+        Arena& arena = s_Arenas[f];
+        if (arena.Meshes > 0)
+            CORE_WARN("[MeshArena] Shutdown with {0} {1} meshes still alive",
+                      arena.Meshes, VertexEncoder::GetFormatName((VertexFormat)f));
+        arena = Arena();
+    }
+
+    s_DrawIDs.reset();
+    s_EncodeScratch.clear();
+    s_EncodeScratch.shrink_to_fit();
+}
+
+MeshArena::Stats MeshArena::GetStats(VertexFormat format)
+{
+    const Arena& arena = s_Arenas[(size_t)format];
+    OffsetAllocator::Stats v = arena.VertexAlloc.GetStats();
+    OffsetAllocator::Stats i = arena.IndexAlloc.GetStats();
+
+    Stats stats;
+    stats.BytesPerVertex = VertexEncoder::GetLayout(format).Stride;
+    stats.Meshes = arena.Meshes;
+    stats.VertexCapacity = v.Capacity;
+    stats.VerticesUsed = v.Used;
+    stats.IndexCapacity = i.Capacity;
+    stats.IndicesUsed = i.Used;
+    stats.VertexFragmentation = v.GetFragmentation();
+    stats.IndexFragmentation = i.GetFragmentation();
+    stats.Grows = arena.Grows;
+    return stats;
+}
+
+void MeshArena::LogStats()
+{
+    for (size_t f = 0; f < (size_t)VertexFormat::Count; f++)
+    {
+        VertexFormat format = (VertexFormat)f;
+        if (!s_Arenas[f].VAO) continue;
+
+        Stats s = GetStats(format);
+        CORE_INFO("[MeshArena] {0} ({1} B/vertex): {2} meshes | vertices {3}/{4} (frag {5}) | indices {6}/{7} (frag {8}) | {9} grows",
+                  VertexEncoder::GetFormatName(format), s.BytesPerVertex, s.Meshes,
+                  s.VerticesUsed, s.VertexCapacity, s.VertexFragmentation,
+                  s.IndicesUsed, s.IndexCapacity, s.IndexFragmentation, s.Grows);
+    }
+
+    const VertexEncoder::Stats& encode = VertexEncoder::GetStats();
+    CORE_INFO("[MeshArena] Vertex encode: {0} vertices, {1} bytes, {2} ms ({3} Mverts/s)",
+              encode.VerticesEncoded, encode.BytesWritten, encode.EncodeMs, encode.GetMVertsPerSecond());
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <cstdint>
+#include <Rendering/Mesh/VertexLayout.hpp>
+
+struct Vertex;
+
+/**
+ * ============================================================================
+ * MESH ARENA - shared vertex/index storage for every Mesh
+ * ============================================================================
+ *
+ * All meshes of one vertex format live in one large vertex buffer and one
+ * large index buffer behind a single VAO. A Mesh only records where its
+ * range starts (BaseVertex / FirstIndex) and is drawn with
+ * glDrawElementsBaseVertex, so switching meshes no longer rebinds a VAO.
+ *
+ * Ranges are handed out by an OffsetAllocator (in elements, not bytes).
+ * When the arena is full it grows by copying into buffers twice the size
+ * (glCopyBufferSubData) - offsets stay valid.
+ *
+ * There is one arena (VAO + buffers + allocators) per VertexFormat; the
+ * attribute setup comes from VertexEncoder::GetLayout(). Meshes are encoded
+ * into their format on upload, and draws are grouped by format so each
+ * group still needs only one VAO bind.
+ *
+ * Must be shut down (Renderer::Shutdown) while the GL context is alive.
+ * ============================================================================
+ */
+class MeshArena
+{
+public:
+    // Vertex attribute 2 of the arena VAO: a per-instance uint (divisor 1)
+    // equal to gl_InstanceID + baseInstance. Multi-draw indirect uses it as
+    // the draw index into the instance SSBO (no ARB_shader_draw_parameters).
+    static constexpr uint32_t DrawIDAttribute = 2;
+    static constexpr uint32_t MaxDrawIDs = 8192;
+
+    struct Allocation
+    {
+        uint32_t BaseVertex = 0;
+        uint32_t VertexCount = 0;
+        uint32_t FirstIndex = 0;
+        uint32_t IndexCount = 0;
+        VertexFormat Format = VertexFormat::Float32;
+
+        bool IsValid() const { return VertexCount > 0; }
+    };
+
+    struct Stats
+    {
+        uint32_t BytesPerVertex = 0;
+        uint32_t Meshes = 0;
+        uint32_t VertexCapacity = 0;
+        uint32_t VerticesUsed = 0;
+        uint32_t IndexCapacity = 0;
+        uint32_t IndicesUsed = 0;
+        float VertexFragmentation = 0.0f;
+        float IndexFragmentation = 0.0f;
+        uint32_t Grows = 0;
+    };
+
+    // Encodes the vertices into `format` and uploads them into that format's
+    // arena; returns an invalid allocation on failure
+    static Allocation Allocate(VertexFormat format, const Vertex* vertices, uint32_t vertexCount,
+                               const uint32_t* indices, uint32_t indexCount);
+    // Vertices already in `format` (vertexCount * stride bytes) - uploaded as-is,
+    // e.g. straight from a mapped cooked file
+    static Allocation AllocateEncoded(VertexFormat format, const void* encodedVertices, uint32_t vertexCount,
+                                      const uint32_t* indices, uint32_t indexCount);
+    static void Free(Allocation& allocation);
+
+    // Binds the VAO of one format's arena. Returns true if a GL call was issued.
+    static bool Bind(VertexFormat format);
+
+    static void Shutdown();
+
+    static Stats GetStats(VertexFormat format);
+    static void LogStats();
+};
@@ -0,0 +1,308 @@
+#include "MeshOptimizer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <glm/glm.hpp>
+
+#include "Mesh.hpp"
+#include <Core/Log.hpp>
+
+namespace
+{
+    constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    MeshOptimizer::Stats s_Stats;
+
+    // FIFO cache simulation shared by the analyzer and the Optimize() totals
+    uint32_t CountTransforms(const std::vector<uint32_t>& indices, uint32_t vertexCount, uint32_t cacheSize,
+                             uint32_t* uniqueVertices)
+    {
+        // A vertex is cached while fewer than cacheSize misses happened since it was loaded
+        std::vector<uint32_t> loadedAt(vertexCount, 0);
+        std::vector<bool> seen(vertexCount, false);
+        uint32_t time = cacheSize + 1;
+        uint32_t unique = 0;
+
+        for (uint32_t index : indices)
+        {
+            if (time - loadedAt[index] > cacheSize)
+                loadedAt[index] = time++;
+
+            if (!seen[index])
+            {
+                seen[index] = true;
+                unique++;
+            }
+        }
+
+        if (uniqueVertices) *uniqueVertices = unique;
+        return time - (cacheSize + 1);
+    }
+}
+
+MeshOptimizer::CacheStats MeshOptimizer::AnalyzeVertexCache(const std::vector<uint32_t>& indices, uint32_t vertexCount,
+                                                            uint32_t cacheSize)
+{
+    CacheStats stats;
+    uint32_t triangles = (uint32_t)indices.size() / 3;
+    if (triangles == 0) return stats;
+
+    uint32_t unique = 0;
+    uint32_t transforms = CountTransforms(indices, vertexCount, cacheSize, &unique);
+
+    stats.ACMR = (float)transforms / triangles;
+    stats.ATVR = unique ? (float)transforms / unique : 0.0f;
+    return stats;
+}
+
+// ============================================================================
+// Tipsify
+// ============================================================================
+std::vector<uint32_t> MeshOptimizer::OptimizeVertexCache(std::vector<uint32_t>& indices, uint32_t vertexCount,
+                                                         uint32_t cacheSize)
+{
+    std::vector<uint32_t> clusters = { 0 };
+    const uint32_t triangleCount = (uint32_t)indices.size() / 3;
+    if (triangleCount == 0) return clusters;
+
+    // Vertex -> triangle adjacency (CSR) and live triangle count per vertex
+    std::vector<uint32_t> live(vertexCount, 0);
+    for (uint32_t i = 0; i < triangleCount * 3; i++)
+        live[indices[i]]++;
+
+    std::vector<uint32_t> adjacencyOffset(vertexCount + 1, 0);
+    for (uint32_t v = 0; v < vertexCount; v++)
+        adjacencyOffset[v + 1] = adjacencyOffset[v] + live[v];
+
+    std::vector<uint32_t> adjacency(triangleCount * 3);
+    {
+        std::vector<uint32_t> cursor(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+        for (uint32_t i = 0; i < triangleCount * 3; i++)
+            adjacency[cursor[indices[i]]++] = i / 3;
+    }
+
+    std::vector<uint32_t> cachedAt(vertexCount, 0);
+    std::vector<bool> emitted(triangleCount, false);
+    std::vector<uint32_t> deadEnds;
+    std::vector<uint32_t> candidates;
+    std::vector<uint32_t> output;
+    output.reserve(triangleCount * 3);
+
+    uint32_t time = cacheSize + 1;
+    uint32_t scanCursor = 0;
+    uint32_t fan = 0;
+
+    while (fan != INVALID_INDEX)
+    {
+        // Emit every remaining triangle around the fanning vertex
+        candidates.clear();
+        for (uint32_t k = adjacencyOffset[fan]; k < adjacencyOffset[fan + 1]; k++)
+        {
+            uint32_t t = adjacency[k];
+            if (emitted[t]) continue;
+
+            for (uint32_t c = 0; c < 3; c++)
+            {
+                uint32_t v = indices[t * 3 + c];
+                output.push_back(v);
+                deadEnds.push_back(v);
+                candidates.push_back(v);
+                live[v]--;
+                if (time - cachedAt[v] > cacheSize)
+                    cachedAt[v] = time++;
+            }
+            emitted[t] = true;
+        }
+
+        // Next fan: the candidate that will still be in cache after its remaining triangles
+        uint32_t next = INVALID_INDEX;
+        int32_t bestPriority = -1;
+        for (uint32_t v : candidates)
+        {
+            if (live[v] == 0) continue;
+
+            int32_t priority = 0;
+            if (time - cachedAt[v] + 2 * live[v] <= cacheSize)
+                priority = (int32_t)(time - cachedAt[v]);
+
+            if (priority > bestPriority)
+            {
+                bestPriority = priority;
+                next = v;
+            }
+        }
+
+        if (next == INVALID_INDEX)
+        {
+            // Dead end: most recent vertex with work left, else scan forward
+            while (!deadEnds.empty() && next == INVALID_INDEX)
+            {
+                uint32_t v = deadEnds.back();
+                deadEnds.pop_back();
+                if (live[v] > 0) next = v;
+            }
+            while (next == INVALID_INDEX && scanCursor < vertexCount)
+            {
+                if (live[scanCursor] > 0) next = scanCursor;
+                else scanCursor++;
+            }
+
+            // Each dead end starts a new cluster for the overdraw pass
+            uint32_t emittedTriangles = (uint32_t)output.size() / 3;
+            if (next != INVALID_INDEX && emittedTriangles > clusters.back())
+                clusters.push_back(emittedTriangles);
+        }
+
+        fan = next;
+    }
+
+    indices.swap(output);
+    return clusters;
+}
+
+// ============================================================================
+// Overdraw - outward-facing clusters first
+// ============================================================================
+void MeshOptimizer::OptimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices,
+                                     const std::vector<uint32_t>& clusters)
+{
+    const uint32_t triangleCount = (uint32_t)indices.size() / 3;
+    if (clusters.size() < 2 || triangleCount == 0) return;
+
+    struct Cluster
+    {
+        uint32_t Begin;
+        uint32_t End;
+        glm::vec3 Centroid{ 0.0f };
+        glm::vec3 Normal{ 0.0f };
+        float SortKey = 0.0f;
+    };
+
+    std::vector<Cluster> sorted;
+    sorted.reserve(clusters.size());
+
+    glm::vec3 meshCentroid(0.0f);
+    float meshArea = 0.0f;
+
+    for (size_t c = 0; c < clusters.size(); c++)
+    {
+        Cluster cluster;
+        cluster.Begin = clusters[c];
+        cluster.End = c + 1 < clusters.size() ? clusters[c + 1] : triangleCount;
+
+        float area = 0.0f;
+        for (uint32_t t = cluster.Begin; t < cluster.End; t++)
+        {
+            const glm::vec3& a = vertices[indices[t * 3 + 0]].Position;
+            const glm::vec3& b = vertices[indices[t * 3 + 1]].Position;
+            const glm::vec3& d = vertices[indices[t * 3 + 2]].Position;
+
+            // |cross| = 2 * area, so the sums below are area weighted
+            glm::vec3 n = glm::cross(b - a, d - a);
+            float weight = glm::length(n);
+
+            cluster.Centroid += (a + b + d) * (weight / 3.0f);
+            cluster.Normal += n;
+            area += weight;
+        }
+
+        meshCentroid += cluster.Centroid;
+        meshArea += area;
+
+        if (area > 0.0f) cluster.Centroid /= area;
+        float normalLength = glm::length(cluster.Normal);
+        if (normalLength > 0.0f) cluster.Normal /= normalLength;
+
+        sorted.push_back(cluster);
+    }
+
+    if (meshArea > 0.0f) meshCentroid /= meshArea;
+
+    for (Cluster& cluster : sorted)
+        cluster.SortKey = glm::dot(cluster.Centroid - meshCentroid, cluster.Normal);
+
+    // Clusters facing away from the centre tend to occlude the rest - draw them first
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const Cluster& a, const Cluster& b) { return a.SortKey > b.SortKey; });
+
+    std::vector<uint32_t> output;
+    output.reserve(indices.size());
+    for (const Cluster& cluster : sorted)
+        output.insert(output.end(), indices.begin() + cluster.Begin * 3, indices.begin() + cluster.End * 3);
+
+    indices.swap(output);
+}
+
+// ============================================================================
+// Vertex fetch - first-use order
+// ============================================================================
+void MeshOptimizer::OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices)
+{
+    std::vector<uint32_t> remap(vertices.size(), INVALID_INDEX);
+    std::vector<Vertex> output;
+    output.reserve(vertices.size());
+
+    for (uint32_t& index : indices)
+    {
+        if (remap[index] == INVALID_INDEX)
+        {
+            remap[index] = (uint32_t)output.size();
+            output.push_back(vertices[index]);
+        }
+        index = remap[index];
+    }
+
+    vertices.swap(output);
+}
+
+MeshOptimizer::Report MeshOptimizer::Optimize(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices)
+{
+    Report report;
+    const uint32_t vertexCount = (uint32_t)vertices.size();
+    if (indices.size() < 3 || indices.size() % 3 != 0) return report;
+
+    for (uint32_t index : indices)
+    {
+        if (index >= vertexCount)
+        {
+            CORE_WARN("[MeshOptimizer] Index {0} out of range ({1} vertices) - mesh left unoptimized", index, vertexCount);
+            return report;
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    uint32_t unique = 0;
+    uint32_t transformsBefore = CountTransforms(indices, vertexCount, CacheSize, &unique);
+
+    std::vector<uint32_t> clusters = OptimizeVertexCache(indices, vertexCount);
+    OptimizeOverdraw(indices, vertices, clusters);
+    OptimizeVertexFetch(vertices, indices);
+
+    uint32_t transformsAfter = CountTransforms(indices, (uint32_t)vertices.size(), CacheSize, nullptr);
+
+    const uint32_t triangles = (uint32_t)indices.size() / 3;
+    report.Before = { (float)transformsBefore / triangles, (float)transformsBefore / unique };
+    report.After = { (float)transformsAfter / triangles, (float)transformsAfter / unique };
+    report.Clusters = (uint32_t)clusters.size();
+    report.Ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    s_Stats.Meshes++;
+    s_Stats.Triangles += triangles;
+    s_Stats.UniqueVertices += unique;
+    s_Stats.TransformsBefore += transformsBefore;
+    s_Stats.TransformsAfter += transformsAfter;
+    s_Stats.Ms += report.Ms;
+    return report;
+}
+
+const MeshOptimizer::Stats& MeshOptimizer::GetStats()
+{
+    return s_Stats;
+}
+
+void MeshOptimizer::LogStats()
+{
+    CORE_INFO("[MeshOptimizer] {0} meshes, {1} triangles | ACMR {2} -> {3} | ATVR {4} -> {5} | {6} ms",
+              s_Stats.Meshes, s_Stats.Triangles, s_Stats.GetACMRBefore(), s_Stats.GetACMRAfter(),
+              s_Stats.GetATVRBefore(), s_Stats.GetATVRAfter(), s_Stats.Ms);
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+struct Vertex;
+
+/**
+ * ============================================================================
+ * MESH OPTIMIZER - index/vertex reordering before upload
+ * ============================================================================
+ *
+ * Pure CPU, no GL. Runs on every Mesh before it goes into the MeshArena:
+ *
+ *  1. OptimizeVertexCache - Tipsify (Sander, Nehab, Barczak 2007). Linear
+ *     time; fans around recently used vertices so the post-transform cache
+ *     hits. Returns the cluster boundaries it produced (dead ends).
+ *  2. OptimizeOverdraw    - reorders those clusters so outward-facing ones
+ *     (relative to the mesh centroid) draw first. Clusters are kept intact,
+ *     so the cache order inside each one survives.
+ *  3. OptimizeVertexFetch - renumbers vertices in first-use order so the
+ *     vertex fetch walks memory linearly; unreferenced vertices are dropped.
+ *
+ * AnalyzeVertexCache simulates a FIFO cache and reports:
+ *  ACMR - average cache miss ratio, transformed vertices per triangle (0.5 - 3)
+ *  ATVR - average transform to vertex ratio, transformed / unique (1 = ideal)
+ * ============================================================================
+ */
+namespace MeshOptimizer
+{
+    // Post-transform cache modelled as a FIFO of this many entries
+    constexpr uint32_t CacheSize = 16;
+
+    struct CacheStats
+    {
+        float ACMR = 0.0f;
+        float ATVR = 0.0f;
+    };
+
+    CacheStats AnalyzeVertexCache(const std::vector<uint32_t>& indices, uint32_t vertexCount,
+                                  uint32_t cacheSize = CacheSize);
+
+    // Returns the first triangle of every cluster (always starts with 0)
+    std::vector<uint32_t> OptimizeVertexCache(std::vector<uint32_t>& indices, uint32_t vertexCount,
+                                              uint32_t cacheSize = CacheSize);
+
+    void OptimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices,
+                          const std::vector<uint32_t>& clusters);
+
+    void OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+
+    // All three passes in order; returns the cache stats before and after
+    struct Report
+    {
+        CacheStats Before;
+        CacheStats After;
+        uint32_t Clusters = 0;
+        double Ms = 0.0;
+    };
+    Report Optimize(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+
+    // Totals over every Optimize() call
+    struct Stats
+    {
+        uint32_t Meshes = 0;
+        uint64_t Triangles = 0;
+        uint64_t UniqueVertices = 0;
+        uint64_t TransformsBefore = 0;
+        uint64_t TransformsAfter = 0;
+        double Ms = 0.0;
+
+        float GetACMRBefore() const { return Triangles ? (float)TransformsBefore / Triangles : 0.0f; }
+        float GetACMRAfter() const { return Triangles ? (float)TransformsAfter / Triangles : 0.0f; }
+        float GetATVRBefore() const { return UniqueVertices ? (float)TransformsBefore / UniqueVertices : 0.0f; }
+        float GetATVRAfter() const { return UniqueVertices ? (float)TransformsAfter / UniqueVertices : 0.0f; }
+    };
+    const Stats& GetStats();
+    void LogStats();
+}
@@ -0,0 +1,326 @@
+#include "MeshSimplifier.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <unordered_map>
+#include <glm/glm.hpp>
+
+#include "Mesh.hpp"
+#include <Core/Log.hpp>
+
+namespace
+{
+    // Border planes are weighted this much more than surface planes
+    constexpr double BORDER_WEIGHT = 10.0;
+
+    // Symmetric 4x4 plane quadric + accumulated area, so Evaluate() is a squared distance
+    struct Quadric
+    {
+        double XX = 0, XY = 0, XZ = 0, XW = 0;
+        double YY = 0, YZ = 0, YW = 0;
+        double ZZ = 0, ZW = 0;
+        double WW = 0;
+        double Weight = 0;
+
+        void AddPlane(const glm::vec3& n, double d, double weight)
+        {
+            XX += weight * n.x * n.x; XY += weight * n.x * n.y; XZ += weight * n.x * n.z; XW += weight * n.x * d;
+            YY += weight * n.y * n.y; YZ += weight * n.y * n.z; YW += weight * n.y * d;
+            ZZ += weight * n.z * n.z; ZW += weight * n.z * d;
+            WW += weight * d * d;
+            Weight += weight;
+        }
+
+        Quadric& operator+=(const Quadric& o)
+        {
+            XX += o.XX; XY += o.XY; XZ += o.XZ; XW += o.XW;
+            YY += o.YY; YZ += o.YZ; YW += o.YW;
+            ZZ += o.ZZ; ZW += o.ZW;
+            WW += o.WW;
+            Weight += o.Weight;
+            return *this;
+        }
+
+        double Evaluate(const glm::vec3& p) const
+        {
+            double x = p.x, y = p.y, z = p.z;
+            double e = XX * x * x + 2 * XY * x * y + 2 * XZ * x * z + 2 * XW * x
+                     + YY * y * y + 2 * YZ * y * z + 2 * YW * y
+                     + ZZ * z * z + 2 * ZW * z
+                     + WW;
+            return Weight > 0 ? std::max(0.0, e / Weight) : 0.0;
+        }
+    };
+
+    struct Collapse
+    {
+        uint32_t From;
+        uint32_t To;
+        double Cost;
+    };
+
+    uint64_t EdgeKey(uint32_t a, uint32_t b)
+    {
+        return a < b ? ((uint64_t)a << 32) | b : ((uint64_t)b << 32) | a;
+    }
+}
+
+MeshSimplifier::Result MeshSimplifier::Simplify(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                                                uint32_t targetIndexCount)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    Result result;
+    result.Indices = indices;
+    if (indices.size() % 3 != 0 || indices.size() <= targetIndexCount) return result;
+
+    const uint32_t vertexCount = (uint32_t)vertices.size();
+    for (uint32_t index : indices)
+        if (index >= vertexCount) return result;
+
+    // ---- Group vertices by position (seams collapse together) ----
+    std::vector<uint32_t> order(vertexCount);
+    std::iota(order.begin(), order.end(), 0u);
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b)
+    {
+        const glm::vec3& pa = vertices[a].Position;
+        const glm::vec3& pb = vertices[b].Position;
+        if (pa.x != pb.x) return pa.x < pb.x;
+        if (pa.y != pb.y) return pa.y < pb.y;
+        return pa.z < pb.z;
+    });
+
+    std::vector<uint32_t> group(vertexCount);
+    std::vector<uint32_t> groupStart;     // Members of group g: order[groupStart[g] .. groupStart[g + 1])
+    std::vector<glm::vec3> groupPosition;
+    for (uint32_t i = 0; i < vertexCount; i++)
+    {
+        if (i == 0 || vertices[order[i]].Position != vertices[order[i - 1]].Position)
+        {
+            groupStart.push_back(i);
+            groupPosition.push_back(vertices[order[i]].Position);
+        }
+        group[order[i]] = (uint32_t)groupStart.size() - 1;
+    }
+    const uint32_t groupCount = (uint32_t)groupStart.size();
+    groupStart.push_back(vertexCount);
+
+    // ---- Quadrics: triangle planes + border planes ----
+    std::vector<Quadric> quadrics(groupCount);
+    std::unordered_map<uint64_t, uint32_t> edgeUse;
+    edgeUse.reserve(indices.size());
+
+    const uint32_t triangleCount = (uint32_t)indices.size() / 3;
+    for (uint32_t t = 0; t < triangleCount; t++)
+    {
+        uint32_t g[3] = { group[indices[t * 3]], group[indices[t * 3 + 1]], group[indices[t * 3 + 2]] };
+        glm::vec3 p0 = groupPosition[g[0]], p1 = groupPosition[g[1]], p2 = groupPosition[g[2]];
+        glm::vec3 n = glm::cross(p1 - p0, p2 - p0);
+        float length = glm::length(n);
+        if (length <= 0.0f) continue;
+
+        n /= length;
+        for (uint32_t c = 0; c < 3; c++)
+            quadrics[g[c]].AddPlane(n, -glm::dot(n, p0), length * 0.5);
+        for (uint32_t c = 0; c < 3; c++)
+            edgeUse[EdgeKey(g[c], g[(c + 1) % 3])]++;
+    }
+
+    for (uint32_t t = 0; t < triangleCount; t++)
+    {
+        uint32_t g[3] = { group[indices[t * 3]], group[indices[t * 3 + 1]], group[indices[t * 3 + 2]] };
+        glm::vec3 p0 = groupPosition[g[0]], p1 = groupPosition[g[1]], p2 = groupPosition[g[2]];
+        glm::vec3 faceNormal = glm::cross(p1 - p0, p2 - p0);
+        if (glm::length(faceNormal) <= 0.0f) continue;
+        faceNormal = glm::normalize(faceNormal);
+
+        for (uint32_t c = 0; c < 3; c++)
+        {
+            uint32_t a = g[c], b = g[(c + 1) % 3];
+            if (edgeUse[EdgeKey(a, b)] != 1) continue;
+
+            glm::vec3 pa = groupPosition[a];
+            glm::vec3 edge = groupPosition[b] - pa;
+            glm::vec3 n = glm::cross(edge, faceNormal);
+            float length = glm::length(n);
+            if (length <= 0.0f) continue;
+
+            n /= length;
+            double weight = glm::dot(edge, edge) * BORDER_WEIGHT;
+            quadrics[a].AddPlane(n, -glm::dot(n, pa), weight);
+            quadrics[b].AddPlane(n, -glm::dot(n, pa), weight);
+        }
+    }
+
+    // ---- Collapse passes ----
+    std::vector<uint32_t> corners = indices;  // Vertex per corner
+    std::vector<uint32_t> cornerGroups(indices.size());
+    for (size_t i = 0; i < indices.size(); i++)
+        cornerGroups[i] = group[indices[i]];
+
+    std::vector<uint32_t> adjacencyStart(groupCount + 1);
+    std::vector<uint32_t> adjacency;
+    std::vector<uint64_t> edges;
+    std::vector<Collapse> collapses;
+    std::vector<uint32_t> remap(groupCount);
+    std::vector<bool> locked(groupCount);
+    double maxError = 0.0;
+
+    auto faceNormal = [&](uint32_t t, uint32_t moved, uint32_t target) -> glm::vec3
+    {
+        glm::vec3 p[3];
+        for (uint32_t c = 0; c < 3; c++)
+        {
+            uint32_t g = cornerGroups[t * 3 + c];
+            p[c] = groupPosition[g == moved ? target : g];
+        }
+        return glm::cross(p[1] - p[0], p[2] - p[0]);
+    };
+
+    while (cornerGroups.size() > targetIndexCount)
+    {
+        const uint32_t liveTriangles = (uint32_t)cornerGroups.size() / 3;
+
+        // Group -> triangle adjacency (CSR)
+        std::fill(adjacencyStart.begin(), adjacencyStart.end(), 0u);
+        for (uint32_t g : cornerGroups) adjacencyStart[g + 1]++;
+        for (uint32_t g = 0; g < groupCount; g++) adjacencyStart[g + 1] += adjacencyStart[g];
+        adjacency.resize(cornerGroups.size());
+        {
+            std::vector<uint32_t> cursor(adjacencyStart.begin(), adjacencyStart.end() - 1);
+            for (uint32_t i = 0; i < (uint32_t)cornerGroups.size(); i++)
+                adjacency[cursor[cornerGroups[i]]++] = i / 3;
+        }
+
+        // Unique edges, each with its cheaper collapse direction
+        edges.clear();
+        for (uint32_t t = 0; t < liveTriangles; t++)
+            for (uint32_t c = 0; c < 3; c++)
+                edges.push_back(EdgeKey(cornerGroups[t * 3 + c], cornerGroups[t * 3 + (c + 1) % 3]));
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+        collapses.clear();
+        for (uint64_t key : edges)
+        {
+            uint32_t a = (uint32_t)(key >> 32), b = (uint32_t)key;
+            Quadric q = quadrics[a];
+            q += quadrics[b];
+
+            double costToB = q.Evaluate(groupPosition[b]);
+            double costToA = q.Evaluate(groupPosition[a]);
+            if (costToB <= costToA) collapses.push_back({ a, b, costToB });
+            else                    collapses.push_back({ b, a, costToA });
+        }
+        std::sort(collapses.begin(), collapses.end(),
+                  [](const Collapse& x, const Collapse& y) { return x.Cost < y.Cost; });
+
+        // Each interior collapse removes two triangles
+        const uint32_t wanted = ((uint32_t)cornerGroups.size() - targetIndexCount) / 6 + 1;
+        std::iota(remap.begin(), remap.end(), 0u);
+        std::fill(locked.begin(), locked.end(), false);
+
+        uint32_t applied = 0;
+        for (const Collapse& collapse : collapses)
+        {
+            if (applied >= wanted) break;
+            if (locked[collapse.From] || locked[collapse.To]) continue;
+
+            bool flips = false;
+            for (uint32_t k = adjacencyStart[collapse.From]; k < adjacencyStart[collapse.From + 1] && !flips; k++)
+            {
+                uint32_t t = adjacency[k];
+                const uint32_t* g = &cornerGroups[t * 3];
+                if (g[0] == collapse.To || g[1] == collapse.To || g[2] == collapse.To) continue;
+
+                glm::vec3 before = faceNormal(t, collapse.From, collapse.From);
+                glm::vec3 after = faceNormal(t, collapse.From, collapse.To);
+                flips = glm::dot(before, after) <= 0.0f;
+            }
+            if (flips) continue;
+
+            remap[collapse.From] = collapse.To;
+            quadrics[collapse.To] += quadrics[collapse.From];
+            maxError = std::max(maxError, collapse.Cost);
+            applied++;
+
+            // Neighbouring triangles must not be checked against stale positions this pass
+            for (uint32_t k = adjacencyStart[collapse.From]; k < adjacencyStart[collapse.From + 1]; k++)
+                for (uint32_t c = 0; c < 3; c++)
+                    locked[cornerGroups[adjacency[k] * 3 + c]] = true;
+            locked[collapse.To] = true;
+        }
+
+        if (applied == 0) break;
+
+        // Rewrite corners; moved corners take the destination vertex with the closest normal
+        uint32_t write = 0;
+        for (uint32_t t = 0; t < liveTriangles; t++)
+        {
+            uint32_t g[3], v[3];
+            for (uint32_t c = 0; c < 3; c++)
+            {
+                uint32_t oldGroup = cornerGroups[t * 3 + c];
+                g[c] = remap[oldGroup];
+                v[c] = corners[t * 3 + c];
+
+                if (g[c] != oldGroup)
+                {
+                    const glm::vec3& normal = vertices[v[c]].Normal;
+                    float best = -2.0f;
+                    for (uint32_t m = groupStart[g[c]]; m < groupStart[g[c] + 1]; m++)
+                    {
+                        float d = glm::dot(normal, vertices[order[m]].Normal);
+                        if (d > best) { best = d; v[c] = order[m]; }
+                    }
+                }
+            }
+
+            if (g[0] == g[1] || g[1] == g[2] || g[0] == g[2]) continue;
+
+            for (uint32_t c = 0; c < 3; c++)
+            {
+                cornerGroups[write * 3 + c] = g[c];
+                corners[write * 3 + c] = v[c];
+            }
+            write++;
+        }
+        cornerGroups.resize(write * 3);
+        corners.resize(write * 3);
+    }
+
+    result.Indices.swap(corners);
+    result.Error = (float)std::sqrt(maxError);
+    result.Ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+std::vector<MeshSimplifier::Result> MeshSimplifier::BuildChain(const std::vector<Vertex>& vertices,
+                                                               const std::vector<uint32_t>& indices, uint32_t levels)
+{
+    std::vector<Result> chain;
+    chain.reserve(levels);
+    const std::vector<uint32_t>* current = &indices;
+    float error = 0.0f;
+
+    for (uint32_t level = 1; level <= levels; level++)
+    {
+        uint32_t target = (uint32_t)(current->size() / 6) * 3;
+        Result simplified = Simplify(vertices, *current, target);
+
+        // Stop once the simplifier can no longer make real progress
+        if (simplified.Indices.empty() || simplified.Indices.size() * 10 > current->size() * 9)
+            break;
+
+        error += simplified.Error;
+        simplified.Error = error;
+        CORE_INFO("[MeshSimplifier] LOD{0}: {1} -> {2} triangles, error {3}, {4} ms",
+                  level, current->size() / 3, simplified.Indices.size() / 3, error, simplified.Ms);
+
+        chain.push_back(std::move(simplified));
+        current = &chain.back().Indices;
+    }
+
+    return chain;
+}
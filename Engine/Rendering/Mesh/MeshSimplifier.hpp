@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+struct Vertex;
+
+/**
+ * ============================================================================
+ * MESH SIMPLIFIER - quadric error edge collapse (Garland & Heckbert 1997)
+ * ============================================================================
+ *
+ * Pure CPU, no GL. Produces a reduced index buffer that still references the
+ * original vertex array - vertices are collapsed onto existing vertices, so
+ * no new attributes are invented and the result can go straight through
+ * Mesh creation (the vertex fetch pass drops what became unused).
+ *
+ * Vertices sharing a position (normal seams, e.g. cube faces) are collapsed
+ * together; each corner picks the vertex at the destination whose normal is
+ * closest to its own. Open borders get an extra perpendicular quadric so
+ * silhouettes of flat pieces do not shrink, and collapses that would flip a
+ * triangle are rejected.
+ *
+ * Collapses run in passes: every pass sorts all edges by cost and applies
+ * the cheapest independent ones, until the target is reached or nothing
+ * can collapse any more.
+ * ============================================================================
+ */
+namespace MeshSimplifier
+{
+    struct Result
+    {
+        std::vector<uint32_t> Indices;
+        float Error = 0.0f;   // Largest collapse error, object-space distance
+        double Ms = 0.0;
+    };
+
+    // targetIndexCount is a goal, not a guarantee - the result may stay above it
+    Result Simplify(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                    uint32_t targetIndexCount);
+
+    // LOD levels 1..levels, each simplifying the previous one to half its
+    // triangles. Error is accumulated, i.e. a bound against the input. Stops
+    // early once a level removes less than 10%.
+    std::vector<Result> BuildChain(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                                   uint32_t levels);
+}
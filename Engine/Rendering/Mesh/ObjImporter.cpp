@@ -0,0 +1,449 @@
+#include "ObjImporter.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <glm/glm.hpp>
+
+#include "Mesh.hpp"
+#include <Core/Log.hpp>
+#include <Core/Resources/MappedFile.hpp>
+
+namespace
+{
+    // Below this much text per worker, threads cost more than they save
+    constexpr size_t MIN_CHUNK_BYTES = 1u << 20;
+
+    // Corner index that is relative to its chunk, rebased after parsing. The offset is biased
+    // so that -1 (the element just before the chunk) cannot encode to NO_INDEX.
+    constexpr uint32_t LOCAL_FLAG = 0x80000000u;
+    constexpr int64_t LOCAL_BIAS = 1 << 30;
+    constexpr uint32_t NO_INDEX = 0xFFFFFFFFu;
+
+    struct Corner
+    {
+        uint32_t Position;
+        uint32_t Normal;
+    };
+
+    struct Chunk
+    {
+        std::vector<glm::vec3> Positions;
+        std::vector<glm::vec3> Normals;
+        std::vector<Corner> Corners;   // 3 per triangle, already fan-triangulated
+        uint32_t BadFaces = 0;
+    };
+
+    // ---- Number parsing ----------------------------------------------------
+
+    inline bool IsSpace(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+    inline bool IsDigit(char c) { return (unsigned)(c - '0') < 10u; }
+
+    inline const char* SkipSpace(const char* p, const char* end)
+    {
+        while (p < end && IsSpace(*p)) p++;
+        return p;
+    }
+
+    inline const char* SkipLine(const char* p, const char* end)
+    {
+        while (p < end && *p != '\n') p++;
+        return p < end ? p + 1 : end;
+    }
+
+    // Decimal float without locale or strtod; exact for the digit counts meshes use
+    const char* ParseFloat(const char* p, const char* end, float& out)
+    {
+        static const double s_Powers[] =
+        {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+            1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+
+        p = SkipSpace(p, end);
+
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+'))
+            negative = *p++ == '-';
+
+        uint64_t mantissa = 0;
+        int exponent = 0;
+        int digits = 0;
+        for (; p < end && IsDigit(*p); p++)
+        {
+            if (digits < 19) { mantissa = mantissa * 10 + (uint64_t)(*p - '0'); digits++; }
+            else exponent++;
+        }
+        if (p < end && *p == '.')
+        {
+            for (p++; p < end && IsDigit(*p); p++)
+            {
+                if (digits < 19) { mantissa = mantissa * 10 + (uint64_t)(*p - '0'); digits++; exponent--; }
+            }
+        }
+        if (p < end && (*p == 'e' || *p == 'E'))
+        {
+            p++;
+            bool negativeExponent = false;
+            if (p < end && (*p == '-' || *p == '+'))
+                negativeExponent = *p++ == '-';
+
+            int value = 0;
+            for (; p < end && IsDigit(*p); p++)
+                value = std::min(value * 10 + (*p - '0'), 10000);
+            exponent += negativeExponent ? -value : value;
+        }
+
+        double result = (double)mantissa;
+        if (exponent < 0)
+            result = exponent >= -22 ? result / s_Powers[-exponent] : result * std::pow(10.0, exponent);
+        else if (exponent > 0)
+            result = exponent <= 22 ? result * s_Powers[exponent] : result * std::pow(10.0, exponent);
+
+        out = (float)(negative ? -result : result);
+        return p;
+    }
+
+    inline const char* ParseInt(const char* p, const char* end, int64_t& out)
+    {
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+'))
+            negative = *p++ == '-';
+
+        int64_t value = 0;
+        for (; p < end && IsDigit(*p); p++)
+            value = value * 10 + (*p - '0');
+
+        out = negative ? -value : value;
+        return p;
+    }
+
+    // OBJ indices are 1-based, or negative = relative to the elements read so far
+    inline uint32_t ResolveIndex(int64_t index, uint32_t localCount)
+    {
+        if (index > 0) return (uint32_t)(index - 1);
+        if (index == 0) return NO_INDEX;
+
+        int64_t local = (int64_t)localCount + index;
+        if (local < -LOCAL_BIAS || local >= LOCAL_BIAS - 1) return NO_INDEX;
+        return (uint32_t)(local + LOCAL_BIAS) | LOCAL_FLAG;
+    }
+
+    inline uint32_t Rebase(uint32_t index, uint32_t chunkBase)
+    {
+        if (index == NO_INDEX || !(index & LOCAL_FLAG)) return index;
+        int64_t local = (int64_t)(index & ~LOCAL_FLAG) - LOCAL_BIAS;
+        return (uint32_t)((int64_t)chunkBase + local);
+    }
+
+    // ---- Chunk parsing ------------------------------------------------------
+
+    void ParseChunk(const char* p, const char* end, Chunk& chunk)
+    {
+        std::vector<Corner> polygon;
+
+        while (p < end)
+        {
+            p = SkipSpace(p, end);
+            if (p >= end) break;
+
+            if (p[0] == 'v' && p + 1 < end && IsSpace(p[1]))
+            {
+                glm::vec3 v;
+                p = ParseFloat(p + 1, end, v.x);
+                p = ParseFloat(p, end, v.y);
+                p = ParseFloat(p, end, v.z);
+                chunk.Positions.push_back(v);
+            }
+            else if (p[0] == 'v' && p + 2 < end && p[1] == 'n' && IsSpace(p[2]))
+            {
+                glm::vec3 n;
+                p = ParseFloat(p + 2, end, n.x);
+                p = ParseFloat(p, end, n.y);
+                p = ParseFloat(p, end, n.z);
+                chunk.Normals.push_back(n);
+            }
+            else if (p[0] == 'f' && p + 1 < end && IsSpace(p[1]))
+            {
+                polygon.clear();
+                p = SkipSpace(p + 1, end);
+                while (p < end && *p != '\n' && *p != '#')
+                {
+                    int64_t position = 0, unused = 0, normal = 0;
+                    p = ParseInt(p, end, position);
+                    if (p < end && *p == '/')
+                    {
+                        p++;
+                        if (p < end && *p != '/') p = ParseInt(p, end, unused); // texcoord
+                        if (p < end && *p == '/') p = ParseInt(p + 1, end, normal);
+                    }
+
+                    polygon.push_back({ ResolveIndex(position, (uint32_t)chunk.Positions.size()),
+                                        ResolveIndex(normal, (uint32_t)chunk.Normals.size()) });
+
+                    // Anything unexpected: stop reading this face instead of looping forever
+                    const char* next = SkipSpace(p, end);
+                    if (next == p && next < end && *next != '\n') break;
+                    p = next;
+                }
+
+                if (polygon.size() < 3 || std::any_of(polygon.begin(), polygon.end(),
+                                                       [](const Corner& c) { return c.Position == NO_INDEX; }))
+                {
+                    chunk.BadFaces++;
+                }
+                else
+                {
+                    for (size_t i = 1; i + 1 < polygon.size(); i++)
+                    {
+                        chunk.Corners.push_back(polygon[0]);
+                        chunk.Corners.push_back(polygon[i]);
+                        chunk.Corners.push_back(polygon[i + 1]);
+                    }
+                }
+            }
+
+            p = SkipLine(p, end);
+        }
+    }
+
+    // ---- Vertex welding -------------------------------------------------------
+
+    inline uint64_t Mix64(uint64_t k)
+    {
+        k ^= k >> 33; k *= 0xff51afd7ed558ccdull;
+        k ^= k >> 33; k *= 0xc4ceb9fe1a85ec53ull;
+        k ^= k >> 33;
+        return k;
+    }
+
+    // Open addressing, linear probing; (position, normal) -> vertex index
+    class WeldTable
+    {
+    public:
+        explicit WeldTable(size_t expected)
+        {
+            size_t capacity = 16;
+            while (capacity < expected * 2) capacity <<= 1;
+            Rehash(capacity);
+        }
+
+        // Returns the existing value, or inserts `value` and returns it
+        uint32_t FindOrInsert(uint64_t key, uint32_t value)
+        {
+            for (size_t slot = Mix64(key) & m_Mask;; slot = (slot + 1) & m_Mask)
+            {
+                if (m_Keys[slot] == key) return m_Values[slot];
+                if (m_Keys[slot] == EMPTY)
+                {
+                    m_Keys[slot] = key;
+                    m_Values[slot] = value;
+
+                    // Keep the load factor at or below 1/2
+                    if (++m_Count * 2 > m_Keys.size())
+                        Rehash(m_Keys.size() * 2);
+                    return value;
+                }
+            }
+        }
+
+    private:
+        void Rehash(size_t capacity)
+        {
+            std::vector<uint64_t> keys(capacity, EMPTY);
+            std::vector<uint32_t> values(capacity);
+            size_t mask = capacity - 1;
+
+            for (size_t i = 0; i < m_Keys.size(); i++)
+            {
+                if (m_Keys[i] == EMPTY) continue;
+                size_t slot = Mix64(m_Keys[i]) & mask;
+                while (keys[slot] != EMPTY) slot = (slot + 1) & mask;
+                keys[slot] = m_Keys[i];
+                values[slot] = m_Values[i];
+            }
+
+            m_Keys.swap(keys);
+            m_Values.swap(values);
+            m_Mask = mask;
+        }
+
+        static constexpr uint64_t EMPTY = ~0ull;
+        std::vector<uint64_t> m_Keys;
+        std::vector<uint32_t> m_Values;
+        size_t m_Mask = 0;
+        size_t m_Count = 0;
+    };
+}
+
+bool ObjImporter::Parse(const char* data, size_t size, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices,
+                        Stats* stats, uint32_t workerCount)
+{
+    auto start = std::chrono::steady_clock::now();
+    vertices.clear();
+    indices.clear();
+    if (!data || size == 0) return false;
+
+    // ---- 1. Parallel parse, chunks cut at line boundaries ----
+    if (workerCount == 0) workerCount = std::max(1u, std::thread::hardware_concurrency());
+    workerCount = (uint32_t)std::max<size_t>(1, std::min<size_t>(workerCount, size / MIN_CHUNK_BYTES));
+
+    std::vector<const char*> bounds(workerCount + 1);
+    bounds[0] = data;
+    bounds[workerCount] = data + size;
+    for (uint32_t i = 1; i < workerCount; i++)
+    {
+        const char* cut = std::max(data + size * i / workerCount, bounds[i - 1]);
+        bounds[i] = cut > data && cut[-1] == '\n' ? cut : SkipLine(cut, data + size);
+    }
+
+    std::vector<Chunk> chunks(workerCount);
+    {
+        std::vector<std::thread> workers;
+        workers.reserve(workerCount - 1);
+        for (uint32_t i = 1; i < workerCount; i++)
+            workers.emplace_back([&, i]() { ParseChunk(bounds[i], bounds[i + 1], chunks[i]); });
+        ParseChunk(bounds[0], bounds[1], chunks[0]);
+        for (auto& worker : workers) worker.join();
+    }
+
+    auto parsed = std::chrono::steady_clock::now();
+
+    // ---- 2. Concatenate + rebase chunk-relative indices ----
+    std::vector<glm::vec3> positions, normals;
+    std::vector<uint32_t> positionBase(workerCount), normalBase(workerCount);
+    size_t cornerCount = 0;
+    uint32_t badFaces = 0;
+    for (uint32_t i = 0; i < workerCount; i++)
+    {
+        positionBase[i] = (uint32_t)positions.size();
+        normalBase[i] = (uint32_t)normals.size();
+        positions.insert(positions.end(), chunks[i].Positions.begin(), chunks[i].Positions.end());
+        normals.insert(normals.end(), chunks[i].Normals.begin(), chunks[i].Normals.end());
+        cornerCount += chunks[i].Corners.size();
+        badFaces += chunks[i].BadFaces;
+    }
+
+    // ---- 3. Weld (position, normal) pairs into unique vertices ----
+    // Most positions only ever pair with one normal: remember the first pair per
+    // position in a flat array and only hash the exceptions (hard edges, seams)
+    std::vector<uint32_t> firstNormal(positions.size(), NO_INDEX - 1);
+    std::vector<uint32_t> firstVertex(positions.size());
+    WeldTable table(positions.size() / 8 + 16);
+    std::vector<bool> needsNormal;
+    vertices.reserve(positions.size());
+    indices.reserve(cornerCount);
+
+    for (uint32_t i = 0; i < workerCount; i++)
+    {
+        const std::vector<Corner>& corners = chunks[i].Corners;
+        for (size_t c = 0; c + 2 < corners.size(); c += 3)
+        {
+            uint32_t triangle[3];
+            bool valid = true;
+            for (uint32_t k = 0; k < 3 && valid; k++)
+            {
+                uint32_t position = Rebase(corners[c + k].Position, positionBase[i]);
+                uint32_t normal = Rebase(corners[c + k].Normal, normalBase[i]);
+                if (position >= positions.size()) { valid = false; break; }
+                if (normal >= normals.size()) normal = NO_INDEX;
+
+                uint32_t next = (uint32_t)vertices.size();
+                uint32_t index;
+                if (firstNormal[position] == normal)
+                {
+                    index = firstVertex[position];
+                }
+                else if (firstNormal[position] == NO_INDEX - 1)
+                {
+                    firstNormal[position] = normal;
+                    firstVertex[position] = index = next;
+                }
+                else
+                {
+                    index = table.FindOrInsert(((uint64_t)position << 32) | normal, next);
+                }
+
+                if (index == next)
+                {
+                    vertices.push_back({ positions[position], normal != NO_INDEX ? normals[normal] : glm::vec3(0.0f) });
+                    needsNormal.push_back(normal == NO_INDEX);
+                }
+                triangle[k] = index;
+            }
+
+            if (valid) indices.insert(indices.end(), triangle, triangle + 3);
+            else badFaces++;
+        }
+    }
+
+    // ---- 4. Smooth normals where the file had none ----
+    if (std::find(needsNormal.begin(), needsNormal.end(), true) != needsNormal.end())
+    {
+        for (size_t t = 0; t < indices.size(); t += 3)
+        {
+            Vertex& a = vertices[indices[t]];
+            Vertex& b = vertices[indices[t + 1]];
+            Vertex& c = vertices[indices[t + 2]];
+            glm::vec3 n = glm::cross(b.Position - a.Position, c.Position - a.Position); // Area weighted
+
+            if (needsNormal[indices[t]])     a.Normal += n;
+            if (needsNormal[indices[t + 1]]) b.Normal += n;
+            if (needsNormal[indices[t + 2]]) c.Normal += n;
+        }
+        for (size_t v = 0; v < vertices.size(); v++)
+        {
+            if (!needsNormal[v]) continue;
+            float length = glm::length(vertices[v].Normal);
+            vertices[v].Normal = length > 0.0f ? vertices[v].Normal / length : glm::vec3(0.0f, 1.0f, 0.0f);
+        }
+    }
+
+    if (badFaces > 0)
+        CORE_WARN("[ObjImporter] Skipped {0} malformed faces", badFaces);
+
+    auto end = std::chrono::steady_clock::now();
+    if (stats)
+    {
+        stats->Bytes = size;
+        stats->Threads = workerCount;
+        stats->Vertices = (uint32_t)vertices.size();
+        stats->Triangles = (uint32_t)(indices.size() / 3);
+        stats->ParseMs = std::chrono::duration<double, std::milli>(parsed - start).count();
+        stats->WeldMs = std::chrono::duration<double, std::milli>(end - parsed).count();
+        stats->TotalMs = std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    return !indices.empty();
+}
+
+bool ObjImporter::Load(const std::string& path, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices,
+                       Stats* stats, uint32_t workerCount)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    MappedFile file(path);
+    if (!file.IsOpen()) return false;
+
+    Stats local;
+    bool ok = Parse(file.GetData(), file.GetSize(), vertices, indices, &local, workerCount);
+    local.TotalMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    if (stats) *stats = local;
+    if (!ok) CORE_ERROR("[ObjImporter] '{0}' contains no faces", path);
+    return ok;
+}
+
+std::shared_ptr<Mesh> ObjImporter::Import(const std::string& path, VertexFormat format, uint32_t lodLevels)
+{
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    Stats stats;
+    if (!Load(path, vertices, indices, &stats))
+        return nullptr;
+
+    CORE_INFO("[ObjImporter] '{0}': {1} vertices, {2} triangles | {3} MB/s ({4} threads, parse {5} ms, weld {6} ms)",
+              path, stats.Vertices, stats.Triangles, stats.GetMBPerSecond(), stats.Threads, stats.ParseMs, stats.WeldMs);
+
+    return Mesh::Create(vertices, indices, format, lodLevels);
+}
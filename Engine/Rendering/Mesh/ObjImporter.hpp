@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Rendering/Mesh/VertexLayout.hpp>
+
+struct Vertex;
+class Mesh;
+
+/**
+ * ============================================================================
+ * OBJ IMPORTER - Wavefront .obj -> Vertex / index vectors
+ * ============================================================================
+ *
+ * The file is memory mapped (MappedFile) and cut into chunks at line
+ * boundaries, one std::thread per chunk. Each worker parses "v", "vn" and
+ * "f" lines with a hand-rolled number parser into chunk-local arrays;
+ * negative (relative) face indices are resolved against the chunk and
+ * rebased once every chunk's counts are known.
+ *
+ * Corners are then welded into unique (position, normal) vertices through
+ * an open-addressing hash table. Polygons are fan-triangulated. Vertices
+ * without an "vn" get an area-weighted smooth normal.
+ *
+ * Texture coordinates, groups and materials are skipped - Vertex has no
+ * slot for them yet.
+ * ============================================================================
+ */
+namespace ObjImporter
+{
+    struct Stats
+    {
+        uint64_t Bytes = 0;
+        uint32_t Threads = 0;
+        uint32_t Vertices = 0;
+        uint32_t Triangles = 0;
+        double ParseMs = 0.0;     // Parallel chunk parsing
+        double WeldMs = 0.0;      // Index rebasing + vertex deduplication + normals
+        double TotalMs = 0.0;
+
+        double GetMBPerSecond() const { return TotalMs > 0.0 ? (Bytes / (1024.0 * 1024.0)) / (TotalMs / 1000.0) : 0.0; }
+    };
+
+    // Fills vertices/indices; returns false if the file cannot be read or has no faces
+    bool Load(const std::string& path, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices,
+              Stats* stats = nullptr, uint32_t workerCount = 0);
+
+    // Same parser over an in-memory buffer (the unit Load() runs on the mapping)
+    bool Parse(const char* data, size_t size, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices,
+               Stats* stats = nullptr, uint32_t workerCount = 0);
+
+    // Load + Mesh::Create; nullptr on failure
+    std::shared_ptr<Mesh> Import(const std::string& path, VertexFormat format, uint32_t lodLevels = 0);
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+/**
+ * ============================================================================
+ * PRIMITIVE CACHE - one shared object per key, held weakly
+ * ============================================================================
+ *
+ * GetOrBuild() returns the live object for a key, or builds and remembers a
+ * new one. Entries are weak, so the cache never keeps an object alive: once
+ * the last holder lets go it is destroyed, and the next request rebuilds.
+ * Every SweepInterval inserts the expired entries are erased, so keys that
+ * come and go do not pile up.
+ *
+ * No GL and no locking - Mesh keeps one for its primitives on the main thread.
+ * ============================================================================
+ */
+struct PrimitiveCacheStats
+{
+    uint32_t Hits = 0;
+    uint32_t Misses = 0;      // Object actually built (first use or after eviction)
+    uint32_t Evictions = 0;   // Expired entries swept from the cache
+    uint32_t LiveEntries = 0;
+};
+
+template<typename T>
+class PrimitiveCache
+{
+public:
+    static constexpr uint32_t SweepInterval = 64;
+
+    template<typename BuildFn>
+    std::shared_ptr<T> GetOrBuild(uint64_t key, BuildFn&& build)
+    {
+        auto it = m_Entries.find(key);
+        if (it != m_Entries.end())
+        {
+            if (std::shared_ptr<T> object = it->second.lock())
+            {
+                m_Stats.Hits++;
+                return object;
+            }
+        }
+
+        m_Stats.Misses++;
+        std::shared_ptr<T> object = build();
+        m_Entries[key] = object;
+
+        if (++m_InsertsSinceSweep >= SweepInterval)
+            SweepExpired();
+
+        return object;
+    }
+
+    PrimitiveCacheStats GetStats() const
+    {
+        PrimitiveCacheStats stats = m_Stats;
+        stats.LiveEntries = 0;
+        for (const auto& [key, weak] : m_Entries)
+            if (!weak.expired()) stats.LiveEntries++;
+        return stats;
+    }
+
+    // Live and expired entries not swept yet
+    size_t GetEntryCount() const { return m_Entries.size(); }
+
+private:
+    void SweepExpired()
+    {
+        for (auto it = m_Entries.begin(); it != m_Entries.end();)
+        {
+            if (it->second.expired())
+            {
+                it = m_Entries.erase(it);
+                m_Stats.Evictions++;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        m_InsertsSinceSweep = 0;
+    }
+
+    std::unordered_map<uint64_t, std::weak_ptr<T>> m_Entries;
+    PrimitiveCacheStats m_Stats;
+    uint32_t m_InsertsSinceSweep = 0;
+};
@@ -0,0 +1,235 @@
+#include "VertexLayout.hpp"
+#include <glad/glad.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+#include "Mesh.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define VERTEX_ENCODE_SSE2 1
+#endif
+
+// ============================================================================
+// Layouts
+// ============================================================================
+void VertexLayout::Apply() const
+{
+    for (const VertexAttribute& attr : Attributes)
+    {
+        glEnableVertexAttribArray(attr.Location);
+        glVertexAttribPointer(attr.Location, attr.Components, attr.Type,
+                              attr.Normalized ? GL_TRUE : GL_FALSE, Stride, (void*)(size_t)attr.Offset);
+    }
+}
+
+namespace
+{
+    const VertexLayout s_Layouts[(size_t)VertexFormat::Count] =
+    {
+        // Float32
+        { 24, { { 0, 3, GL_FLOAT, false, 0 },
+                { 1, 3, GL_FLOAT, false, 12 } } },
+        // Half
+        { 16, { { 0, 4, GL_HALF_FLOAT, false, 0 },
+                { 1, 4, GL_HALF_FLOAT, false, 8 } } },
+        // Quantized
+        { 12, { { 0, 4, GL_HALF_FLOAT, false, 0 },
+                { 1, 4, GL_INT_2_10_10_10_REV, true, 8 } } },
+    };
+
+    VertexEncoder::Stats s_Stats;
+
+#ifdef VERTEX_ENCODE_SSE2
+    inline __m128i Select(__m128i mask, __m128i a, __m128i b)
+    {
+        return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+
+    // 4 floats -> 4 halves (round to nearest even), same bit tricks as FloatToHalf
+    inline void FloatToHalf4(__m128 value, uint16_t* out)
+    {
+        const __m128i signMask = _mm_set1_epi32((int)0x80000000u);
+        const __m128i f16Max = _mm_set1_epi32((127 + 16) << 23);
+        const __m128i f32Infinity = _mm_set1_epi32(255 << 23);
+        const __m128i minNormal = _mm_set1_epi32(113 << 23);
+        const __m128i normalBias = _mm_set1_epi32(((15 - 127) << 23) + 0xfff);
+        const __m128 denormMagic = _mm_castsi128_ps(_mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23));
+
+        __m128i bits = _mm_castps_si128(value);
+        __m128i sign = _mm_and_si128(bits, signMask);
+        __m128i absBits = _mm_xor_si128(bits, sign);
+
+        // Denormal / zero: let the FPU do the shift via a magic add
+        __m128i denorm = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(absBits), denormMagic)),
+                                       _mm_castps_si128(denormMagic));
+
+        // Normal: rebias exponent, round to nearest even
+        __m128i mantOdd = _mm_and_si128(_mm_srli_epi32(absBits, 13), _mm_set1_epi32(1));
+        __m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(absBits, normalBias), mantOdd), 13);
+
+        // Inf / NaN (quiet NaN keeps bit 9)
+        __m128i isNaN = _mm_cmpgt_epi32(absBits, f32Infinity);
+        __m128i infNaN = _mm_or_si128(_mm_set1_epi32(0x7c00), _mm_and_si128(isNaN, _mm_set1_epi32(0x0200)));
+
+        __m128i isDenorm = _mm_cmplt_epi32(absBits, minNormal);
+        __m128i isInfNaN = _mm_cmpgt_epi32(absBits, _mm_sub_epi32(f16Max, _mm_set1_epi32(1)));
+
+        __m128i result = Select(isDenorm, denorm, normal);
+        result = Select(isInfNaN, infNaN, result);
+        result = _mm_or_si128(result, _mm_srli_epi32(sign, 16));
+
+        // Sign-extend the low 16 bits so the saturating pack keeps the exact pattern
+        result = _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+        _mm_storel_epi64((__m128i*)out, _mm_packs_epi32(result, result));
+    }
+
+    inline uint32_t PackSnorm4(__m128 value)
+    {
+        __m128 clamped = _mm_min_ps(_mm_max_ps(value, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+        __m128i q = _mm_and_si128(_mm_cvtps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(511.0f))), _mm_set1_epi32(0x3FF));
+
+        alignas(16) uint32_t lanes[4];
+        _mm_store_si128((__m128i*)lanes, q);
+        return lanes[0] | (lanes[1] << 10) | (lanes[2] << 20);
+    }
+#endif
+
+    void EncodeHalf(const Vertex* src, uint32_t count, uint8_t* dst, bool quantizeNormal)
+    {
+        const uint32_t stride = quantizeNormal ? 12 : 16;
+
+        for (uint32_t i = 0; i < count; i++, dst += stride)
+        {
+            const glm::vec3& p = src[i].Position;
+            const glm::vec3& n = src[i].Normal;
+            uint16_t* position = (uint16_t*)dst;
+
+#ifdef VERTEX_ENCODE_SSE2
+            FloatToHalf4(_mm_setr_ps(p.x, p.y, p.z, 1.0f), position);
+            if (quantizeNormal)
+            {
+                uint32_t packed = PackSnorm4(_mm_setr_ps(n.x, n.y, n.z, 0.0f));
+                std::memcpy(dst + 8, &packed, sizeof(packed));
+            }
+            else
+            {
+                FloatToHalf4(_mm_setr_ps(n.x, n.y, n.z, 0.0f), (uint16_t*)(dst + 8));
+            }
+#else
+            position[0] = VertexEncoder::FloatToHalf(p.x);
+            position[1] = VertexEncoder::FloatToHalf(p.y);
+            position[2] = VertexEncoder::FloatToHalf(p.z);
+            position[3] = VertexEncoder::FloatToHalf(1.0f);
+            if (quantizeNormal)
+            {
+                uint32_t packed = VertexEncoder::PackSnorm10_10_10_2(n.x, n.y, n.z);
+                std::memcpy(dst + 8, &packed, sizeof(packed));
+            }
+            else
+            {
+                uint16_t* normal = (uint16_t*)(dst + 8);
+                normal[0] = VertexEncoder::FloatToHalf(n.x);
+                normal[1] = VertexEncoder::FloatToHalf(n.y);
+                normal[2] = VertexEncoder::FloatToHalf(n.z);
+                normal[3] = 0;
+            }
+#endif
+        }
+    }
+}
+
+const VertexLayout& VertexEncoder::GetLayout(VertexFormat format)
+{
+    return s_Layouts[(size_t)format];
+}
+
+const char* VertexEncoder::GetFormatName(VertexFormat format)
+{
+    switch (format)
+    {
+        case VertexFormat::Float32:   return "Float32";
+        case VertexFormat::Half:      return "Half";
+        case VertexFormat::Quantized: return "Quantized";
+        default:                      return "Unknown";
+    }
+}
+
+void VertexEncoder::Encode(VertexFormat format, const Vertex* src, uint32_t count, void* dst)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    switch (format)
+    {
+        case VertexFormat::Float32:
+            static_assert(sizeof(Vertex) == 24, "Float32 layout assumes a tightly packed Vertex");
+            std::memcpy(dst, src, (size_t)count * sizeof(Vertex));
+            break;
+        case VertexFormat::Half:
+            EncodeHalf(src, count, (uint8_t*)dst, false);
+            break;
+        case VertexFormat::Quantized:
+            EncodeHalf(src, count, (uint8_t*)dst, true);
+            break;
+        default:
+            return;
+    }
+
+    s_Stats.VerticesEncoded += count;
+    s_Stats.BytesWritten += (uint64_t)count * GetLayout(format).Stride;
+    s_Stats.EncodeMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+const VertexEncoder::Stats& VertexEncoder::GetStats()
+{
+    return s_Stats;
+}
+
+uint16_t VertexEncoder::FloatToHalf(float value)
+{
+    // Round-to-nearest-even float -> half without tables
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    uint32_t sign = bits & 0x80000000u;
+    bits ^= sign;
+
+    uint32_t result;
+    if (bits >= ((127 + 16) << 23))
+    {
+        result = (bits > (255u << 23)) ? 0x7e00 : 0x7c00; // NaN : Inf
+    }
+    else if (bits < (113u << 23))
+    {
+        // Denormal / zero
+        const uint32_t magicBits = ((127 - 15) + (23 - 10) + 1) << 23;
+        float magic, f;
+        std::memcpy(&magic, &magicBits, sizeof(magic));
+        std::memcpy(&f, &bits, sizeof(f));
+        f += magic;
+        std::memcpy(&result, &f, sizeof(result));
+        result -= magicBits;
+    }
+    else
+    {
+        uint32_t mantOdd = (bits >> 13) & 1;
+        bits += ((uint32_t)(15 - 127) << 23) + 0xfff;
+        bits += mantOdd;
+        result = bits >> 13;
+    }
+
+    return (uint16_t)(result | (sign >> 16));
+}
+
+uint32_t VertexEncoder::PackSnorm10_10_10_2(float x, float y, float z)
+{
+    auto pack = [](float v) -> uint32_t
+    {
+        // NaN -> -1 like _mm_max_ps, so both paths agree bit for bit
+        float clamped = v > -1.0f ? std::min(v, 1.0f) : -1.0f;
+        return (uint32_t)(int32_t)std::lrint(clamped * 511.0f) & 0x3FF;
+    };
+    return pack(x) | (pack(y) << 10) | (pack(z) << 20);
+}
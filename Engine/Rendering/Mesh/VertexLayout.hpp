@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+struct Vertex;
+
+// ============================================================================
+// Vertex formats (compression profiles) for arena meshes
+// ============================================================================
+//  Float32   - vec3 position + vec3 normal               24 bytes
+//  Half      - half4 position + half4 normal             16 bytes
+//  Quantized - half4 position + normal as 2_10_10_10 snorm 12 bytes
+//
+// Attribute locations are the same for every format (0 = position,
+// 1 = normal), and GL expands half / snorm to float before the shader
+// sees them. Shaders therefore work with any format unchanged.
+// ============================================================================
+enum class VertexFormat : uint8_t
+{
+    Float32 = 0,
+    Half,
+    Quantized,
+
+    Count
+};
+
+struct VertexAttribute
+{
+    uint32_t Location;
+    int32_t Components;
+    uint32_t Type;       // GL_FLOAT, GL_HALF_FLOAT, GL_INT_2_10_10_10_REV ...
+    bool Normalized;
+    uint32_t Offset;
+};
+
+struct VertexLayout
+{
+    uint32_t Stride = 0;
+    std::vector<VertexAttribute> Attributes;
+
+    // Sets the attribute pointers for the bound VAO + GL_ARRAY_BUFFER
+    void Apply() const;
+};
+
+namespace VertexEncoder
+{
+    const VertexLayout& GetLayout(VertexFormat format);
+    const char* GetFormatName(VertexFormat format);
+
+    // Converts Vertex (float32) into the packed format; dst must hold count * stride bytes
+    void Encode(VertexFormat format, const Vertex* src, uint32_t count, void* dst);
+
+    struct Stats
+    {
+        uint64_t VerticesEncoded = 0;
+        uint64_t BytesWritten = 0;
+        double EncodeMs = 0.0;
+
+        double GetMVertsPerSecond() const { return EncodeMs > 0.0 ? (VerticesEncoded / 1.0e6) / (EncodeMs / 1000.0) : 0.0; }
+    };
+    const Stats& GetStats();
+
+    // Scalar reference conversions (also the non-SSE path)
+    uint16_t FloatToHalf(float value);
+    uint32_t PackSnorm10_10_10_2(float x, float y, float z);
+}
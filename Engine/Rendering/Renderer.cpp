@@ -1,21 +1,174 @@
 #include "Renderer.hpp"
 #include <glad/glad.h>
+#include <Rendering/Shaders/ShaderCache.hpp>
+#include <Rendering/Buffers/UniformBuffer.hpp>
+#include <Rendering/GLState.hpp>
+#include <Rendering/Mesh/MeshArena.hpp>
+#include <Rendering/Buffers/StreamingBuffer.hpp>
+#include <Core/Log.hpp>
+#include <algorithm>
 
 glm::mat4 Renderer::s_ViewProjection{ 1.0f };
+std::unique_ptr<UniformBuffer> Renderer::s_CameraBuffer;
+std::unique_ptr<UniformRingBuffer> Renderer::s_ObjectBuffer;
+std::unique_ptr<StreamingBuffer> Renderer::s_IndirectBuffer;
+std::unique_ptr<StreamingBuffer> Renderer::s_InstanceBuffer;
+StreamingBuffer::Mode Renderer::s_StreamingMode = StreamingBuffer::Mode::Persistent;
+static uint32_t s_StorageAlignment = 256;
+
+static Renderer::Stats s_Stats;
+
+// CompareStreamingModes() state: SubData frames first, then Persistent.
+// Totals hold the whole phase in BytesThisFrame / UploadMsThisFrame.
+struct StreamingComparison
+{
+    uint32_t FramesPerMode = 0; // 0 = not running
+    uint32_t Frame = 0;
+    StreamingBuffer::Stats SubData;
+    StreamingBuffer::Stats Persistent;
+    bool PersistentMapped = false; // False if the driver fell back to glBufferSubData
+};
+static StreamingComparison s_Comparison;
+
+// Per-draw ring region size; ObjectBlock is padded to the UBO offset alignment (typically 256)
+static constexpr uint32_t OBJECT_RING_BYTES_PER_FRAME = 1024 * 1024;
 
 void Renderer::Init()
 {
-    glEnable(GL_DEPTH_TEST);
+    GLState::Invalidate();
+    GLState::SetDepthTest(true);
+
+    // Must run before any Shader is constructed to benefit from cached binaries
+    ShaderCache::Init();
+
+    s_CameraBuffer = std::make_unique<UniformBuffer>((uint32_t)sizeof(CameraBlock), UniformBinding::Camera);
+
+    if (GLAD_GL_VERSION_4_3)
+    {
+        GLint alignment = 0;
+        glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        if (alignment > 0)
+            s_StorageAlignment = (uint32_t)alignment;
+    }
+    else
+    {
+        CORE_INFO("[Renderer] GL 4.3 not available - multi-draw indirect disabled, using per-draw path");
+    }
+
+    CreateStreamingBuffers();
+}
+
+void Renderer::CreateStreamingBuffers()
+{
+    s_ObjectBuffer = std::make_unique<UniformRingBuffer>(OBJECT_RING_BYTES_PER_FRAME, UniformBinding::Object, s_StreamingMode);
+
+    if (GLAD_GL_VERSION_4_3)
+    {
+        // Start with one full MDI batch per frame; ReserveIndirect() grows both
+        // to the frame's draw count
+        s_IndirectBuffer = std::make_unique<StreamingBuffer>(MeshArena::MaxDrawIDs * (uint32_t)sizeof(DrawElementsIndirectCommand), s_StreamingMode);
+        s_InstanceBuffer = std::make_unique<StreamingBuffer>(MeshArena::MaxDrawIDs * (uint32_t)sizeof(InstanceData) + s_StorageAlignment, s_StreamingMode);
+    }
+}
+
+void Renderer::SetStreamingMode(StreamingBuffer::Mode mode)
+{
+    if (mode == s_StreamingMode)
+        return;
+
+    // Like StreamingBuffer::Grow, the old buffers are deleted without waiting
+    s_StreamingMode = mode;
+    if (s_ObjectBuffer)
+        CreateStreamingBuffers();
+}
+
+void Renderer::CompareStreamingModes(uint32_t framesPerMode)
+{
+    s_Comparison = {};
+    s_Comparison.FramesPerMode = std::max(framesPerMode, 1u);
+    CORE_INFO("[Renderer] Comparing streaming modes: {0} frames of glBufferSubData, then {0} of persistent map", s_Comparison.FramesPerMode);
+}
+
+void Renderer::AccumulateStreamingComparison()
+{
+    bool subData = s_Comparison.Frame < s_Comparison.FramesPerMode;
+    StreamingBuffer::Stats& total = subData ? s_Comparison.SubData : s_Comparison.Persistent;
+
+    auto add = [&total](const StreamingBuffer::Stats& frame)
+    {
+        total.BytesThisFrame += frame.BytesThisFrame;
+        total.UploadMsThisFrame += frame.UploadMsThisFrame;
+    };
+    add(s_ObjectBuffer->GetStats());
+    if (s_IndirectBuffer)
+    {
+        add(s_IndirectBuffer->GetStats());
+        add(s_InstanceBuffer->GetStats());
+    }
+    if (!subData)
+        s_Comparison.PersistentMapped = s_ObjectBuffer->IsPersistent();
+
+    if (++s_Comparison.Frame < s_Comparison.FramesPerMode * 2)
+        return;
+
+    const StreamingComparison& c = s_Comparison;
+    double subDataMBs = c.SubData.GetMBPerSecond();
+    double persistentMBs = c.Persistent.GetMBPerSecond();
+    CORE_INFO("[Renderer] Streaming comparison, {0} frames each, {1} KB/frame:", c.FramesPerMode,
+              c.Persistent.BytesThisFrame / c.FramesPerMode / 1024);
+    CORE_INFO("[Renderer]   glBufferSubData: {0} MB/s, {1} ms/frame", subDataMBs, c.SubData.UploadMsThisFrame / c.FramesPerMode);
+    CORE_INFO("[Renderer]   persistent map{0}: {1} MB/s, {2} ms/frame ({3}x)",
+              c.PersistentMapped ? "" : " (unavailable, fell back to glBufferSubData)", persistentMBs,
+              c.Persistent.UploadMsThisFrame / c.FramesPerMode, subDataMBs > 0.0 ? persistentMBs / subDataMBs : 0.0);
+    s_Comparison = {};
+}
+
+void Renderer::Shutdown()
+{
+    // Must run while the GL context is still current
+    s_ObjectBuffer.reset();
+    s_CameraBuffer.reset();
+    s_IndirectBuffer.reset();
+    s_InstanceBuffer.reset();
+    MeshArena::Shutdown();
 }
 
 void Renderer::BeginScene(const glm::mat4& viewProj)
 {
+    s_Stats = {};
+    GLState::ResetStats();
     s_ViewProjection = viewProj;
+
+    CameraBlock camera{ viewProj };
+    s_CameraBuffer->SetData(&camera, sizeof(camera));
+
+    if (s_Comparison.FramesPerMode)
+        SetStreamingMode(s_Comparison.Frame < s_Comparison.FramesPerMode ? StreamingBuffer::Mode::SubData : StreamingBuffer::Mode::Persistent);
+
+    s_ObjectBuffer->BeginFrame();
+    if (s_IndirectBuffer)
+    {
+        s_IndirectBuffer->BeginFrame();
+        s_InstanceBuffer->BeginFrame();
+    }
 }
 
 void Renderer::EndScene()
 {
-    // For now, nothing to do. Later: flush draw queues, etc.
+    s_ObjectBuffer->EndFrame();
+    if (s_IndirectBuffer)
+    {
+        s_IndirectBuffer->EndFrame();
+        s_InstanceBuffer->EndFrame();
+    }
+
+    const StreamingBuffer::Stats& stream = s_ObjectBuffer->GetStats();
+    s_Stats.StreamedBytes = stream.BytesThisFrame;
+    s_Stats.StreamedMBPerSecond = stream.GetMBPerSecond();
+    s_Stats.StreamPersistent = s_ObjectBuffer->IsPersistent();
+
+    if (s_Comparison.FramesPerMode)
+        AccumulateStreamingComparison();
 }
 
 void Renderer::Clear(const glm::vec4& color)
@@ -26,20 +179,103 @@ void Renderer::Clear(const glm::vec4& color)
 
 void Renderer::Submit(const std::shared_ptr<Mesh>& mesh,
                       const glm::mat4& transform,
-                      Shader& shader)
+                      Shader& shader,
+                      const glm::vec4& color)
 {
-    if (!mesh || !mesh->GetVertexArray())
+    if (!mesh || !mesh->IsValid())
         return;
 
     shader.Bind();
-    shader.SetMat4("u_ViewProj", s_ViewProjection);
-    shader.SetMat4("u_Model", transform);
+    SetObjectData(transform, color);
+    DrawMesh(*mesh);
+}
+
+void Renderer::SetObjectData(const glm::mat4& transform, const glm::vec4& color)
+{
+    ObjectBlock object{ transform, color };
+    s_ObjectBuffer->Push(&object, sizeof(object));
+}
+
+void Renderer::DrawIndexed(const VertexArray* vertexArray, uint32_t indexCount)
+{
+    if (vertexArray->Bind())
+        s_Stats.VertexArrayBinds++;
+
+    glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
+    s_Stats.DrawCalls++;
+}
+
+void Renderer::DrawMesh(const Mesh& mesh)
+{
+    // Every arena mesh of a format shares one VAO - only format switches rebind
+    if (MeshArena::Bind(mesh.GetFormat()))
+        s_Stats.VertexArrayBinds++;
 
-    VertexArray* va = mesh->GetVertexArray();
-    va->Bind();
+    glDrawElementsBaseVertex(GL_TRIANGLES, mesh.GetIndexCount(), GL_UNSIGNED_INT,
+                             (void*)((size_t)mesh.GetFirstIndex() * sizeof(uint32_t)),
+                             (GLint)mesh.GetBaseVertex());
+    s_Stats.DrawCalls++;
+    s_Stats.Triangles += mesh.GetIndexCount() / 3;
+}
 
-    glDrawElements(GL_TRIANGLES,
-                   mesh->GetIndexCount(),
-                   GL_UNSIGNED_INT,
-                   nullptr);
+void Renderer::ReserveIndirect(uint32_t drawCount)
+{
+    if (!s_IndirectBuffer || drawCount == 0)
+        return;
+
+    // Every DrawIndirect batch (one per format, more past MaxDrawIDs) may pad its instances to the SSBO alignment
+    uint32_t batches = (uint32_t)VertexFormat::Count + drawCount / MeshArena::MaxDrawIDs;
+    s_IndirectBuffer->Reserve(drawCount * (uint32_t)sizeof(DrawElementsIndirectCommand));
+    s_InstanceBuffer->Reserve(drawCount * (uint32_t)sizeof(InstanceData) + batches * s_StorageAlignment);
+}
+
+void Renderer::DrawIndirect(VertexFormat format,
+                            const std::vector<DrawElementsIndirectCommand>& commands,
+                            const std::vector<InstanceData>& instances,
+                            uint32_t first, uint32_t count)
+{
+    if (!s_IndirectBuffer || count == 0 || commands.size() != instances.size() || first + count > commands.size())
+        return;
+
+    if (MeshArena::Bind(format))
+        s_Stats.VertexArrayBinds++;
+
+    const uint32_t end = first + count;
+    std::vector<DrawElementsIndirectCommand> rebased;
+
+    for (uint32_t begin = first; begin < end; begin += MeshArena::MaxDrawIDs)
+    {
+        uint32_t batchCount = std::min(MeshArena::MaxDrawIDs, end - begin);
+
+        // Draw IDs restart at 0 for each batch
+        const DrawElementsIndirectCommand* batch = commands.data() + begin;
+        if (begin > 0)
+        {
+            rebased.assign(batch, batch + batchCount);
+            for (auto& cmd : rebased) cmd.BaseInstance -= begin;
+            batch = rebased.data();
+        }
+
+        uint32_t instanceBytes = batchCount * (uint32_t)sizeof(InstanceData);
+        uint32_t instanceOffset = s_InstanceBuffer->Append(instances.data() + begin, instanceBytes, s_StorageAlignment);
+        uint32_t commandOffset = s_IndirectBuffer->Append(batch, batchCount * (uint32_t)sizeof(DrawElementsIndirectCommand));
+        if (instanceOffset == StreamingBuffer::InvalidOffset || commandOffset == StreamingBuffer::InvalidOffset)
+            return;
+
+        GLState::BindStorageBufferRange(InstanceStorageBinding, s_InstanceBuffer->GetRendererID(), instanceOffset, instanceBytes);
+        if (GLState::BindBuffer(GL_DRAW_INDIRECT_BUFFER, s_IndirectBuffer->GetRendererID()))
+            s_Stats.BufferBinds++;
+        s_Stats.BufferBinds++;
+
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (const void*)(size_t)commandOffset, (GLsizei)batchCount, 0);
+        s_Stats.DrawCalls++;
+        s_Stats.IndirectCommands += batchCount;
+        for (uint32_t i = begin; i < begin + batchCount; i++)
+            s_Stats.Triangles += commands[i].Count / 3;
+    }
+}
+
+Renderer::Stats& Renderer::GetStats()
+{
+    return s_Stats;
 }
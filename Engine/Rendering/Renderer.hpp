@@ -2,15 +2,49 @@
 
 #include <glm/glm.hpp>
 #include <memory>
+#include <vector>
 
 #include <Rendering/Mesh/Mesh.hpp>
 #include <Rendering/Shaders/Shader.hpp>
 #include <Rendering/Buffers/VertexArray.hpp>
+#include <Rendering/Buffers/StreamingBuffer.hpp>
+#include <Rendering/IndirectDraw.hpp>
+
+class UniformBuffer;
+class UniformRingBuffer;
 
 class Renderer
 {
 public:
+    // GL calls issued through the renderer since the last BeginScene
+    struct Stats
+    {
+        uint32_t DrawCalls = 0;
+        uint32_t IndirectCommands = 0; // Draws folded into glMultiDrawElementsIndirect
+        uint32_t ProgramBinds = 0;
+        uint32_t VertexArrayBinds = 0;
+        uint32_t UniformCalls = 0;   // glUniform*
+        uint32_t BufferUploads = 0;  // glBufferSubData
+        uint32_t BufferBinds = 0;    // glBindBuffer / glBindBufferRange
+        uint64_t Triangles = 0;
+
+        // Per-draw data streamed this frame (filled in by EndScene)
+        uint64_t StreamedBytes = 0;
+        double StreamedMBPerSecond = 0.0;
+        bool StreamPersistent = false;
+
+        double CommandBuildMs = 0.0;  // CPU time building indirect commands (set by the caller)
+
+        uint32_t GetTotalGLCalls() const
+        {
+            return DrawCalls + ProgramBinds + VertexArrayBinds + UniformCalls + BufferUploads + BufferBinds;
+        }
+    };
+
     static void Init();
+    static void Shutdown();
+
+    // Uploads the camera block once and opens a new per-draw ring region
     static void BeginScene(const glm::mat4& viewProj);
     static void EndScene();
 
@@ -19,8 +53,54 @@ public:
     // Submit a mesh with a model transform and a shader
     static void Submit(const std::shared_ptr<Mesh>& mesh,
                        const glm::mat4& transform,
-                       Shader& shader);
+                       Shader& shader,
+                       const glm::vec4& color = glm::vec4(1.0f));
+
+    // Streams the Object block (model + color) for the next draw
+    static void SetObjectData(const glm::mat4& transform, const glm::vec4& color);
+    static void DrawIndexed(const VertexArray* vertexArray, uint32_t indexCount);
+    // Draws a mesh from the shared MeshArena (glDrawElementsBaseVertex)
+    static void DrawMesh(const Mesh& mesh);
+
+    // GL 4.3: SSBOs + glMultiDrawElementsIndirect. Callers fall back to DrawMesh otherwise.
+    static bool SupportsMultiDrawIndirect() { return s_IndirectBuffer != nullptr; }
+
+    // Sizes this frame's command / instance regions for `drawCount` DrawIndirect
+    // commands across all formats, so they never reallocate mid-frame
+    static void ReserveIndirect(uint32_t drawCount);
+
+    // Draws commands [first, first + count), all from the arena of `format`.
+    // One glMultiDrawElementsIndirect per MeshArena::MaxDrawIDs commands. Command i must
+    // use BaseInstance = i to read instances[i]; the bound shader reads the
+    // "Instances" SSBO at binding InstanceStorageBinding.
+    static void DrawIndirect(VertexFormat format,
+                             const std::vector<DrawElementsIndirectCommand>& commands,
+                             const std::vector<InstanceData>& instances,
+                             uint32_t first, uint32_t count);
+
+    static constexpr uint32_t InstanceStorageBinding = 0;
+
+    // Recreates the per-draw, command and instance streams in `mode`; call
+    // outside BeginScene/EndScene. Persistent still falls back without GL 4.4.
+    static void SetStreamingMode(StreamingBuffer::Mode mode);
+    static StreamingBuffer::Mode GetStreamingMode() { return s_StreamingMode; }
+
+    // Debug A/B (--compare-streaming): the next `framesPerMode` scenes stream
+    // through glBufferSubData, the following ones through the persistent map,
+    // then both modes' MB/s are logged side by side and Persistent stays on
+    static void CompareStreamingModes(uint32_t framesPerMode = 300);
+
+    static Stats& GetStats();
 
 private:
+    static void CreateStreamingBuffers();
+    // Adds this frame's streamed bytes / upload time to the running comparison
+    static void AccumulateStreamingComparison();
+
     static glm::mat4 s_ViewProjection;
+    static std::unique_ptr<UniformBuffer> s_CameraBuffer;
+    static std::unique_ptr<UniformRingBuffer> s_ObjectBuffer;
+    static std::unique_ptr<StreamingBuffer> s_IndirectBuffer;
+    static std::unique_ptr<StreamingBuffer> s_InstanceBuffer;
+    static StreamingBuffer::Mode s_StreamingMode;
 };
@@ -1,8 +1,34 @@
 #include "SceneRenderer.hpp"
 #include <glad/glad.h>
 #include <Rendering/Renderer.hpp>
+#include <Rendering/GLState.hpp>
+#include <Rendering/Mesh/MeshArena.hpp>
+#include <Rendering/Mesh/MeshOptimizer.hpp>
+#include <Rendering/TextureCompressor.hpp>
+#include <Rendering/TextureStreamer.hpp>
 #include <Scene/Components.hpp>
 #include <Core/Log.hpp>
+#include <Rendering/Shaders/ShaderCache.hpp>
+#include <Core/Resources/ResourceManager.hpp>
+#include <chrono>
+#include <filesystem>
+
+namespace
+{
+    // assets/shaders/<name>.glsl wins when present - it hot-reloads on save.
+    // The built-in source keeps a bare executable rendering.
+    std::shared_ptr<Shader> LoadBuiltInShader(const std::string& name, const std::string& vertexSource, const std::string& fragmentSource)
+    {
+        const std::string path = "assets/shaders/" + name + ".glsl";
+        std::error_code error;
+        if (std::filesystem::exists(path, error))
+        {
+            if (std::shared_ptr<Shader> shader = ResourceManager::LoadShaderFromFile(name, path))
+                return shader;
+        }
+        return ResourceManager::LoadShader(name, vertexSource, fragmentSource);
+    }
+}
 
 SceneRenderer::SceneRenderer()
 {
@@ -14,12 +40,12 @@ void SceneRenderer::Init()
     m_Framebuffer = std::make_shared<Framebuffer>(m_ViewportWidth, m_ViewportHeight);
 
     // Initialize Shader (Basic Shader copied from EditorLayer)
-    // In a real engine, this would be loaded from assets
+    // Fallback source for when assets/shaders/Basic.glsl is missing
     std::string vs = R"(
 #version 410 core
 layout(location = 0) in vec3 aPos;
-uniform mat4 u_Model;
-uniform mat4 u_ViewProj;
+layout(std140) uniform Camera { mat4 u_ViewProj; };
+layout(std140) uniform Object { mat4 u_Model; vec4 u_Color; };
 void main()
 {
     gl_Position = u_ViewProj * u_Model * vec4(aPos, 1.0);
@@ -28,13 +54,15 @@ void main()
     std::string fs = R"(
 #version 410 core
 out vec4 FragColor;
-uniform vec4 u_Color;
+layout(std140) uniform Object { mat4 u_Model; vec4 u_Color; };
 void main()
 {
     FragColor = u_Color;
 }
 )";
-    m_Shader = std::make_shared<Shader>(vs, fs);
+    auto shaderStart = std::chrono::steady_clock::now();
+    m_Shader = LoadBuiltInShader("Basic", vs, fs);
+    double shaderMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - shaderStart).count();
     
     // Check if shader is valid
     if (!m_Shader || !m_Shader->IsValid())
@@ -43,7 +71,43 @@ void main()
     }
     else
     {
-        CORE_INFO("[SceneRenderer] Shader compiled successfully.");
+        if (Renderer::SupportsMultiDrawIndirect())
+        {
+            // Same output as above; model + color come from the instance SSBO,
+            // indexed by the arena's per-instance draw-ID attribute
+            std::string indirectVs = R"(
+#version 430 core
+layout(location = 0) in vec3 aPos;
+layout(location = 2) in uint aDrawID;
+layout(std140) uniform Camera { mat4 u_ViewProj; };
+struct InstanceData { mat4 Model; vec4 Color; };
+layout(std430, binding = 0) readonly buffer Instances { InstanceData u_Instances[]; };
+flat out vec4 v_Color;
+void main()
+{
+    InstanceData instance = u_Instances[aDrawID];
+    v_Color = instance.Color;
+    gl_Position = u_ViewProj * instance.Model * vec4(aPos, 1.0);
+}
+)";
+            std::string indirectFs = R"(
+#version 430 core
+flat in vec4 v_Color;
+out vec4 FragColor;
+void main()
+{
+    FragColor = v_Color;
+}
+)";
+            // Kept even if it fails to compile, so a fixed BasicIndirect.glsl hot-reloads into use
+            m_IndirectShader = LoadBuiltInShader("BasicIndirect", indirectVs, indirectFs);
+            if (!m_IndirectShader->IsValid())
+                CORE_WARN("[SceneRenderer] Indirect shader failed - using per-draw path");
+        }
+
+        CORE_INFO("[SceneRenderer] Shader ready in {0} ms ({1} cache)", shaderMs,
+                  ShaderCache::GetStats().Hits > 0 ? "warm" : "cold");
+        ShaderCache::LogStats("SceneRenderer::Init");
     }
 }
 
@@ -76,12 +140,11 @@ void SceneRenderer::RenderEditor(Scene* scene, const EditorCamera& camera, Entit
     m_Framebuffer->Bind();
     
     // 1. Clear Command
-    glEnable(GL_DEPTH_TEST);
+    GLState::SetDepthTest(true);
     Renderer::Clear({ 0.12f, 0.12f, 0.14f, 1.0f });
 
-    // 2. Setup Scene Context
-    m_Shader->Bind();
-    m_Shader->SetMat4("u_ViewProj", camera.GetViewProjection());
+    // 2. Setup Scene Context - camera block is uploaded once per frame
+    Renderer::BeginScene(camera.GetViewProjection());
 
     // DEBUG: Log rendering state (only once)
     static bool logged = false;
@@ -89,7 +152,7 @@ void SceneRenderer::RenderEditor(Scene* scene, const EditorCamera& camera, Entit
     {
         auto& reg = scene->Reg();
         int meshCount = 0;
-        reg.view<TransformComponent, MeshComponent>().each([&](auto, auto&, auto&) { meshCount++; });
+        reg.view<WorldTransformComponent, MeshComponent>().each([&](auto, auto&, auto&) { meshCount++; });
         
         CORE_INFO("[SceneRenderer DEBUG] Rendering {0} meshes", meshCount);
         CORE_INFO("[SceneRenderer DEBUG] Camera Position: ({0}, {1}, {2})", 
@@ -100,23 +163,62 @@ void SceneRenderer::RenderEditor(Scene* scene, const EditorCamera& camera, Entit
 
     // 3. Render All Meshes
     auto& reg = scene->Reg();
+
+    // Transforms edited since Scene::OnUpdate (inspector, undo) - free when nothing changed
+    scene->GetTransforms().Update();
     
     // Default blue-ish color for objects
-    m_Shader->SetFloat4("u_Color", glm::vec4(0.2f, 0.7f, 1.0f, 1.0f));
+    const glm::vec4 meshColor(0.2f, 0.7f, 1.0f, 1.0f);
+
+    // Screen-space error LOD: level per entity, kept on the component for hysteresis
+    m_LODSelector.SetCamera(camera.GetPosition(), camera.GetProjectionMatrix(), (float)m_ViewportHeight);
+    auto selectLOD = [this](const glm::mat4& model, MeshComponent& meshComp) -> const Mesh&
+    {
+        meshComp.LOD = m_LODSelector.Select(*meshComp.MeshHandle, model, meshComp.LOD);
+        return meshComp.MeshHandle->GetLOD(meshComp.LOD);
+    };
 
     int renderedCount = 0;
-    reg.view<TransformComponent, MeshComponent>().each([&](auto entity, TransformComponent& transform, MeshComponent& meshComp)
+    if (m_IndirectShader && m_IndirectShader->IsValid())
     {
-        if (!meshComp.MeshHandle) return;
-        
-        m_Shader->SetMat4("u_Model", transform.GetMatrix());
-        
-        // This is a "Renderer::Submit" internal call effectively
-        auto* va = meshComp.MeshHandle->GetVertexArray();
-        va->Bind();
-        glDrawElements(GL_TRIANGLES, meshComp.MeshHandle->GetIndexCount(), GL_UNSIGNED_INT, nullptr);
-        renderedCount++;
-    });
+        // Whole opaque pass in one glMultiDrawElementsIndirect per vertex format
+        auto buildStart = std::chrono::steady_clock::now();
+
+        m_DrawBuilder.Clear();
+        reg.view<WorldTransformComponent, MeshComponent>().each([&](auto, WorldTransformComponent& world, MeshComponent& meshComp)
+        {
+            if (meshComp.MeshHandle && meshComp.MeshHandle->IsValid())
+                m_DrawBuilder.Add(world.Matrix, selectLOD(world.Matrix, meshComp));
+        });
+        m_DrawBuilder.Build(meshColor, 0);
+
+        Renderer::GetStats().CommandBuildMs =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - buildStart).count();
+
+        // One multi-draw per vertex format in use, all streamed into regions sized up front
+        Renderer::ReserveIndirect(m_DrawBuilder.GetCount());
+        m_IndirectShader->Bind();
+        for (size_t f = 0; f < (size_t)VertexFormat::Count; f++)
+        {
+            IndirectDrawBuilder::Range range = m_DrawBuilder.GetRange((VertexFormat)f);
+            Renderer::DrawIndirect((VertexFormat)f, m_DrawBuilder.GetCommands(), m_DrawBuilder.GetInstances(),
+                                   range.First, range.Count);
+        }
+        renderedCount = (int)m_DrawBuilder.GetCount();
+    }
+    else
+    {
+        m_Shader->Bind();
+        reg.view<WorldTransformComponent, MeshComponent>().each([&](auto entity, WorldTransformComponent& world, MeshComponent& meshComp)
+        {
+            if (!meshComp.MeshHandle || !meshComp.MeshHandle->IsValid()) return;
+
+            // Per-draw block goes into the ring buffer, bound with a dynamic offset
+            Renderer::SetObjectData(world.Matrix, meshColor);
+            Renderer::DrawMesh(selectLOD(world.Matrix, meshComp));
+            renderedCount++;
+        });
+    }
 
     // DEBUG: Log if nothing was rendered
     static bool warnedOnce = false;
@@ -127,30 +229,54 @@ void SceneRenderer::RenderEditor(Scene* scene, const EditorCamera& camera, Entit
     }
 
     // 4. Render Selection Outline
-    if (selectedEntity && selectedEntity.HasComponent<MeshComponent>())
+    if (selectedEntity && selectedEntity.HasComponent<MeshComponent>() && selectedEntity.HasComponent<WorldTransformComponent>())
     {
         auto& mc = selectedEntity.GetComponent<MeshComponent>();
-        if (mc.MeshHandle)
+        if (mc.MeshHandle && mc.MeshHandle->IsValid())
         {
-            auto& tc = selectedEntity.GetComponent<TransformComponent>();
+            auto& world = selectedEntity.GetComponent<WorldTransformComponent>();
             
             // Wireframe pass
-            glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-            glLineWidth(4.0f);
-            
-            m_Shader->SetFloat4("u_Color", glm::vec4(1.0f, 0.5f, 0.0f, 1.0f)); // Orange
-            m_Shader->SetMat4("u_Model", tc.GetMatrix());
+            m_Shader->Bind();
+            GLState::SetWireframe(true);
+            GLState::SetLineWidth(4.0f);
             
-            auto* va = mc.MeshHandle->GetVertexArray();
-            va->Bind();
-            glDrawElements(GL_TRIANGLES, mc.MeshHandle->GetIndexCount(), GL_UNSIGNED_INT, nullptr);
+            Renderer::SetObjectData(world.Matrix, glm::vec4(1.0f, 0.5f, 0.0f, 1.0f)); // Orange
+            Renderer::DrawMesh(mc.MeshHandle->GetLOD(mc.LOD));
             
-            // Restore state
-            glLineWidth(1.0f);
-            glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+            // Only polygon mode needs restoring - line width is used by this pass alone
+            GLState::SetWireframe(false);
         }
     }
 
+    Renderer::EndScene();
+    m_FrameStats = Renderer::GetStats();
+
+    static bool loggedStats = false;
+    if (!loggedStats)
+    {
+        CORE_INFO("[SceneRenderer] Frame GL calls: {0} ({1} draws, {2} program binds, {3} VAO binds, {4} uniform calls, {5} buffer uploads, {6} buffer binds)",
+                  m_FrameStats.GetTotalGLCalls(), m_FrameStats.DrawCalls, m_FrameStats.ProgramBinds, m_FrameStats.VertexArrayBinds,
+                  m_FrameStats.UniformCalls, m_FrameStats.BufferUploads, m_FrameStats.BufferBinds);
+        CORE_INFO("[SceneRenderer] Opaque pass: {0} ({1} indirect commands, built in {2} ms, {3} triangles)",
+                  m_IndirectShader && m_IndirectShader->IsValid() ? "multi-draw indirect" : "per-draw", m_FrameStats.IndirectCommands, m_FrameStats.CommandBuildMs,
+                  m_FrameStats.Triangles);
+        CORE_INFO("[SceneRenderer] Streamed {0} bytes of per-draw data at {1} MB/s ({2})",
+                  m_FrameStats.StreamedBytes, m_FrameStats.StreamedMBPerSecond,
+                  m_FrameStats.StreamPersistent ? "persistent map" : "glBufferSubData");
+        CORE_INFO("[SceneRenderer] GL state cache: {0} state changes issued, {1} redundant skipped",
+                  GLState::GetStats().Issued, GLState::GetStats().Redundant);
+        MeshArena::LogStats();
+        MeshOptimizer::LogStats();
+        TextureCompressor::LogStats();
+        TextureStreamer::LogStats();
+
+        Mesh::PrimitiveCacheStats primitives = Mesh::GetPrimitiveCacheStats();
+        CORE_INFO("[SceneRenderer] Primitive cache: {0} live, {1} hits, {2} builds, {3} evicted",
+                  primitives.LiveEntries, primitives.Hits, primitives.Misses, primitives.Evictions);
+        loggedStats = true;
+    }
+
     m_Framebuffer->Unbind();
 }
 
@@ -6,6 +6,9 @@
 #include <Rendering/Camera/EditorCamera.hpp>
 #include <Rendering/Framebuffer/Framebuffer.hpp>
 #include <Rendering/Shaders/Shader.hpp>
+#include <Rendering/Renderer.hpp>
+#include <Rendering/IndirectDraw.hpp>
+#include <Rendering/LODSelector.hpp>
 
 class SceneRenderer
 {
@@ -27,9 +30,17 @@ public:
     // Accessor to the framebuffer in case we need it
     std::shared_ptr<Framebuffer> GetFramebuffer() const { return m_Framebuffer; }
 
+    // GL calls issued by the last RenderEditor call
+    const Renderer::Stats& GetFrameStats() const { return m_FrameStats; }
+
 private:
     std::shared_ptr<Framebuffer> m_Framebuffer;
-    std::shared_ptr<Shader> m_Shader; // Basic shader for now
+    std::shared_ptr<Shader> m_Shader; // Basic shader for now (per-draw UBO path)
+    std::shared_ptr<Shader> m_IndirectShader; // GL 4.3 multi-draw indirect path
+
+    IndirectDrawBuilder m_DrawBuilder;
+    LODSelector m_LODSelector;
+    Renderer::Stats m_FrameStats;
 
     uint32_t m_ViewportWidth = 1280;
     uint32_t m_ViewportHeight = 720;
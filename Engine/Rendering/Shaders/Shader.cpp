@@ -4,6 +4,13 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <Core/Log.hpp>
 #include <Core/GLDebug.hpp>
+#include <chrono>
+#include <algorithm>
+
+#include "ShaderCache.hpp"
+#include <Rendering/Renderer.hpp>
+#include <Rendering/GLState.hpp>
+#include <Rendering/Buffers/UniformBuffer.hpp>
 
 // ============================================================================
 // Shader Compilation - Professional Error Handling (Unity/Unreal Standard)
@@ -39,6 +46,21 @@ static uint32_t CompileShader(uint32_t type, const std::string& src)
 
 Shader::Shader(const std::string& vertexSrc, const std::string& fragmentSrc)
 {
+    // Fast path: previously linked binary for this exact source + driver
+    uint64_t cacheKey = 0;
+    if (ShaderCache::IsEnabled())
+    {
+        cacheKey = ShaderCache::ComputeKey(vertexSrc, fragmentSrc);
+        m_RendererID = ShaderCache::Load(cacheKey);
+        if (m_RendererID != 0)
+        {
+            ReflectUniforms();
+            return;
+        }
+    }
+
+    auto compileStart = std::chrono::steady_clock::now();
+
     uint32_t vs = CompileShader(GL_VERTEX_SHADER, vertexSrc);
     uint32_t fs = CompileShader(GL_FRAGMENT_SHADER, fragmentSrc);
 
@@ -53,6 +75,8 @@ Shader::Shader(const std::string& vertexSrc, const std::string& fragmentSrc)
     }
 
     m_RendererID = glCreateProgram();
+    if (ShaderCache::IsEnabled())
+        glProgramParameteri(m_RendererID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
     glAttachShader(m_RendererID, vs);
     glAttachShader(m_RendererID, fs);
     glLinkProgram(m_RendererID);
@@ -76,58 +100,154 @@ Shader::Shader(const std::string& vertexSrc, const std::string& fragmentSrc)
     // Clean up shader objects (they're linked into program now)
     glDeleteShader(vs);
     glDeleteShader(fs);
+
+    ShaderCache::GetStats().CompileMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - compileStart).count();
+
+    if (m_RendererID != 0 && ShaderCache::IsEnabled())
+        ShaderCache::Store(cacheKey, m_RendererID);
+
+    if (m_RendererID != 0)
+        ReflectUniforms();
 }
 
 Shader::~Shader()
 {
     if (m_RendererID != 0)
+    {
         glDeleteProgram(m_RendererID);
+        GLState::OnProgramDeleted(m_RendererID);
+    }
+}
+
+bool Shader::Reload(const std::string& vertexSrc, const std::string& fragmentSrc)
+{
+    Shader fresh(vertexSrc, fragmentSrc);
+    if (!fresh.IsValid()) return false;
+
+    // The old program leaves with `fresh`
+    std::swap(m_RendererID, fresh.m_RendererID);
+    m_Uniforms.swap(fresh.m_Uniforms);
+    m_MissingWarned.clear();
+    return true;
 }
 
 void Shader::Bind() const
 {
-    if (m_RendererID != 0)
-        GL_CALL(glUseProgram(m_RendererID));
+    if (m_RendererID != 0 && GLState::UseProgram(m_RendererID))
+        Renderer::GetStats().ProgramBinds++;
 }
 
 void Shader::Unbind() const
 {
-    GL_CALL(glUseProgram(0));
+    GLState::UseProgram(0);
 }
 
-int Shader::GetUniformLocation(const std::string& name)
+void Shader::ReflectUniforms()
+{
+    m_Uniforms.clear();
+
+    int count = 0, maxLength = 0;
+    glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+    std::string name(std::max(maxLength, 1), '\0');
+    m_Uniforms.reserve(count);
+    for (int i = 0; i < count; i++)
+    {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(m_RendererID, (GLuint)i, maxLength, &length, &size, &type, name.data());
+
+        std::string_view uniformName(name.data(), length);
+
+        // Arrays are reported as "u_Name[0]" - register them under the bare name too
+        if (uniformName.size() > 3 && uniformName.substr(uniformName.size() - 3) == "[0]")
+            uniformName.remove_suffix(3);
+
+        int location = glGetUniformLocation(m_RendererID, std::string(uniformName).c_str());
+        if (location == -1)
+            continue; // Uniform block members have no location
+
+        m_Uniforms.push_back({ Hash::Fnv1a32(uniformName), location });
+    }
+
+    std::sort(m_Uniforms.begin(), m_Uniforms.end(),
+              [](const UniformSlot& a, const UniformSlot& b) { return a.Hash < b.Hash; });
+
+    for (size_t i = 1; i < m_Uniforms.size(); i++)
+    {
+        if (m_Uniforms[i].Hash == m_Uniforms[i - 1].Hash)
+            CORE_ERROR("[Shader] Uniform name hash collision (hash {0}) - rename one of the uniforms", m_Uniforms[i].Hash);
+    }
+
+    // Uniform blocks: attach known block names to the engine's fixed binding points
+    int blockCount = 0;
+    glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORM_BLOCKS, &blockCount);
+    for (int i = 0; i < blockCount; i++)
+    {
+        char blockName[64];
+        glGetActiveUniformBlockName(m_RendererID, (GLuint)i, sizeof(blockName), nullptr, blockName);
+
+        int binding = UniformBinding::FromBlockName(blockName);
+        if (binding < 0)
+        {
+            CORE_WARN("[Shader] Unknown uniform block '{0}' - left at binding 0", blockName);
+            continue;
+        }
+        glUniformBlockBinding(m_RendererID, (GLuint)i, (GLuint)binding);
+    }
+}
+
+int Shader::GetUniformLocation(UniformID id)
 {
     if (m_RendererID == 0) return -1; // Invalid shader
 
-    auto it = m_UniformLocationCache.find(name);
-    if (it != m_UniformLocationCache.end())
-        return it->second;
+    auto it = std::lower_bound(m_Uniforms.begin(), m_Uniforms.end(), id.Hash,
+                               [](const UniformSlot& slot, uint32_t hash) { return slot.Hash < hash; });
+    if (it != m_Uniforms.end() && it->Hash == id.Hash)
+        return it->Location;
 
-    int loc = glGetUniformLocation(m_RendererID, name.c_str());
-    if (loc == -1)
-        CORE_WARN("[Shader] Uniform '{0}' not found or unused", name);
-        
-    m_UniformLocationCache[name] = loc;
-    return loc;
+    if (std::find(m_MissingWarned.begin(), m_MissingWarned.end(), id.Hash) == m_MissingWarned.end())
+    {
+        CORE_WARN("[Shader] Uniform '{0}' not found or unused", id.Name);
+        m_MissingWarned.push_back(id.Hash);
+    }
+    return -1;
+}
+
+void Shader::SetMat4(UniformID id, const glm::mat4& value)
+{
+    Set(UniformHandle<glm::mat4>{ GetUniformLocation(id) }, value);
+}
+
+void Shader::SetFloat3(UniformID id, const glm::vec3& value)
+{
+    Set(UniformHandle<glm::vec3>{ GetUniformLocation(id) }, value);
+}
+
+void Shader::SetFloat4(UniformID id, const glm::vec4& value)
+{
+    Set(UniformHandle<glm::vec4>{ GetUniformLocation(id) }, value);
 }
 
-void Shader::SetMat4(const std::string& name, const glm::mat4& value)
+void Shader::Set(UniformHandle<glm::mat4> handle, const glm::mat4& value)
 {
-    int loc = GetUniformLocation(name);
-    if (loc != -1)
-        glUniformMatrix4fv(loc, 1, GL_FALSE, glm::value_ptr(value));
+    if (handle.Location == -1) return;
+    glUniformMatrix4fv(handle.Location, 1, GL_FALSE, glm::value_ptr(value));
+    Renderer::GetStats().UniformCalls++;
 }
 
-void Shader::SetFloat3(const std::string& name, const glm::vec3& value)
+void Shader::Set(UniformHandle<glm::vec3> handle, const glm::vec3& value)
 {
-    int loc = GetUniformLocation(name);
-    if (loc != -1)
-        glUniform3f(loc, value.x, value.y, value.z);
+    if (handle.Location == -1) return;
+    glUniform3f(handle.Location, value.x, value.y, value.z);
+    Renderer::GetStats().UniformCalls++;
 }
 
-void Shader::SetFloat4(const std::string& name, const glm::vec4& value)
+void Shader::Set(UniformHandle<glm::vec4> handle, const glm::vec4& value)
 {
-    int loc = GetUniformLocation(name);
-    if (loc != -1)
-        glUniform4f(loc, value.x, value.y, value.z, value.w);
+    if (handle.Location == -1) return;
+    glUniform4f(handle.Location, value.x, value.y, value.z, value.w);
+    Renderer::GetStats().UniformCalls++;
 }
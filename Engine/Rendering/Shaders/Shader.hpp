@@ -1,8 +1,40 @@
 #pragma once
 #include <string>
-#include <unordered_map>
+#include <vector>
+#include <cstdint>
 
 #include <glm/glm.hpp>
+#include <Core/Hash.hpp>
+
+// ============================================================================
+// UniformID - uniform name pre-hashed at compile time
+// ============================================================================
+// SetMat4("u_Model", ...) used to build a std::string and hash it into an
+// unordered_map on every call. String literals now convert to a UniformID
+// through a consteval constructor, so the hash is baked into the call site.
+// Runtime names (std::string) still work and are hashed on the fly.
+// ============================================================================
+struct UniformID
+{
+    uint32_t Hash = 0;
+    const char* Name = ""; // Diagnostics only - valid for the duration of the call
+
+    consteval UniformID(const char* name)
+        : Hash(Hash::Fnv1a32(name)), Name(name) {}
+
+    UniformID(const std::string& name)
+        : Hash(Hash::Fnv1a32(name)), Name(name.c_str()) {}
+};
+
+// ============================================================================
+// UniformHandle<T> - resolved location, skips lookup entirely
+// ============================================================================
+template<typename T>
+struct UniformHandle
+{
+    int Location = -1;
+    bool IsValid() const { return Location != -1; }
+};
 
 class Shader
 {
@@ -17,15 +49,36 @@ public:
     // Check if shader compiled and linked successfully
     bool IsValid() const { return m_RendererID != 0; }
 
-    // Uniform helpers
-    void SetMat4(const std::string& name, const glm::mat4& value);
-    void SetFloat3(const std::string& name, const glm::vec3& value);
-    void SetFloat4(const std::string& name, const glm::vec4& value);
+    // Recompiles in place (hot reload). On failure the current program stays
+    // and false is returned. UniformHandles resolved before must be re-resolved.
+    bool Reload(const std::string& vertexSrc, const std::string& fragmentSrc);
+
+    // Uniform helpers (hashed lookup in the reflected uniform table)
+    void SetMat4(UniformID id, const glm::mat4& value);
+    void SetFloat3(UniformID id, const glm::vec3& value);
+    void SetFloat4(UniformID id, const glm::vec4& value);
+
+    // Typed handles: resolve once, set with no lookup at all
+    template<typename T>
+    UniformHandle<T> GetUniform(UniformID id) { return { GetUniformLocation(id) }; }
+
+    void Set(UniformHandle<glm::mat4> handle, const glm::mat4& value);
+    void Set(UniformHandle<glm::vec3> handle, const glm::vec3& value);
+    void Set(UniformHandle<glm::vec4> handle, const glm::vec4& value);
 
 private:
     uint32_t m_RendererID = 0;
 
-    int GetUniformLocation(const std::string& name);
+    int GetUniformLocation(UniformID id);
+
+    // Built from glGetActiveUniform right after link; sorted by hash for binary search
+    void ReflectUniforms();
 
-    std::unordered_map<std::string, int> m_UniformLocationCache;
+    struct UniformSlot
+    {
+        uint32_t Hash;
+        int Location;
+    };
+    std::vector<UniformSlot> m_Uniforms;
+    std::vector<uint32_t> m_MissingWarned; // Names already reported as missing
 };
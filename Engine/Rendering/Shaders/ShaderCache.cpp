@@ -0,0 +1,182 @@
+#include "ShaderCache.hpp"
+
+#include <glad/glad.h>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include <Core/Log.hpp>
+#include <Core/Hash.hpp>
+
+bool ShaderCache::s_Enabled = false;
+std::string ShaderCache::s_CacheDir;
+std::string ShaderCache::s_DriverID;
+ShaderCache::Stats ShaderCache::s_Stats;
+
+namespace
+{
+    constexpr uint32_t CACHE_MAGIC = 0x31485347; // "GSH1"
+
+    struct CacheFileHeader
+    {
+        uint32_t Magic = CACHE_MAGIC;
+        uint32_t BinaryFormat = 0;
+        uint32_t BinaryLength = 0;
+    };
+
+    // Hash string plus its terminator so "ab"+"c" != "a"+"bc"
+    uint64_t HashString(const std::string& s, uint64_t hash)
+    {
+        return Hash::Fnv1a64(s.c_str(), s.size() + 1, hash);
+    }
+
+    const char* GLString(GLenum name)
+    {
+        const char* s = (const char*)glGetString(name);
+        return s ? s : "";
+    }
+}
+
+void ShaderCache::Init(const std::string& cacheDir)
+{
+    s_CacheDir = cacheDir;
+    s_Stats = {};
+
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    if (formats <= 0)
+    {
+        CORE_WARN("[ShaderCache] Driver exposes no program binary formats - cache disabled");
+        s_Enabled = false;
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(s_CacheDir, ec);
+    if (ec)
+    {
+        CORE_WARN("[ShaderCache] Cannot create {0} - cache disabled", s_CacheDir);
+        s_Enabled = false;
+        return;
+    }
+
+    s_DriverID = std::string(GLString(GL_VENDOR)) + "|" + GLString(GL_RENDERER) + "|" + GLString(GL_VERSION);
+    s_Enabled = true;
+    CORE_INFO("[ShaderCache] Enabled at {0} ({1})", s_CacheDir, s_DriverID);
+}
+
+uint64_t ShaderCache::ComputeKey(const std::string& vertexSrc, const std::string& fragmentSrc)
+{
+    uint64_t hash = Hash::FNV64_OFFSET;
+    hash = HashString(vertexSrc, hash);
+    hash = HashString(fragmentSrc, hash);
+    hash = HashString(s_DriverID, hash);
+    return hash;
+}
+
+std::string ShaderCache::PathForKey(uint64_t key)
+{
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+    return (std::filesystem::path(s_CacheDir) / name).string();
+}
+
+uint32_t ShaderCache::Load(uint64_t key)
+{
+    if (!s_Enabled) return 0;
+
+    auto start = std::chrono::steady_clock::now();
+    std::string path = PathForKey(key);
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        s_Stats.Misses++;
+        return 0;
+    }
+
+    CacheFileHeader header;
+    file.read((char*)&header, sizeof(header));
+    std::vector<char> binary;
+    bool complete = false;
+    if (file && header.Magic == CACHE_MAGIC && header.BinaryLength > 0)
+    {
+        binary.resize(header.BinaryLength);
+        file.read(binary.data(), binary.size());
+        complete = (size_t)file.gcount() == binary.size();
+    }
+    file.close();
+
+    uint32_t program = 0;
+    if (complete)
+    {
+        program = glCreateProgram();
+        glProgramBinary(program, header.BinaryFormat, binary.data(), (GLsizei)binary.size());
+
+        int success = 0;
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+        if (!success)
+        {
+            glDeleteProgram(program);
+            program = 0;
+        }
+    }
+
+    if (program == 0)
+    {
+        // Driver refused it (or file is truncated) - drop it, caller recompiles
+        CORE_WARN("[ShaderCache] Rejected cached binary {0}, recompiling", path);
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        s_Stats.Rejected++;
+        s_Stats.Misses++;
+        return 0;
+    }
+
+    s_Stats.Hits++;
+    s_Stats.LoadMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return program;
+}
+
+void ShaderCache::Store(uint64_t key, uint32_t program)
+{
+    if (!s_Enabled || program == 0) return;
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    std::vector<char> binary(length);
+    CacheFileHeader header;
+    GLsizei written = 0;
+    glGetProgramBinary(program, length, &written, &header.BinaryFormat, binary.data());
+    if (written <= 0) return;
+    header.BinaryLength = (uint32_t)written;
+
+    // Write to a temp file and rename, so a crash never leaves a half-written binary
+    std::string path = PathForKey(key);
+    std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            CORE_WARN("[ShaderCache] Failed to write {0}", tmpPath);
+            return;
+        }
+        file.write((const char*)&header, sizeof(header));
+        file.write(binary.data(), written);
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, path, ec);
+    if (ec)
+        std::filesystem::remove(tmpPath, ec);
+}
+
+void ShaderCache::LogStats(const char* context)
+{
+    CORE_INFO("[ShaderCache] {0}: {1} hits ({2} ms), {3} misses ({4} ms compile), {5} rejected",
+              context, s_Stats.Hits, s_Stats.LoadMs, s_Stats.Misses, s_Stats.CompileMs, s_Stats.Rejected);
+}
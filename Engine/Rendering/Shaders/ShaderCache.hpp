@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+/**
+ * ============================================================================
+ * SHADER CACHE - on-disk program binaries (glGetProgramBinary/glProgramBinary)
+ * ============================================================================
+ *
+ * Key = FNV-1a 64 over every stage source plus the driver vendor, renderer
+ * and version strings. A driver update therefore changes the key and stale
+ * binaries are simply never looked up again. Anything #define'd lives in the
+ * source text, so it is part of the key as well.
+ *
+ * If the driver rejects a cached binary (format change, corrupted file) the
+ * file is deleted and the caller falls back to a normal compile.
+ *
+ * Layout: <CacheDir>/<16 hex digit key>.bin
+ *         [CacheFileHeader][driver binary blob]
+ * ============================================================================
+ */
+class ShaderCache
+{
+public:
+    struct Stats
+    {
+        uint32_t Hits = 0;
+        uint32_t Misses = 0;
+        uint32_t Rejected = 0;   // Cached binary refused by the driver
+        double LoadMs = 0.0;     // Time spent in glProgramBinary path
+        double CompileMs = 0.0;  // Time spent compiling + linking from source
+    };
+
+    // Must be called with a current GL context (queries driver strings)
+    static void Init(const std::string& cacheDir = "cache/shaders");
+    static bool IsEnabled() { return s_Enabled; }
+
+    static uint64_t ComputeKey(const std::string& vertexSrc, const std::string& fragmentSrc);
+
+    // Returns a linked program, or 0 on miss / rejection
+    static uint32_t Load(uint64_t key);
+
+    // Program must have been linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+    static void Store(uint64_t key, uint32_t program);
+
+    static Stats& GetStats() { return s_Stats; }
+    static void LogStats(const char* context);
+
+private:
+    static std::string PathForKey(uint64_t key);
+
+    static bool s_Enabled;
+    static std::string s_CacheDir;
+    static std::string s_DriverID;
+    static Stats s_Stats;
+};
@@ -0,0 +1,220 @@
+#include "Texture.hpp"
+#include <algorithm>
+
+#include <cstring>
+
+#include <Core/GLDebug.hpp>
+#include <Core/Log.hpp>
+#include <Rendering/TextureCompressor.hpp>
+
+// EXT_texture_compression_s3tc - not in the generated loader
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+    #define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+    #define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+namespace
+{
+    Texture2D::Stats s_Stats;
+
+    uint32_t LevelSize(uint32_t size, uint32_t level)
+    {
+        return std::max(1u, size >> level);
+    }
+
+    GLenum GetInternalFormat(TextureFormat format)
+    {
+        switch (format)
+        {
+        case TextureFormat::BC1: return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+        case TextureFormat::BC3: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        case TextureFormat::BC7: return GL_COMPRESSED_RGBA_BPTC_UNORM;
+        default:                 return GL_RGBA8;
+        }
+    }
+
+    bool HasExtension(const char* name)
+    {
+        GLint count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        for (GLint i = 0; i < count; i++)
+        {
+            const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, (GLuint)i);
+            if (extension && std::strcmp(extension, name) == 0) return true;
+        }
+        return false;
+    }
+}
+
+bool Texture2D::IsFormatSupported(TextureFormat format)
+{
+    static const bool s_S3TC = HasExtension("GL_EXT_texture_compression_s3tc");
+    static const bool s_BPTC = GLAD_GL_VERSION_4_2 || HasExtension("GL_ARB_texture_compression_bptc");
+
+    switch (format)
+    {
+    case TextureFormat::RGBA8: return true;
+    case TextureFormat::BC1:
+    case TextureFormat::BC3:   return s_S3TC;
+    case TextureFormat::BC7:   return s_BPTC;
+    default:                   return false;
+    }
+}
+
+std::shared_ptr<Texture2D> Texture2D::Create(const std::string& path)
+{
+    Image image;
+    if (!ImageLoader::Load(path, image)) return nullptr;
+    return Create(image);
+}
+
+std::shared_ptr<Texture2D> Texture2D::Create(const Image& image, uint32_t baseMip)
+{
+    if (!image.IsValid()) return nullptr;
+    return std::shared_ptr<Texture2D>(new Texture2D(image, baseMip));
+}
+
+Texture2D::Texture2D(const Image& image, uint32_t baseMip)
+    : m_Width(image.GetWidth()), m_Height(image.GetHeight())
+{
+    m_MipCount = ImageLoader::GetMipCount(m_Width, m_Height);
+    m_Format = IsFormatSupported(image.Format) ? image.Format : TextureFormat::RGBA8;
+    if (m_Format != image.Format)
+        CORE_WARN("[Texture2D] {0} not supported by this GPU - decompressing to RGBA8", Image::GetFormatName(image.Format));
+    Upload(image, baseMip);
+}
+
+Texture2D::~Texture2D()
+{
+    GL_CALL(glDeleteTextures(1, &m_RendererID));
+    s_Stats.Textures--;
+    s_Stats.Bytes -= m_MemorySize;
+}
+
+uint32_t Texture2D::Allocate(uint32_t baseMip) const
+{
+    uint32_t levels = m_MipCount - baseMip;
+    uint32_t width = LevelSize(m_Width, baseMip), height = LevelSize(m_Height, baseMip);
+
+    GLenum internalFormat = GetInternalFormat(m_Format);
+
+    uint32_t rendererID;
+    GL_CALL(glGenTextures(1, &rendererID));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, rendererID));
+
+    if (GLAD_GL_VERSION_4_2)
+    {
+        GL_CALL(glTexStorage2D(GL_TEXTURE_2D, levels, internalFormat, width, height));
+    }
+    else
+    {
+        // S3TC allows allocating compressed levels through glTexImage2D without data
+        for (uint32_t level = 0; level < levels; level++)
+            GL_CALL(glTexImage2D(GL_TEXTURE_2D, level, internalFormat, LevelSize(width, level), LevelSize(height, level),
+                                 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1));
+    }
+
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
+    return rendererID;
+}
+
+void Texture2D::Adopt(uint32_t rendererID, uint32_t baseMip)
+{
+    if (m_RendererID)
+    {
+        GL_CALL(glDeleteTextures(1, &m_RendererID));
+        s_Stats.Textures--;
+        s_Stats.Bytes -= m_MemorySize;
+    }
+
+    m_RendererID = rendererID;
+    m_BaseMip = baseMip;
+    m_MemorySize = 0;
+    for (uint32_t level = baseMip; level < m_MipCount; level++)
+        m_MemorySize += Image::GetLevelBytes(m_Format, LevelSize(m_Width, level), LevelSize(m_Height, level));
+
+    s_Stats.Textures++;
+    s_Stats.Bytes += m_MemorySize;
+}
+
+void Texture2D::Upload(const Image& image, uint32_t baseMip)
+{
+    baseMip = std::min(baseMip, m_MipCount - 1);
+
+    // No GPU support for the format - upload the decompressed levels
+    if (image.Format != m_Format)
+    {
+        Image decoded;
+        if (!TextureCompressor::Decompress(image, decoded, baseMip) || m_Format != TextureFormat::RGBA8)
+        {
+            CORE_ERROR("[Texture2D] Cannot upload {0} data to a {1} texture",
+                       Image::GetFormatName(image.Format), Image::GetFormatName(m_Format));
+            return;
+        }
+        Upload(decoded, baseMip);
+        return;
+    }
+
+    uint32_t rendererID = Allocate(baseMip);
+
+    // Storage level i holds image level baseMip + i. RGBA8 rows are always
+    // 4-byte aligned - the default unpack alignment fits; block rows are whole blocks.
+    const GLenum internalFormat = GetInternalFormat(m_Format);
+    uint32_t provided = std::min((uint32_t)image.Levels.size(), m_MipCount);
+    for (uint32_t level = baseMip; level < provided; level++)
+    {
+        const Image::Level& data = image.Levels[level];
+        if (image.IsCompressed())
+            GL_CALL(glCompressedTexSubImage2D(GL_TEXTURE_2D, level - baseMip, 0, 0, data.Width, data.Height,
+                                              internalFormat, (GLsizei)data.Pixels.size(), data.Pixels.data()));
+        else
+            GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, level - baseMip, 0, 0, data.Width, data.Height,
+                                    GL_RGBA, GL_UNSIGNED_BYTE, data.Pixels.data()));
+    }
+    if (provided < m_MipCount)
+    {
+        // glGenerateMipmap cannot write compressed levels
+        if (provided <= baseMip || image.IsCompressed())
+            CORE_WARN("[Texture2D] Image has no level {0} - mip {0} onwards left undefined", std::max(provided, baseMip));
+        else
+            GL_CALL(glGenerateMipmap(GL_TEXTURE_2D));
+    }
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, 0));
+
+    Adopt(rendererID, baseMip);
+}
+
+bool Texture2D::DropMips(uint32_t baseMip)
+{
+    baseMip = std::min(baseMip, m_MipCount - 1);
+    if (baseMip <= m_BaseMip) return true;
+    if (!GLAD_GL_VERSION_4_3) return false;
+
+    uint32_t rendererID = Allocate(baseMip);
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, 0));
+
+    for (uint32_t level = baseMip; level < m_MipCount; level++)
+        GL_CALL(glCopyImageSubData(m_RendererID, GL_TEXTURE_2D, level - m_BaseMip, 0, 0, 0,
+                                   rendererID, GL_TEXTURE_2D, level - baseMip, 0, 0, 0,
+                                   LevelSize(m_Width, level), LevelSize(m_Height, level), 1));
+
+    Adopt(rendererID, baseMip);
+    return true;
+}
+
+void Texture2D::Bind(uint32_t slot) const
+{
+    GL_CALL(glActiveTexture(GL_TEXTURE0 + slot));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, m_RendererID));
+}
+
+Texture2D::Stats Texture2D::GetStats()
+{
+    return s_Stats;
+}
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <string>
+#include <memory>
 #include <glad/glad.h>
 
+#include <Rendering/Image.hpp>
+
 class Texture
 {
 public:
@@ -15,9 +18,66 @@ public:
     virtual void Bind(uint32_t slot = 0) const = 0;
 };
 
+// RGBA8 or block-compressed (BC1/BC3/BC7) texture with a full mip chain in
+// immutable storage (glTexStorage2D; plain glTexImage2D levels on GL < 4.2).
+// Decoding, mip building and compression live in ImageLoader /
+// TextureCompressor so they can run off the main thread - only the upload
+// needs GL. Compressed images go up as-is; a GPU without the format gets
+// them decompressed to RGBA8 instead.
+//
+// Streaming: only levels [BaseMip, MipCount) may be on the GPU. Width/Height
+// stay the full-resolution size; GetMemorySize() is what is resident.
 class Texture2D : public Texture
 {
 public:
-    // Future implementation
-    static std::shared_ptr<Texture2D> Create(const std::string& path) { return nullptr; }
+    // Decode + CPU mips + upload in one call; nullptr on failure
+    static std::shared_ptr<Texture2D> Create(const std::string& path);
+    // Uploads levels [baseMip, ...) of `image`; missing RGBA8 levels get glGenerateMipmap
+    static std::shared_ptr<Texture2D> Create(const Image& image, uint32_t baseMip = 0);
+
+    ~Texture2D() override;
+
+    Texture2D(const Texture2D&) = delete;
+    Texture2D& operator=(const Texture2D&) = delete;
+
+    uint32_t GetWidth() const override { return m_Width; }
+    uint32_t GetHeight() const override { return m_Height; }
+    uint32_t GetRendererID() const override { return m_RendererID; }
+    uint32_t GetMipCount() const { return m_MipCount; }
+    uint32_t GetBaseMip() const { return m_BaseMip; }
+    TextureFormat GetFormat() const { return m_Format; }
+    uint64_t GetMemorySize() const { return m_MemorySize; }   // GPU bytes, resident levels
+
+    void Bind(uint32_t slot = 0) const override;
+
+    // Re-creates the storage from `image` (same size and format) starting at baseMip
+    void Upload(const Image& image, uint32_t baseMip);
+    // Drops levels above baseMip with a GPU copy of the rest (GL 4.3);
+    // false if unsupported - re-Upload instead
+    bool DropMips(uint32_t baseMip);
+
+    struct Stats
+    {
+        uint32_t Textures = 0;
+        uint64_t Bytes = 0;
+    };
+    static Stats GetStats();   // Live textures
+
+    // Main thread (needs a context). RGBA8 always; BC1/BC3 with S3TC, BC7 with GL 4.2 / BPTC.
+    static bool IsFormatSupported(TextureFormat format);
+
+private:
+    Texture2D(const Image& image, uint32_t baseMip);
+
+    // New storage for levels [baseMip, MipCount); returns the GL name
+    uint32_t Allocate(uint32_t baseMip) const;
+    void Adopt(uint32_t rendererID, uint32_t baseMip);
+
+    uint32_t m_RendererID = 0;
+    uint32_t m_Width = 0;
+    uint32_t m_Height = 0;
+    uint32_t m_MipCount = 0;
+    uint32_t m_BaseMip = 0;
+    uint64_t m_MemorySize = 0;
+    TextureFormat m_Format = TextureFormat::RGBA8;
 };
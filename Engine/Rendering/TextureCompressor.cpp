@@ -0,0 +1,842 @@
+#include "TextureCompressor.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#include <Core/Log.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define COMPRESSOR_SSE2 1
+#endif
+
+using Quality = TextureCompressor::Quality;
+
+namespace
+{
+    std::mutex s_StatsMutex;
+    TextureCompressor::Stats s_Stats;
+
+    // Below this many block rows per worker, threads cost more than they save
+    constexpr size_t MIN_ROWS_PER_WORKER = 8;
+
+    constexpr uint8_t BC7_WEIGHTS[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+    // 16 texels of a 4x4 block, one array per channel (0..255)
+    struct Block
+    {
+        alignas(16) float Channels[4][16];
+    };
+
+    using Endpoints = float[2][4];
+    using Palette = float[16][4];
+
+    float Clamp255(float value)
+    {
+        return std::min(255.0f, std::max(0.0f, value));
+    }
+
+    void LoadBlock(const Image::Level& level, uint32_t bx, uint32_t by, Block& block)
+    {
+        // Edge blocks repeat the last row / column
+        for (uint32_t y = 0; y < 4; y++)
+        {
+            uint32_t sy = std::min(by * 4 + y, level.Height - 1);
+            for (uint32_t x = 0; x < 4; x++)
+            {
+                uint32_t sx = std::min(bx * 4 + x, level.Width - 1);
+                const uint8_t* texel = &level.Pixels[((size_t)sy * level.Width + sx) * 4];
+                for (int c = 0; c < 4; c++)
+                    block.Channels[c][y * 4 + x] = texel[c];
+            }
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Shared fitting - channels [first, first + count) of a block
+    // ------------------------------------------------------------------------
+
+    // Nearest palette entry per texel; returns the summed squared error
+    float FitIndices(const Block& block, uint32_t first, uint32_t count,
+                     const Palette& palette, uint32_t paletteSize, uint8_t indices[16])
+    {
+        float total = 0.0f;
+#ifdef COMPRESSOR_SSE2
+        for (uint32_t i = 0; i < 16; i += 4)
+        {
+            __m128 texel[4];
+            for (uint32_t c = 0; c < count; c++)
+                texel[c] = _mm_load_ps(&block.Channels[first + c][i]);
+
+            __m128 best = _mm_set1_ps(3.0e38f);
+            __m128i bestIndex = _mm_setzero_si128();
+            for (uint32_t p = 0; p < paletteSize; p++)
+            {
+                __m128 error = _mm_setzero_ps();
+                for (uint32_t c = 0; c < count; c++)
+                {
+                    __m128 d = _mm_sub_ps(texel[c], _mm_set1_ps(palette[p][first + c]));
+                    error = _mm_add_ps(error, _mm_mul_ps(d, d));
+                }
+                __m128i closer = _mm_castps_si128(_mm_cmplt_ps(error, best));
+                best = _mm_min_ps(error, best);
+                bestIndex = _mm_or_si128(_mm_and_si128(closer, _mm_set1_epi32((int)p)),
+                                         _mm_andnot_si128(closer, bestIndex));
+            }
+
+            alignas(16) int32_t index[4];
+            alignas(16) float error[4];
+            _mm_store_si128((__m128i*)index, bestIndex);
+            _mm_store_ps(error, best);
+            for (int k = 0; k < 4; k++)
+            {
+                indices[i + k] = (uint8_t)index[k];
+                total += error[k];
+            }
+        }
+#else
+        for (uint32_t i = 0; i < 16; i++)
+        {
+            float best = 3.0e38f;
+            for (uint32_t p = 0; p < paletteSize; p++)
+            {
+                float error = 0.0f;
+                for (uint32_t c = 0; c < count; c++)
+                {
+                    float d = block.Channels[first + c][i] - palette[p][first + c];
+                    error += d * d;
+                }
+                if (error < best)
+                {
+                    best = error;
+                    indices[i] = (uint8_t)p;
+                }
+            }
+            total += best;
+        }
+#endif
+        return total;
+    }
+
+    // Inset bounding box; the diagonal follows the sign of each channel's
+    // covariance with the widest one
+    void FitBoundingBox(const Block& block, uint32_t first, uint32_t count, Endpoints& endpoints)
+    {
+        float mean[4] = {}, low[4], high[4];
+        uint32_t widest = first;
+        for (uint32_t c = first; c < first + count; c++)
+        {
+            low[c] = 255.0f;
+            high[c] = 0.0f;
+            for (float value : block.Channels[c])
+            {
+                low[c] = std::min(low[c], value);
+                high[c] = std::max(high[c], value);
+                mean[c] += value / 16.0f;
+            }
+            if (high[c] - low[c] > high[widest] - low[widest]) widest = c;
+        }
+
+        for (uint32_t c = first; c < first + count; c++)
+        {
+            float inset = (high[c] - low[c]) / 16.0f;
+            endpoints[0][c] = low[c] + inset;
+            endpoints[1][c] = high[c] - inset;
+
+            float covariance = 0.0f;
+            for (uint32_t i = 0; i < 16; i++)
+                covariance += (block.Channels[c][i] - mean[c]) * (block.Channels[widest][i] - mean[widest]);
+            if (covariance < 0.0f) std::swap(endpoints[0][c], endpoints[1][c]);
+        }
+    }
+
+    // Extremes of the projections onto the principal axis (power iteration
+    // on the covariance, started along the widest channel)
+    void FitPrincipalAxis(const Block& block, uint32_t first, uint32_t count, Endpoints& endpoints)
+    {
+        float mean[4] = {};
+        for (uint32_t c = 0; c < count; c++)
+            for (float value : block.Channels[first + c])
+                mean[c] += value / 16.0f;
+
+        float covariance[4][4] = {};
+        for (uint32_t i = 0; i < 16; i++)
+            for (uint32_t a = 0; a < count; a++)
+                for (uint32_t b = 0; b < count; b++)
+                    covariance[a][b] += (block.Channels[first + a][i] - mean[a]) * (block.Channels[first + b][i] - mean[b]);
+
+        float axis[4] = {};
+        uint32_t widest = 0;
+        for (uint32_t c = 1; c < count; c++)
+            if (covariance[c][c] > covariance[widest][widest]) widest = c;
+        axis[widest] = 1.0f;
+
+        for (int iteration = 0; iteration < 8; iteration++)
+        {
+            float next[4] = {}, length = 0.0f;
+            for (uint32_t a = 0; a < count; a++)
+            {
+                for (uint32_t b = 0; b < count; b++)
+                    next[a] += covariance[a][b] * axis[b];
+                length += next[a] * next[a];
+            }
+            if (length < 1e-12f) break; // Flat block - any axis will do
+            length = 1.0f / std::sqrt(length);
+            for (uint32_t c = 0; c < count; c++)
+                axis[c] = next[c] * length;
+        }
+
+        float low = 3.0e38f, high = -3.0e38f;
+        for (uint32_t i = 0; i < 16; i++)
+        {
+            float t = 0.0f;
+            for (uint32_t c = 0; c < count; c++)
+                t += (block.Channels[first + c][i] - mean[c]) * axis[c];
+            low = std::min(low, t);
+            high = std::max(high, t);
+        }
+
+        for (uint32_t c = 0; c < count; c++)
+        {
+            endpoints[0][first + c] = Clamp255(mean[c] + low * axis[c]);
+            endpoints[1][first + c] = Clamp255(mean[c] + high * axis[c]);
+        }
+    }
+
+    // Endpoints with the least squared error for fixed weights (0 = first
+    // endpoint, 1 = second); false if the weights do not pin them down
+    bool RefitEndpoints(const Block& block, uint32_t first, uint32_t count, const float weights[16], Endpoints& endpoints)
+    {
+        float aa = 0.0f, bb = 0.0f, ab = 0.0f, ax[4] = {}, bx[4] = {};
+        for (uint32_t i = 0; i < 16; i++)
+        {
+            float b = weights[i], a = 1.0f - b;
+            aa += a * a;
+            bb += b * b;
+            ab += a * b;
+            for (uint32_t c = 0; c < count; c++)
+            {
+                ax[c] += a * block.Channels[first + c][i];
+                bx[c] += b * block.Channels[first + c][i];
+            }
+        }
+
+        float determinant = aa * bb - ab * ab;
+        if (std::fabs(determinant) < 1e-6f) return false;
+
+        for (uint32_t c = 0; c < count; c++)
+        {
+            endpoints[0][first + c] = Clamp255((ax[c] * bb - bx[c] * ab) / determinant);
+            endpoints[1][first + c] = Clamp255((bx[c] * aa - ax[c] * ab) / determinant);
+        }
+        return true;
+    }
+
+    void FitEndpoints(const Block& block, uint32_t first, uint32_t count, Quality quality, Endpoints& endpoints)
+    {
+        if (quality == Quality::Fast) FitBoundingBox(block, first, count, endpoints);
+        else FitPrincipalAxis(block, first, count, endpoints);
+    }
+
+    uint32_t GetRefits(Quality quality)
+    {
+        return quality == Quality::Fast ? 0 : quality == Quality::Normal ? 1 : 3;
+    }
+
+    // ------------------------------------------------------------------------
+    // BC1 color block (also the color half of BC3)
+    // ------------------------------------------------------------------------
+
+    // Palette position (linear c0 -> c1) -> 2-bit code
+    constexpr uint8_t COLOR_CODES[4] = { 0, 2, 3, 1 };
+
+    uint16_t To565(const float color[4])
+    {
+        auto quantize = [](float value, float scale) { return (uint32_t)(value * scale / 255.0f + 0.5f); };
+        return (uint16_t)((quantize(color[0], 31.0f) << 11) | (quantize(color[1], 63.0f) << 5) | quantize(color[2], 31.0f));
+    }
+
+    void From565(uint16_t color, uint8_t rgb[3])
+    {
+        uint32_t r = (color >> 11) & 31, g = (color >> 5) & 63, b = color & 31;
+        rgb[0] = (uint8_t)((r << 3) | (r >> 2));
+        rgb[1] = (uint8_t)((g << 2) | (g >> 4));
+        rgb[2] = (uint8_t)((b << 3) | (b >> 2));
+    }
+
+    // Decoded colors by code; c0 <= c1 selects BC1's 3-color + transparent mode
+    void DecodeColors(uint16_t c0, uint16_t c1, bool allowThreeColor, uint8_t colors[4][4])
+    {
+        From565(c0, colors[0]);
+        From565(c1, colors[1]);
+        bool fourColor = c0 > c1 || !allowThreeColor;
+        for (int c = 0; c < 3; c++)
+        {
+            uint32_t a = colors[0][c], b = colors[1][c];
+            colors[2][c] = (uint8_t)(fourColor ? (2 * a + b + 1) / 3 : (a + b) / 2);
+            colors[3][c] = (uint8_t)(fourColor ? (a + 2 * b + 1) / 3 : 0);
+        }
+        colors[0][3] = colors[1][3] = colors[2][3] = 255;
+        colors[3][3] = fourColor ? 255 : 0;
+    }
+
+    void EncodeColor(const Block& block, Quality quality, uint8_t* out)
+    {
+        Endpoints endpoints;
+        FitEndpoints(block, 0, 3, quality, endpoints);
+
+        float bestError = 3.0e38f;
+        uint16_t best0 = 0, best1 = 0;
+        uint8_t bestIndices[16] = {};
+        for (uint32_t pass = 0;; pass++)
+        {
+            uint16_t c0 = To565(endpoints[0]), c1 = To565(endpoints[1]);
+            if (c0 < c1) std::swap(c0, c1); // Four-color mode needs c0 > c1
+
+            uint8_t colors[4][4];
+            DecodeColors(c0, c1, false, colors);
+            Palette palette;
+            for (uint32_t p = 0; p < 4; p++)
+                for (int c = 0; c < 4; c++)
+                    palette[p][c] = colors[COLOR_CODES[p]][c];
+
+            // c0 == c1 would switch to 3-color mode: one color, every code 0
+            uint8_t indices[16];
+            float error = FitIndices(block, 0, 3, palette, c0 == c1 ? 1 : 4, indices);
+            if (error < bestError)
+            {
+                bestError = error;
+                best0 = c0;
+                best1 = c1;
+                std::memcpy(bestIndices, indices, 16);
+            }
+            if (pass == GetRefits(quality) || c0 == c1 || error == 0.0f) break;
+
+            float weights[16];
+            for (int i = 0; i < 16; i++)
+                weights[i] = indices[i] / 3.0f;
+            if (!RefitEndpoints(block, 0, 3, weights, endpoints)) break;
+        }
+
+        uint32_t codes = 0;
+        for (int i = 0; i < 16; i++)
+            codes |= (uint32_t)COLOR_CODES[bestIndices[i]] << (2 * i);
+        std::memcpy(out, &best0, 2);
+        std::memcpy(out + 2, &best1, 2);
+        std::memcpy(out + 4, &codes, 4);
+    }
+
+    void DecodeColorBlock(const uint8_t* data, bool allowThreeColor, uint8_t texels[16][4])
+    {
+        uint16_t c0, c1;
+        uint32_t codes;
+        std::memcpy(&c0, data, 2);
+        std::memcpy(&c1, data + 2, 2);
+        std::memcpy(&codes, data + 4, 4);
+
+        uint8_t colors[4][4];
+        DecodeColors(c0, c1, allowThreeColor, colors);
+        for (int i = 0; i < 16; i++)
+            std::memcpy(texels[i], colors[(codes >> (2 * i)) & 3], allowThreeColor ? 4 : 3);
+    }
+
+    // ------------------------------------------------------------------------
+    // BC3 alpha block
+    // ------------------------------------------------------------------------
+
+    // Palette position (linear a0 -> a1) -> 3-bit code
+    constexpr uint8_t ALPHA_CODES[8] = { 0, 2, 3, 4, 5, 6, 7, 1 };
+
+    // Decoded alpha by code; a0 <= a1 selects the 6-value + 0/255 mode
+    void DecodeAlphas(uint32_t a0, uint32_t a1, uint8_t alphas[8])
+    {
+        alphas[0] = (uint8_t)a0;
+        alphas[1] = (uint8_t)a1;
+        if (a0 > a1)
+        {
+            for (uint32_t code = 2; code < 8; code++)
+                alphas[code] = (uint8_t)(((8 - code) * a0 + (code - 1) * a1 + 3) / 7);
+        }
+        else
+        {
+            for (uint32_t code = 2; code < 6; code++)
+                alphas[code] = (uint8_t)(((6 - code) * a0 + (code - 1) * a1 + 2) / 5);
+            alphas[6] = 0;
+            alphas[7] = 255;
+        }
+    }
+
+    void EncodeAlpha(const Block& block, Quality quality, uint8_t* out)
+    {
+        Endpoints endpoints = {};
+        endpoints[0][3] = *std::max_element(block.Channels[3], block.Channels[3] + 16);
+        endpoints[1][3] = *std::min_element(block.Channels[3], block.Channels[3] + 16);
+
+        float bestError = 3.0e38f;
+        uint32_t best0 = 0, best1 = 0;
+        uint8_t bestIndices[16] = {};
+        for (uint32_t pass = 0;; pass++)
+        {
+            uint32_t a0 = (uint32_t)(endpoints[0][3] + 0.5f), a1 = (uint32_t)(endpoints[1][3] + 0.5f);
+            if (a0 < a1) std::swap(a0, a1); // Eight-value mode needs a0 > a1
+
+            uint8_t alphas[8];
+            DecodeAlphas(a0, a1, alphas);
+            Palette palette;
+            for (uint32_t p = 0; p < 8; p++)
+                palette[p][3] = alphas[ALPHA_CODES[p]];
+
+            uint8_t indices[16];
+            float error = FitIndices(block, 3, 1, palette, a0 == a1 ? 1 : 8, indices);
+            if (error < bestError)
+            {
+                bestError = error;
+                best0 = a0;
+                best1 = a1;
+                std::memcpy(bestIndices, indices, 16);
+            }
+            if (pass == GetRefits(quality) || a0 == a1 || error == 0.0f) break;
+
+            float weights[16];
+            for (int i = 0; i < 16; i++)
+                weights[i] = indices[i] / 7.0f;
+            if (!RefitEndpoints(block, 3, 1, weights, endpoints)) break;
+        }
+
+        uint64_t codes = 0;
+        for (int i = 0; i < 16; i++)
+            codes |= (uint64_t)ALPHA_CODES[bestIndices[i]] << (3 * i);
+        out[0] = (uint8_t)best0;
+        out[1] = (uint8_t)best1;
+        std::memcpy(out + 2, &codes, 6); // Little endian - the low 48 bits
+    }
+
+    void DecodeAlphaBlock(const uint8_t* data, uint8_t texels[16][4])
+    {
+        uint8_t alphas[8];
+        DecodeAlphas(data[0], data[1], alphas);
+
+        uint64_t codes = 0;
+        std::memcpy(&codes, data + 2, 6);
+        for (int i = 0; i < 16; i++)
+            texels[i][3] = alphas[(codes >> (3 * i)) & 7];
+    }
+
+    // ------------------------------------------------------------------------
+    // BC7 mode 6 - one subset, RGBA endpoints 7 bits + a p-bit each, 4-bit indices
+    // ------------------------------------------------------------------------
+    struct BitWriter
+    {
+        uint8_t* Data;
+        uint32_t Position = 0;
+
+        void Write(uint32_t value, uint32_t bits)
+        {
+            for (uint32_t bit = 0; bit < bits; bit++, Position++)
+                if ((value >> bit) & 1) Data[Position >> 3] |= (uint8_t)(1u << (Position & 7));
+        }
+    };
+
+    struct BitReader
+    {
+        const uint8_t* Data;
+        uint32_t Position = 0;
+
+        uint32_t Read(uint32_t bits)
+        {
+            uint32_t value = 0;
+            for (uint32_t bit = 0; bit < bits; bit++, Position++)
+                value |= (uint32_t)((Data[Position >> 3] >> (Position & 7)) & 1) << bit;
+            return value;
+        }
+    };
+
+    // 7-bit values for one endpoint sharing p-bit `p`; `expanded` gets the 8-bit result
+    void QuantizeBC7(const float endpoint[4], uint32_t p, uint8_t quantized[4], uint8_t expanded[4])
+    {
+        for (int c = 0; c < 4; c++)
+        {
+            int value = (int)std::lround((endpoint[c] - (float)p) / 2.0f);
+            quantized[c] = (uint8_t)std::min(127, std::max(0, value));
+            expanded[c] = (uint8_t)((quantized[c] << 1) | p);
+        }
+    }
+
+    float QuantizationError(const float endpoint[4], const uint8_t expanded[4])
+    {
+        float error = 0.0f;
+        for (int c = 0; c < 4; c++)
+            error += (endpoint[c] - expanded[c]) * (endpoint[c] - expanded[c]);
+        return error;
+    }
+
+    void BC7Palette(const uint8_t e0[4], const uint8_t e1[4], uint8_t palette[16][4])
+    {
+        for (int i = 0; i < 16; i++)
+            for (int c = 0; c < 4; c++)
+                palette[i][c] = (uint8_t)((e0[c] * (64 - BC7_WEIGHTS[i]) + e1[c] * BC7_WEIGHTS[i] + 32) >> 6);
+    }
+
+    void EncodeBC7(const Block& block, Quality quality, uint8_t* out)
+    {
+        Endpoints endpoints;
+        FitEndpoints(block, 0, 4, quality, endpoints);
+
+        struct Candidate
+        {
+            uint8_t Quantized[2][4];
+            uint32_t PBits[2];
+            uint8_t Indices[16];
+        } best = {};
+        float bestError = 3.0e38f;
+
+        for (uint32_t pass = 0;; pass++)
+        {
+            // High tries every p-bit pair; otherwise each endpoint takes its closest
+            uint32_t pairs[4][2] = { { 0, 0 }, { 0, 1 }, { 1, 0 }, { 1, 1 } };
+            uint32_t pairCount = 4;
+            if (quality != Quality::High)
+            {
+                for (int e = 0; e < 2; e++)
+                {
+                    uint8_t quantized[4], expanded0[4], expanded1[4];
+                    QuantizeBC7(endpoints[e], 0, quantized, expanded0);
+                    QuantizeBC7(endpoints[e], 1, quantized, expanded1);
+                    pairs[0][e] = QuantizationError(endpoints[e], expanded1) < QuantizationError(endpoints[e], expanded0) ? 1 : 0;
+                }
+                pairCount = 1;
+            }
+
+            float passError = 3.0e38f;
+            uint8_t passIndices[16] = {};
+            for (uint32_t pair = 0; pair < pairCount; pair++)
+            {
+                Candidate candidate;
+                uint8_t expanded[2][4];
+                for (int e = 0; e < 2; e++)
+                {
+                    candidate.PBits[e] = pairs[pair][e];
+                    QuantizeBC7(endpoints[e], candidate.PBits[e], candidate.Quantized[e], expanded[e]);
+                }
+
+                uint8_t colors[16][4];
+                BC7Palette(expanded[0], expanded[1], colors);
+                Palette palette;
+                for (int i = 0; i < 16; i++)
+                    for (int c = 0; c < 4; c++)
+                        palette[i][c] = colors[i][c];
+
+                float error = FitIndices(block, 0, 4, palette, 16, candidate.Indices);
+                if (error < passError)
+                {
+                    passError = error;
+                    std::memcpy(passIndices, candidate.Indices, 16);
+                }
+                if (error < bestError)
+                {
+                    bestError = error;
+                    best = candidate;
+                }
+            }
+            if (pass == GetRefits(quality) || bestError == 0.0f) break;
+
+            float weights[16];
+            for (int i = 0; i < 16; i++)
+                weights[i] = BC7_WEIGHTS[passIndices[i]] / 64.0f;
+            if (!RefitEndpoints(block, 0, 4, weights, endpoints)) break;
+        }
+
+        // The anchor (texel 0) index has an implied 0 MSB - mirror the block if needed.
+        // The weights are symmetric (w[15 - i] = 64 - w[i]), so the palette is unchanged.
+        if (best.Indices[0] & 8)
+        {
+            std::swap(best.Quantized[0], best.Quantized[1]);
+            std::swap(best.PBits[0], best.PBits[1]);
+            for (uint8_t& index : best.Indices)
+                index = (uint8_t)(15 - index);
+        }
+
+        std::memset(out, 0, 16);
+        BitWriter writer{ out };
+        writer.Write(1u << 6, 7); // Mode 6
+        for (int c = 0; c < 4; c++)
+        {
+            writer.Write(best.Quantized[0][c], 7);
+            writer.Write(best.Quantized[1][c], 7);
+        }
+        writer.Write(best.PBits[0], 1);
+        writer.Write(best.PBits[1], 1);
+        for (int i = 0; i < 16; i++)
+            writer.Write(best.Indices[i], i == 0 ? 3 : 4);
+    }
+
+    bool DecodeBC7Block(const uint8_t* data, uint8_t texels[16][4])
+    {
+        if ((data[0] & 0x7F) != 0x40)
+        {
+            // Only mode 6 is written here - anything else shows up magenta
+            for (int i = 0; i < 16; i++)
+            {
+                texels[i][0] = texels[i][2] = texels[i][3] = 255;
+                texels[i][1] = 0;
+            }
+            return false;
+        }
+
+        BitReader reader{ data, 7 };
+        uint8_t quantized[2][4], expanded[2][4];
+        for (int c = 0; c < 4; c++)
+        {
+            quantized[0][c] = (uint8_t)reader.Read(7);
+            quantized[1][c] = (uint8_t)reader.Read(7);
+        }
+        for (int e = 0; e < 2; e++)
+        {
+            uint32_t p = reader.Read(1);
+            for (int c = 0; c < 4; c++)
+                expanded[e][c] = (uint8_t)((quantized[e][c] << 1) | p);
+        }
+
+        uint8_t palette[16][4];
+        BC7Palette(expanded[0], expanded[1], palette);
+        for (int i = 0; i < 16; i++)
+            std::memcpy(texels[i], palette[reader.Read(i == 0 ? 3 : 4)], 4);
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+
+    void EncodeBlock(TextureFormat format, const Block& block, Quality quality, uint8_t* out)
+    {
+        switch (format)
+        {
+        case TextureFormat::BC1:
+            EncodeColor(block, quality, out);
+            break;
+        case TextureFormat::BC3:
+            EncodeAlpha(block, quality, out);
+            EncodeColor(block, quality, out + 8);
+            break;
+        case TextureFormat::BC7:
+            EncodeBC7(block, quality, out);
+            break;
+        default:
+            break;
+        }
+    }
+
+    bool DecodeBlock(TextureFormat format, const uint8_t* data, uint8_t texels[16][4])
+    {
+        switch (format)
+        {
+        case TextureFormat::BC1:
+            DecodeColorBlock(data, true, texels);
+            return true;
+        case TextureFormat::BC3:
+            DecodeAlphaBlock(data, texels);
+            DecodeColorBlock(data + 8, false, texels);
+            return true;
+        case TextureFormat::BC7:
+            return DecodeBC7Block(data, texels);
+        default:
+            return false;
+        }
+    }
+
+    uint32_t GetBlockBytes(TextureFormat format)
+    {
+        return format == TextureFormat::BC1 ? 8 : 16;
+    }
+
+    uint32_t ResolveWorkers(uint32_t workerCount)
+    {
+        return workerCount ? workerCount : std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+bool TextureCompressor::Compress(const Image& source, TextureFormat format, Quality quality, Image& output, uint32_t workerCount)
+{
+    auto start = std::chrono::steady_clock::now();
+    if (!source.IsValid() || source.IsCompressed() || format == TextureFormat::RGBA8 || format >= TextureFormat::Count)
+        return false;
+
+    Image result;
+    result.Format = format;
+    result.Levels.resize(source.Levels.size());
+
+    // Every block row of every level is one work item
+    struct Row
+    {
+        uint32_t Level;
+        uint32_t Y;
+    };
+    std::vector<Row> rows;
+    uint64_t texels = 0;
+    for (uint32_t level = 0; level < (uint32_t)source.Levels.size(); level++)
+    {
+        const Image::Level& from = source.Levels[level];
+        if (from.Pixels.size() != (size_t)from.Width * from.Height * 4 || from.Width == 0 || from.Height == 0)
+            return false;
+
+        Image::Level& to = result.Levels[level];
+        to.Width = from.Width;
+        to.Height = from.Height;
+        to.Pixels.resize(Image::GetLevelBytes(format, from.Width, from.Height));
+        for (uint32_t y = 0; y < (from.Height + 3) / 4; y++)
+            rows.push_back({ level, y });
+        texels += (uint64_t)from.Width * from.Height;
+    }
+
+    const uint32_t blockBytes = GetBlockBytes(format);
+    std::atomic<size_t> next{ 0 };
+    auto work = [&]()
+    {
+        Block block;
+        for (size_t index; (index = next.fetch_add(1)) < rows.size();)
+        {
+            const Row& row = rows[index];
+            const Image::Level& from = source.Levels[row.Level];
+            const uint32_t blocksX = (from.Width + 3) / 4;
+            uint8_t* out = result.Levels[row.Level].Pixels.data() + (size_t)row.Y * blocksX * blockBytes;
+            for (uint32_t x = 0; x < blocksX; x++, out += blockBytes)
+            {
+                LoadBlock(from, x, row.Y, block);
+                EncodeBlock(format, block, quality, out);
+            }
+        }
+    };
+
+    workerCount = (uint32_t)std::max<size_t>(1, std::min<size_t>(ResolveWorkers(workerCount), rows.size() / MIN_ROWS_PER_WORKER));
+    {
+        std::vector<std::thread> workers;
+        workers.reserve(workerCount - 1);
+        for (uint32_t i = 1; i < workerCount; i++)
+            workers.emplace_back(work);
+        work();
+        for (auto& worker : workers) worker.join();
+    }
+
+    output = std::move(result);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::lock_guard<std::mutex> lock(s_StatsMutex);
+    s_Stats.Images++;
+    s_Stats.Texels += texels;
+    s_Stats.OutputBytes += output.GetByteSize();
+    s_Stats.EncodeMs += ms;
+    return true;
+}
+
+bool TextureCompressor::Decompress(const Image& source, Image& output, uint32_t firstLevel)
+{
+    if (!source.IsValid()) return false;
+    if (!source.IsCompressed())
+    {
+        output = source;
+        return true;
+    }
+
+    Image result;
+    result.Levels.resize(source.Levels.size());
+    const uint32_t blockBytes = GetBlockBytes(source.Format);
+    bool decoded = true;
+
+    for (uint32_t level = 0; level < (uint32_t)source.Levels.size(); level++)
+    {
+        const Image::Level& from = source.Levels[level];
+        Image::Level& to = result.Levels[level];
+        to.Width = from.Width;
+        to.Height = from.Height;
+        if (level < firstLevel || from.Pixels.empty()) continue;
+        if (from.Pixels.size() < Image::GetLevelBytes(source.Format, from.Width, from.Height)) return false;
+
+        to.Pixels.resize((size_t)from.Width * from.Height * 4);
+        const uint32_t blocksX = (from.Width + 3) / 4, blocksY = (from.Height + 3) / 4;
+        const uint8_t* data = from.Pixels.data();
+        for (uint32_t by = 0; by < blocksY; by++)
+        {
+            for (uint32_t bx = 0; bx < blocksX; bx++, data += blockBytes)
+            {
+                uint8_t texels[16][4];
+                decoded &= DecodeBlock(source.Format, data, texels);
+
+                // Edge blocks: drop what lies outside the level
+                for (uint32_t y = 0; y < 4 && by * 4 + y < from.Height; y++)
+                    for (uint32_t x = 0; x < 4 && bx * 4 + x < from.Width; x++)
+                        std::memcpy(&to.Pixels[((size_t)(by * 4 + y) * from.Width + bx * 4 + x) * 4], texels[y * 4 + x], 4);
+            }
+        }
+    }
+
+    output = std::move(result);
+    return decoded;
+}
+
+double TextureCompressor::ComputePSNR(const Image& reference, const Image& compressed, uint32_t level, bool alpha)
+{
+    if (reference.IsCompressed() || level >= reference.Levels.size() || level >= compressed.Levels.size()) return 0.0;
+
+    Image decoded;
+    const Image* test = &compressed;
+    if (compressed.IsCompressed())
+    {
+        if (!Decompress(compressed, decoded, level)) return 0.0;
+        test = &decoded;
+    }
+
+    const Image::Level& a = reference.Levels[level];
+    const Image::Level& b = test->Levels[level];
+    if (a.Width != b.Width || a.Height != b.Height || a.Pixels.size() != b.Pixels.size() || a.Pixels.empty()) return 0.0;
+
+    double sum = 0.0;
+    uint64_t samples = 0;
+    for (size_t i = 0; i < a.Pixels.size(); i += 4)
+    {
+        for (int c = alpha ? 3 : 0; c < (alpha ? 4 : 3); c++, samples++)
+        {
+            double d = (double)a.Pixels[i + c] - b.Pixels[i + c];
+            sum += d * d;
+        }
+    }
+    if (sum == 0.0) return 99.0;
+    return 10.0 * std::log10(255.0 * 255.0 / (sum / samples));
+}
+
+bool TextureCompressor::HasAlpha(const Image& image)
+{
+    if (!image.IsValid() || image.IsCompressed() || image.Levels[0].Pixels.empty()) return false;
+
+    const std::vector<uint8_t>& pixels = image.Levels[0].Pixels;
+    for (size_t i = 3; i < pixels.size(); i += 4)
+        if (pixels[i] != 255) return true;
+    return false;
+}
+
+const char* TextureCompressor::GetQualityName(Quality quality)
+{
+    switch (quality)
+    {
+    case Quality::Fast:   return "Fast";
+    case Quality::Normal: return "Normal";
+    case Quality::High:   return "High";
+    default:              return "Unknown";
+    }
+}
+
+TextureCompressor::Stats TextureCompressor::GetStats()
+{
+    std::lock_guard<std::mutex> lock(s_StatsMutex);
+    return s_Stats;
+}
+
+void TextureCompressor::LogStats()
+{
+    Stats stats = GetStats();
+    if (stats.Images == 0) return;
+    CORE_INFO("[TextureCompressor] {0} images, {1} MTexels -> {2} KB at {3} MTexel/s ({4} ms)",
+              stats.Images, stats.Texels / 1e6, stats.OutputBytes / 1024, stats.GetMTexelsPerSecond(), stats.EncodeMs);
+}
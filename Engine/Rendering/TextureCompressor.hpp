@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include <Rendering/Image.hpp>
+
+/**
+ * ============================================================================
+ * TEXTURE COMPRESSOR - RGBA8 -> BC1 / BC3 / BC7 on the CPU, no GL
+ * ============================================================================
+ *
+ * Encodes every level of an Image into GPU block formats. Block rows of all
+ * levels are shared out to worker threads (atomic row counter); inside a
+ * block the nearest-palette search - where nearly all the time goes - runs
+ * four texels at a time with SSE2.
+ *
+ *   BC1   4 bpp   RGB, 565 endpoints + 2-bit indices (always 4-color mode)
+ *   BC3   8 bpp   BC1 color + 8-bit alpha endpoints with 3-bit indices
+ *   BC7   8 bpp   mode 6 only: RGBA 7-bit endpoints + p-bits, 4-bit indices
+ *
+ * Quality:
+ *   Fast    endpoints from the bounding box (diagonal picked by covariance
+ *           sign, inset by 1/16 of the range), one index pass
+ *   Normal  endpoints from the principal axis, one least-squares refit
+ *   High    principal axis, three refits; BC7 also tries every p-bit pair
+ *
+ * Decompress() reads everything this encoder writes (BC7: mode 6 only) and
+ * backs ComputePSNR() and the RGBA8 fallback for GPUs without S3TC/BPTC.
+ * ============================================================================
+ */
+namespace TextureCompressor
+{
+    enum class Quality : uint32_t { Fast, Normal, High, Count };
+
+    struct Stats
+    {
+        uint32_t Images = 0;
+        uint64_t Texels = 0;           // All levels
+        uint64_t OutputBytes = 0;
+        double EncodeMs = 0.0;         // Wall time
+
+        double GetMTexelsPerSecond() const { return EncodeMs > 0.0 ? (Texels / 1e6) / (EncodeMs / 1000.0) : 0.0; }
+    };
+
+    // `source` must be RGBA8; every level present is encoded. workerCount 0 = all cores.
+    bool Compress(const Image& source, TextureFormat format, Quality quality, Image& output, uint32_t workerCount = 0);
+
+    // Back to RGBA8. Levels below firstLevel keep their size but no pixels.
+    bool Decompress(const Image& source, Image& output, uint32_t firstLevel = 0);
+
+    // Peak signal-to-noise ratio of one level against the RGBA8 reference, in dB
+    // (RGB channels, or alpha only). Identical levels return 99.
+    double ComputePSNR(const Image& reference, const Image& compressed, uint32_t level = 0, bool alpha = false);
+
+    // True if any texel of level 0 is not fully opaque
+    bool HasAlpha(const Image& image);
+
+    const char* GetQualityName(Quality quality);
+
+    // Thread-safe accumulators
+    Stats GetStats();
+    void LogStats();
+}
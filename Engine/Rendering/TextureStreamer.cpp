@@ -0,0 +1,212 @@
+#include "TextureStreamer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+#include <Core/Log.hpp>
+#include <Core/Resources/AsyncLoader.hpp>
+#include <Rendering/CookedTexture.hpp>
+#include <Rendering/Image.hpp>
+#include <Rendering/Texture.hpp>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    using Id = TextureStreamingPolicy::Id;
+
+    struct Record
+    {
+        std::weak_ptr<Texture2D> Texture;
+        const Texture2D* Key = nullptr; // s_Ids key, still usable after the texture died
+        std::string Path;
+        uint32_t Serial = 0;            // Tells a reused Id from the one a load was issued for
+    };
+
+    TextureStreamingPolicy s_Policy;
+    std::vector<Record> s_Records;      // Indexed by policy Id
+    std::unordered_map<const Texture2D*, Id> s_Ids;
+    uint32_t s_NextSerial = 1;
+    bool s_Enabled = true;
+
+    uint32_t s_StreamedIn = 0;
+    double s_StreamInMs = 0.0;
+    double s_MaxStreamInMs = 0.0;
+
+    bool IsCurrent(Id id, uint32_t serial)
+    {
+        return id < s_Records.size() && s_Records[id].Serial == serial;
+    }
+
+    void Forget(Id id)
+    {
+        s_Ids.erase(s_Records[id].Key);
+        s_Records[id] = Record();
+        s_Policy.Remove(id);
+    }
+
+    // Keys are addresses, so a texture allocated where a released one lived
+    // finds the dead record; that record is dropped rather than reused
+    Id Find(const Texture2D* texture)
+    {
+        auto it = s_Ids.find(texture);
+        if (it == s_Ids.end()) return TextureStreamingPolicy::InvalidId;
+
+        Id id = it->second;
+        if (s_Records[id].Texture.expired())
+        {
+            Forget(id);
+            return TextureStreamingPolicy::InvalidId;
+        }
+        return id;
+    }
+
+    // Decode on a worker, upload from `targetMip` on the main thread.
+    // Cooked textures read only the levels being uploaded.
+    void SubmitLoad(Id id, uint32_t targetMip)
+    {
+        const Record& record = s_Records[id];
+        auto image = std::make_shared<Image>();
+        auto issued = Clock::now();
+
+        AsyncLoader::Submit(
+            [image, targetMip, path = record.Path]()
+            {
+                if (CookedTexture::IsCookedPath(path)) CookedTexture::Load(path, *image, targetMip);
+                else ImageLoader::Load(path, *image);
+            },
+            [image, id, targetMip, issued, serial = record.Serial]()
+            {
+                if (!IsCurrent(id, serial)) return;
+
+                std::shared_ptr<Texture2D> texture = s_Records[id].Texture.lock();
+                if (!texture)
+                {
+                    Forget(id);
+                    return;
+                }
+
+                // A failed decode keeps what is resident
+                if (image->IsValid() && image->GetWidth() == texture->GetWidth() && image->GetHeight() == texture->GetHeight())
+                    texture->Upload(*image, targetMip);
+                s_Policy.OnLoaded(id, texture->GetBaseMip());
+
+                double ms = std::chrono::duration<double, std::milli>(Clock::now() - issued).count();
+                s_StreamedIn++;
+                s_StreamInMs += ms;
+                s_MaxStreamInMs = std::max(s_MaxStreamInMs, ms);
+            });
+    }
+}
+
+void TextureStreamer::SetBudget(uint64_t bytes)
+{
+    s_Enabled = bytes > 0;
+    if (s_Enabled) s_Policy.SetBudget(bytes);
+}
+
+uint64_t TextureStreamer::GetBudget()
+{
+    return s_Enabled ? s_Policy.GetBudget() : 0;
+}
+
+bool TextureStreamer::IsEnabled()
+{
+    return s_Enabled;
+}
+
+uint32_t TextureStreamer::GetInitialMip(uint32_t width, uint32_t height)
+{
+    if (!s_Enabled) return 0;
+
+    uint32_t mip = 0;
+    while (std::max(width >> mip, height >> mip) > s_Policy.TailSize)
+        mip++;
+    return mip;
+}
+
+void TextureStreamer::Register(const std::shared_ptr<Texture2D>& texture, const std::string& path)
+{
+    if (!s_Enabled || !texture || Find(texture.get()) != TextureStreamingPolicy::InvalidId) return;
+
+    Id id = s_Policy.Add(texture->GetWidth(), texture->GetHeight(), texture->GetBaseMip(), texture->GetFormat());
+    if (id >= s_Records.size())
+        s_Records.resize(id + 1);
+
+    s_Records[id] = { texture, texture.get(), path, s_NextSerial++ };
+    s_Ids.emplace(texture.get(), id);
+}
+
+void TextureStreamer::Request(const Texture2D& texture, float screenPixels)
+{
+    Id id = Find(&texture);
+    if (id == TextureStreamingPolicy::InvalidId) return;
+    s_Policy.Request(id, s_Policy.ComputeMip(id, screenPixels));
+}
+
+void TextureStreamer::Update()
+{
+    if (!s_Enabled) return;
+
+    // Textures released by their owners leave the budget
+    for (Id id = 0; id < (Id)s_Records.size(); id++)
+    {
+        if (s_Records[id].Serial != 0 && s_Records[id].Texture.expired())
+            Forget(id);
+    }
+
+    for (const TextureStreamingPolicy::Action& action : s_Policy.Plan())
+    {
+        std::shared_ptr<Texture2D> texture = s_Records[action.Entry].Texture.lock();
+        if (!texture) continue;
+
+        if (action.Kind == TextureStreamingPolicy::Action::Type::Load)
+            SubmitLoad(action.Entry, action.TargetMip);
+        else if (!texture->DropMips(action.TargetMip))
+            SubmitLoad(action.Entry, action.TargetMip); // No glCopyImageSubData - re-decode the smaller set
+    }
+}
+
+TextureStreamingPolicy& TextureStreamer::GetPolicy()
+{
+    return s_Policy;
+}
+
+TextureStreamer::Stats TextureStreamer::GetStats()
+{
+    Stats stats;
+    stats.Policy = s_Policy.GetStats();
+    stats.GPUBytes = Texture2D::GetStats().Bytes;
+    stats.StreamedIn = s_StreamedIn;
+    stats.AverageStreamInMs = s_StreamedIn ? s_StreamInMs / s_StreamedIn : 0.0;
+    stats.MaxStreamInMs = s_MaxStreamInMs;
+    return stats;
+}
+
+void TextureStreamer::LogStats()
+{
+    if (!s_Enabled)
+    {
+        CORE_INFO("[TextureStreamer] Disabled - textures load every mip");
+        return;
+    }
+
+    Stats stats = GetStats();
+    CORE_INFO("[TextureStreamer] {0} textures: {1} / {2} KB resident (wanted {3} KB, GPU {4} KB), {5} frames over budget",
+              stats.Policy.Entries, stats.Policy.ResidentBytes / 1024, stats.Policy.BudgetBytes / 1024,
+              stats.Policy.WantedBytes / 1024, stats.GPUBytes / 1024, stats.Policy.OverBudgetFrames);
+    CORE_INFO("[TextureStreamer]   {0} loads ({1} pending), {2} mips evicted, stream-in {3} ms avg / {4} ms max",
+              stats.Policy.Loads, stats.Policy.PendingLoads, stats.Policy.Evictions,
+              stats.AverageStreamInMs, stats.MaxStreamInMs);
+}
+
+void TextureStreamer::Clear()
+{
+    for (Id id = 0; id < (Id)s_Records.size(); id++)
+    {
+        if (s_Records[id].Serial != 0)
+            Forget(id);
+    }
+    s_Records.clear();
+    s_Ids.clear();
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <Rendering/TextureStreamingPolicy.hpp>
+
+class Texture2D;
+
+/**
+ * ============================================================================
+ * TEXTURE STREAMER - keeps resident texture mips under a GPU memory budget
+ * ============================================================================
+ *
+ * Carries out TextureStreamingPolicy decisions on real textures:
+ *   - Evict: Texture2D::DropMips (GPU copy of the remaining levels, GL 4.3);
+ *     without 4.3 the smaller level set is re-decoded like a load.
+ *   - Load:  the file is read again on an AsyncLoader worker (a .ctex only
+ *     from the requested mip down, a source image fully decoded) and
+ *     uploaded from that mip in ResourceManager::Update().
+ *
+ * ResourceManager registers every texture it creates and uploads it at its
+ * tail mip (<= 64 px), so a texture shows up at once and sharpens when
+ * something asks for more. Renderers call Request() for each visible use,
+ * with the on-screen extent in pixels; textures nobody asks for drift back
+ * to their tail once UnusedFrames have passed.
+ *
+ * SetBudget(0) turns streaming off: textures load with every mip.
+ * ============================================================================
+ */
+namespace TextureStreamer
+{
+    struct Stats
+    {
+        TextureStreamingPolicy::Stats Policy;
+        uint64_t GPUBytes = 0;          // Texture2D::GetStats - what is really allocated
+        uint32_t StreamedIn = 0;        // Loads completed
+        double AverageStreamInMs = 0.0; // Load issued -> uploaded
+        double MaxStreamInMs = 0.0;
+    };
+
+    void SetBudget(uint64_t bytes);
+    uint64_t GetBudget();
+    bool IsEnabled();
+
+    // Mip a newly registered texture should be created at
+    uint32_t GetInitialMip(uint32_t width, uint32_t height);
+
+    // `path` is re-decoded for stream-in. Registering the same texture twice is a no-op.
+    void Register(const std::shared_ptr<Texture2D>& texture, const std::string& path);
+
+    // One call per visible use this frame; the most detailed request wins
+    void Request(const Texture2D& texture, float screenPixels);
+
+    // Main thread, once per frame (ResourceManager::Update)
+    void Update();
+
+    TextureStreamingPolicy& GetPolicy();   // Tuning (UnusedFrames, TailSize, ...)
+    Stats GetStats();
+    void LogStats();
+
+    // Forget every texture - pending loads are dropped by AsyncLoader::Shutdown
+    void Clear();
+}
@@ -0,0 +1,243 @@
+#include "TextureStreamingPolicy.hpp"
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+uint32_t TextureStreamingPolicy::GetMipCount(uint32_t width, uint32_t height)
+{
+    uint32_t count = 1;
+    for (uint32_t size = std::max(width, height); size > 1; size >>= 1)
+        count++;
+    return count;
+}
+
+uint64_t TextureStreamingPolicy::GetResidentBytes(uint32_t width, uint32_t height, uint32_t baseMip, TextureFormat format)
+{
+    uint64_t bytes = 0;
+    uint32_t count = GetMipCount(width, height);
+    for (uint32_t level = baseMip; level < count; level++)
+        bytes += Image::GetLevelBytes(format, std::max(1u, width >> level), std::max(1u, height >> level));
+    return bytes;
+}
+
+TextureStreamingPolicy::Id TextureStreamingPolicy::Add(uint32_t width, uint32_t height, uint32_t residentMip, TextureFormat format)
+{
+    Id id;
+    if (!m_FreeIds.empty())
+    {
+        id = m_FreeIds.back();
+        m_FreeIds.pop_back();
+    }
+    else
+    {
+        id = (Id)m_Entries.size();
+        m_Entries.emplace_back();
+    }
+
+    Entry& entry = m_Entries[id];
+    entry = Entry();
+    entry.Width = width;
+    entry.Height = height;
+    entry.MipCount = GetMipCount(width, height);
+    entry.Format = format;
+    entry.ResidentMip = std::min(residentMip, entry.MipCount - 1);
+    entry.Alive = true;
+
+    entry.TailMip = entry.MipCount - 1;
+    while (entry.TailMip > 0 && std::max(width >> (entry.TailMip - 1), height >> (entry.TailMip - 1)) <= TailSize)
+        entry.TailMip--;
+    entry.RequestedMip = entry.TailMip;
+
+    m_Resident += GetBytes(entry, entry.ResidentMip);
+    return id;
+}
+
+void TextureStreamingPolicy::Remove(Id id)
+{
+    if (id >= m_Entries.size() || !m_Entries[id].Alive) return;
+
+    Entry& entry = m_Entries[id];
+    // A pending load already holds its reservation
+    m_Resident -= GetBytes(entry, entry.Pending ? entry.PendingMip : entry.ResidentMip);
+    entry = Entry();
+    m_FreeIds.push_back(id);
+}
+
+void TextureStreamingPolicy::Request(Id id, uint32_t mip)
+{
+    if (id >= m_Entries.size() || !m_Entries[id].Alive) return;
+
+    Entry& entry = m_Entries[id];
+    mip = std::min(mip, entry.MipCount - 1);
+    entry.RequestedMip = entry.LastUsedFrame == m_Frame ? std::min(entry.RequestedMip, mip) : mip;
+    entry.LastUsedFrame = m_Frame;
+}
+
+uint32_t TextureStreamingPolicy::ComputeMip(Id id, float screenPixels) const
+{
+    if (id >= m_Entries.size() || !m_Entries[id].Alive) return 0;
+
+    const Entry& entry = m_Entries[id];
+    if (screenPixels <= 0.0f) return entry.TailMip;
+
+    float ratio = (float)std::max(entry.Width, entry.Height) / screenPixels;
+    if (ratio <= 1.0f) return 0;
+    return std::min((uint32_t)std::floor(std::log2(ratio)), entry.MipCount - 1);
+}
+
+uint32_t TextureStreamingPolicy::GetTarget(const Entry& entry) const
+{
+    bool recentlyUsed = entry.LastUsedFrame != 0 && m_Frame - entry.LastUsedFrame <= UnusedFrames;
+    return recentlyUsed ? std::min(entry.RequestedMip, entry.TailMip) : entry.TailMip;
+}
+
+uint64_t TextureStreamingPolicy::GetBytes(const Entry& entry, uint32_t mip) const
+{
+    return GetResidentBytes(entry.Width, entry.Height, mip, entry.Format);
+}
+
+uint64_t TextureStreamingPolicy::EvictLRU(uint64_t bytes, Id keep, std::vector<Action>& actions)
+{
+    // Entries holding more detail than they need, least recently used first
+    std::vector<Id> candidates;
+    for (Id id = 0; id < (Id)m_Entries.size(); id++)
+    {
+        const Entry& entry = m_Entries[id];
+        if (entry.Alive && !entry.Pending && id != keep && entry.ResidentMip < GetTarget(entry))
+            candidates.push_back(id);
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [this](Id a, Id b) { return m_Entries[a].LastUsedFrame < m_Entries[b].LastUsedFrame; });
+
+    uint64_t freed = 0;
+    for (Id id : candidates)
+    {
+        if (freed >= bytes) break;
+
+        Entry& entry = m_Entries[id];
+        uint32_t target = GetTarget(entry);
+        uint32_t mip = entry.ResidentMip;
+        uint64_t before = GetBytes(entry, mip);
+
+        // One mip at a time - take only what is needed
+        while (mip < target && freed + (before - GetBytes(entry, mip)) < bytes)
+            mip++;
+
+        uint64_t released = before - GetBytes(entry, mip);
+        m_Evictions += mip - entry.ResidentMip;
+        entry.ResidentMip = mip;
+        m_Resident -= released;
+        freed += released;
+        actions.push_back({ Action::Type::Evict, id, mip });
+    }
+    return freed;
+}
+
+std::vector<TextureStreamingPolicy::Action> TextureStreamingPolicy::Plan()
+{
+    std::vector<Action> actions;
+
+    if (m_Resident > m_Budget)
+        EvictLRU(m_Resident - m_Budget, InvalidId, actions);
+
+    // Biggest deficit first, then most recently used
+    struct Candidate
+    {
+        uint32_t Deficit;
+        uint64_t LastUsed;
+        Id Entry;
+        bool operator<(const Candidate& other) const
+        {
+            return Deficit != other.Deficit ? Deficit < other.Deficit : LastUsed < other.LastUsed;
+        }
+    };
+
+    std::priority_queue<Candidate> heap;
+    for (Id id = 0; id < (Id)m_Entries.size(); id++)
+    {
+        const Entry& entry = m_Entries[id];
+        if (!entry.Alive || entry.Pending) continue;
+        uint32_t target = GetTarget(entry);
+        if (target < entry.ResidentMip)
+            heap.push({ entry.ResidentMip - target, entry.LastUsedFrame, id });
+    }
+
+    uint32_t issued = 0;
+    while (!heap.empty() && issued < MaxLoadsPerFrame)
+    {
+        Id id = heap.top().Entry;
+        heap.pop();
+
+        Entry& entry = m_Entries[id];
+        uint32_t target = GetTarget(entry);
+        uint64_t current = GetBytes(entry, entry.ResidentMip);
+
+        uint64_t needed = m_Resident + GetBytes(entry, target) - current;
+        if (needed > m_Budget)
+            EvictLRU(needed - m_Budget, id, actions);
+
+        // Trim to the most detailed mip that fits
+        while (target < entry.ResidentMip && m_Resident + GetBytes(entry, target) - current > m_Budget)
+            target++;
+        if (target >= entry.ResidentMip) continue;
+
+        // Reserve now so the budget holds while the load is in flight
+        m_Resident += GetBytes(entry, target) - current;
+        entry.Pending = true;
+        entry.PendingMip = target;
+        m_Loads++;
+        issued++;
+        actions.push_back({ Action::Type::Load, id, target });
+    }
+
+    if (m_Resident > m_Budget)
+        m_OverBudgetFrames++;
+    m_Frame++;
+    return actions;
+}
+
+void TextureStreamingPolicy::OnLoaded(Id id, uint32_t residentMip)
+{
+    if (id >= m_Entries.size() || !m_Entries[id].Alive || !m_Entries[id].Pending) return;
+
+    Entry& entry = m_Entries[id];
+    residentMip = std::min(residentMip, entry.MipCount - 1);
+    // Release the reservation, account for what actually arrived
+    m_Resident -= GetBytes(entry, entry.PendingMip);
+    m_Resident += GetBytes(entry, residentMip);
+    entry.ResidentMip = residentMip;
+    entry.Pending = false;
+}
+
+uint32_t TextureStreamingPolicy::GetResidentMip(Id id) const
+{
+    return id < m_Entries.size() && m_Entries[id].Alive ? m_Entries[id].ResidentMip : 0;
+}
+
+uint32_t TextureStreamingPolicy::GetTargetMip(Id id) const
+{
+    return id < m_Entries.size() && m_Entries[id].Alive ? GetTarget(m_Entries[id]) : 0;
+}
+
+bool TextureStreamingPolicy::IsPending(Id id) const
+{
+    return id < m_Entries.size() && m_Entries[id].Alive && m_Entries[id].Pending;
+}
+
+TextureStreamingPolicy::Stats TextureStreamingPolicy::GetStats() const
+{
+    Stats stats;
+    stats.BudgetBytes = m_Budget;
+    stats.ResidentBytes = m_Resident;
+    stats.Loads = m_Loads;
+    stats.Evictions = m_Evictions;
+    stats.OverBudgetFrames = m_OverBudgetFrames;
+    for (const Entry& entry : m_Entries)
+    {
+        if (!entry.Alive) continue;
+        stats.Entries++;
+        stats.PendingLoads += entry.Pending ? 1 : 0;
+        stats.WantedBytes += GetBytes(entry, GetTarget(entry));
+    }
+    return stats;
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include <Rendering/Image.hpp>
+
+/**
+ * ============================================================================
+ * TEXTURE STREAMING POLICY - which mips should be resident, no GL
+ * ============================================================================
+ *
+ * Bookkeeping and decisions only; TextureStreamer carries them out. Every
+ * entry has a resident mip (first level on the GPU) and a requested mip
+ * (what its on-screen size needs, refreshed by Request() each frame it is
+ * seen). Lower mip number = more detail = more bytes.
+ *
+ * Plan() once per frame:
+ *   1. Entries not seen for UnusedFrames fall back to their tail mip
+ *      (largest level <= TailSize) as their target.
+ *   2. Over budget: evict from the least recently used entries first (one
+ *      mip at a time, never below their target) until resident <= budget.
+ *   3. Loads: entries below their target, biggest deficit first (priority
+ *      heap, ties go to the most recently used). A load that does not fit
+ *      evicts the same way; if it still does not fit it is trimmed to the
+ *      most detailed mip that does.
+ *
+ * Loads are asynchronous: their bytes are reserved when issued, and the
+ * entry is skipped until OnLoaded(). Evictions are applied immediately by
+ * the caller. Requests above the budget cannot all be met - the budget
+ * wins, and OverBudgetFrames only counts frames the policy could not fix.
+ * ============================================================================
+ */
+class TextureStreamingPolicy
+{
+public:
+    using Id = uint32_t;
+    static constexpr Id InvalidId = 0xFFFFFFFFu;
+
+    struct Action
+    {
+        enum class Type : uint8_t { Load, Evict };
+        Type Kind = Type::Load;
+        Id Entry = InvalidId;
+        uint32_t TargetMip = 0;   // New first resident level
+    };
+
+    struct Stats
+    {
+        uint64_t BudgetBytes = 0;
+        uint64_t ResidentBytes = 0;
+        uint64_t WantedBytes = 0;       // If every target were resident
+        uint32_t Entries = 0;
+        uint32_t PendingLoads = 0;
+        uint32_t Loads = 0;             // Issued, lifetime
+        uint32_t Evictions = 0;         // Mips dropped, lifetime
+        uint32_t OverBudgetFrames = 0;  // Plan() ended above budget
+    };
+
+    uint32_t UnusedFrames = 120;    // Not requested for this long -> tail mip
+    uint32_t TailSize = 64;         // Tail mip: largest level with max(w, h) <= this
+    uint32_t MaxLoadsPerFrame = 4;
+
+    void SetBudget(uint64_t bytes) { m_Budget = bytes; }
+    uint64_t GetBudget() const { return m_Budget; }
+
+    Id Add(uint32_t width, uint32_t height, uint32_t residentMip, TextureFormat format = TextureFormat::RGBA8);
+    void Remove(Id id);
+
+    // Keeps the most detailed request of the frame
+    void Request(Id id, uint32_t mip);
+    // On-screen extent (pixels) -> mip, e.g. 1024 texels over 256 px -> mip 2
+    uint32_t ComputeMip(Id id, float screenPixels) const;
+
+    std::vector<Action> Plan();
+
+    // Load finished (mip resident) or failed (mip unchanged)
+    void OnLoaded(Id id, uint32_t residentMip);
+
+    uint32_t GetResidentMip(Id id) const;
+    uint32_t GetTargetMip(Id id) const;
+    bool IsPending(Id id) const;
+    uint64_t GetFrame() const { return m_Frame; }
+
+    Stats GetStats() const;
+
+    static uint32_t GetMipCount(uint32_t width, uint32_t height);
+    // Bytes of levels [baseMip, mipCount) in `format`
+    static uint64_t GetResidentBytes(uint32_t width, uint32_t height, uint32_t baseMip,
+                                     TextureFormat format = TextureFormat::RGBA8);
+
+private:
+    struct Entry
+    {
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        uint32_t MipCount = 0;
+        uint32_t TailMip = 0;
+        uint32_t ResidentMip = 0;
+        uint32_t RequestedMip = 0;      // Latest frame's most detailed request
+        uint32_t PendingMip = 0;        // Load in flight; its bytes are reserved
+        uint64_t LastUsedFrame = 0;
+        TextureFormat Format = TextureFormat::RGBA8;
+        bool Pending = false;
+        bool Alive = false;
+    };
+
+    uint32_t GetTarget(const Entry& entry) const;
+    uint64_t GetBytes(const Entry& entry, uint32_t mip) const;
+    // Frees up to `bytes` from LRU entries holding more than their target
+    uint64_t EvictLRU(uint64_t bytes, Id keep, std::vector<Action>& actions);
+
+    std::vector<Entry> m_Entries;
+    std::vector<Id> m_FreeIds;
+    uint64_t m_Budget = 256ull * 1024 * 1024;
+    uint64_t m_Resident = 0;
+    uint64_t m_Frame = 1;
+    uint32_t m_Loads = 0;
+    uint32_t m_Evictions = 0;
+    uint32_t m_OverBudgetFrames = 0;
+};
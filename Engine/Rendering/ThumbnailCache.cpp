@@ -0,0 +1,540 @@
+#include "ThumbnailCache.hpp"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <Core/GLDebug.hpp>
+#include <Core/Log.hpp>
+#include <Core/Resources/AsyncLoader.hpp>
+#include <Rendering/Mesh/Mesh.hpp>
+#include <Rendering/Mesh/ObjImporter.hpp>
+#include <Rendering/Texture.hpp>
+#include <Rendering/TextureCompressor.hpp>
+
+// EXT_texture_compression_s3tc - not in the generated loader
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+    #define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    // ---- Disk cache: header, then one BC3 level of CellSize x CellSize ----
+    struct ThumbnailHeader
+    {
+        static constexpr uint32_t MagicValue = 0x31424854; // "THB1"
+        static constexpr uint32_t CurrentVersion = 1;      // Bump when the generators change
+
+        uint32_t Magic = MagicValue;
+        uint32_t Version = CurrentVersion;
+        uint32_t Size = ThumbnailCache::CellSize;
+        uint32_t Format = (uint32_t)TextureFormat::BC3;
+    };
+
+    constexpr uint32_t NO_CELL = (uint32_t)-1;
+
+    enum class EntryState : uint8_t
+    {
+        Pending,
+        Ready,
+        Failed       // No preview possible - not retried until the content changes
+    };
+
+    struct Entry
+    {
+        EntryState State = EntryState::Pending;
+        uint32_t Cell = NO_CELL;
+        uint64_t LastUsed = 0;   // Frame
+    };
+
+    // Filled on the worker, consumed by the upload
+    struct Job
+    {
+        Image Pixels;            // BC3
+        bool FromDisk = false;
+        bool Succeeded = false;
+        double GenerateMs = 0.0;
+        Clock::time_point Queued;
+    };
+
+    std::string s_Directory;
+    uint32_t s_AtlasID = 0;
+    uint32_t s_AtlasSize = 0;
+    uint32_t s_CellsPerRow = 0;
+    bool s_Compressed = false;   // BC3 atlas; RGBA8 otherwise
+
+    std::unordered_map<uint64_t, Entry> s_Entries;   // Content hash -> thumbnail
+    std::vector<uint64_t> s_CellOwners;              // Cell -> content hash
+    std::vector<uint32_t> s_FreeCells;
+    uint64_t s_Frame = 1;
+    uint32_t s_InFlight = 0;
+    uint32_t s_Generation = 0;   // Bumped by Shutdown - uploads of an old atlas are dropped
+
+    ThumbnailCache::Stats s_Stats;
+    double s_GenerateMs = 0.0;
+    double s_LatencyMs = 0.0;
+    uint32_t s_Completed = 0;
+
+    std::string GetCachePath(uint64_t contentHash)
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.thumb", (unsigned long long)contentHash);
+        return s_Directory + "/" + name;
+    }
+
+    bool ReadCached(const std::string& path, Image& image)
+    {
+        std::ifstream file(path, std::ios::binary);
+        ThumbnailHeader header;
+        if (!file.read((char*)&header, sizeof(header))) return false;
+
+        ThumbnailHeader expected;
+        if (std::memcmp(&header, &expected, sizeof(header)) != 0) return false;
+
+        image.Format = TextureFormat::BC3;
+        image.Levels.resize(1);
+        Image::Level& level = image.Levels[0];
+        level.Width = level.Height = ThumbnailCache::CellSize;
+        level.Pixels.resize(Image::GetLevelBytes(TextureFormat::BC3, level.Width, level.Height));
+        return (bool)file.read((char*)level.Pixels.data(), (std::streamsize)level.Pixels.size());
+    }
+
+    // Temp file + rename - a half-written thumbnail is never read back
+    void WriteCached(const std::string& path, const Image& image)
+    {
+        const std::string tmpPath = path + ".tmp";
+        {
+            std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+            ThumbnailHeader header;
+            file.write((const char*)&header, sizeof(header));
+            file.write((const char*)image.Levels[0].Pixels.data(), (std::streamsize)image.Levels[0].Pixels.size());
+            if (!file) return;
+        }
+        std::error_code error;
+        fs::rename(tmpPath, path, error);
+        if (error) fs::remove(tmpPath, error);
+    }
+
+    // Copies `source` (RGBA8, at most the cell's size) into the middle of the cell
+    void BlitCentered(const Image::Level& source, Image::Level& cell)
+    {
+        const uint32_t x0 = (cell.Width - source.Width) / 2;
+        const uint32_t y0 = (cell.Height - source.Height) / 2;
+        for (uint32_t y = 0; y < source.Height; y++)
+        {
+            std::memcpy(&cell.Pixels[((size_t)(y0 + y) * cell.Width + x0) * 4],
+                        &source.Pixels[(size_t)y * source.Width * 4], (size_t)source.Width * 4);
+        }
+    }
+
+    // Bilinear resample of `source` (RGBA8, at most twice the cell's size) to fit the cell, centered
+    void ResampleCentered(const Image::Level& source, Image::Level& cell)
+    {
+        const float scale = std::min(1.0f, std::min((float)cell.Width / source.Width, (float)cell.Height / source.Height));
+        Image::Level fitted;
+        fitted.Width = std::max(1u, (uint32_t)(source.Width * scale + 0.5f));
+        fitted.Height = std::max(1u, (uint32_t)(source.Height * scale + 0.5f));
+        fitted.Pixels.resize((size_t)fitted.Width * fitted.Height * 4);
+
+        for (uint32_t y = 0; y < fitted.Height; y++)
+        {
+            const float sy = std::clamp((y + 0.5f) / scale - 0.5f, 0.0f, (float)(source.Height - 1));
+            const uint32_t y0 = (uint32_t)sy, y1 = std::min(y0 + 1, source.Height - 1);
+            const float fy = sy - y0;
+            for (uint32_t x = 0; x < fitted.Width; x++)
+            {
+                const float sx = std::clamp((x + 0.5f) / scale - 0.5f, 0.0f, (float)(source.Width - 1));
+                const uint32_t x0 = (uint32_t)sx, x1 = std::min(x0 + 1, source.Width - 1);
+                const float fx = sx - x0;
+                const uint8_t* p00 = &source.Pixels[((size_t)y0 * source.Width + x0) * 4];
+                const uint8_t* p10 = &source.Pixels[((size_t)y0 * source.Width + x1) * 4];
+                const uint8_t* p01 = &source.Pixels[((size_t)y1 * source.Width + x0) * 4];
+                const uint8_t* p11 = &source.Pixels[((size_t)y1 * source.Width + x1) * 4];
+                uint8_t* out = &fitted.Pixels[((size_t)y * fitted.Width + x) * 4];
+                for (int c = 0; c < 4; c++)
+                {
+                    const float top = p00[c] + (p10[c] - p00[c]) * fx;
+                    const float bottom = p01[c] + (p11[c] - p01[c]) * fx;
+                    out[c] = (uint8_t)(top + (bottom - top) * fy + 0.5f);
+                }
+            }
+        }
+        BlitCentered(fitted, cell);
+    }
+
+    // Orthographic three-quarter view of the mesh, fitted to size x size, flat
+    // shaded with a z-buffer. Two-sided lighting: OBJ winding is not reliable.
+    void Rasterize(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, uint32_t size, Image::Level& target)
+    {
+        // Yaw 45 degrees, then pitch 30 degrees down
+        const float yawCos = std::cos(glm::radians(-45.0f)), yawSin = std::sin(glm::radians(-45.0f));
+        const float pitchCos = std::cos(glm::radians(30.0f)), pitchSin = std::sin(glm::radians(30.0f));
+        auto toView = [=](const glm::vec3& p)
+        {
+            const float x = yawCos * p.x + yawSin * p.z;
+            const float z = yawCos * p.z - yawSin * p.x;
+            return glm::vec3(x, pitchCos * p.y - pitchSin * z, pitchSin * p.y + pitchCos * z);
+        };
+
+        std::vector<glm::vec3> projected(vertices.size());
+        glm::vec3 minimum(INFINITY), maximum(-INFINITY);
+        for (size_t i = 0; i < vertices.size(); i++)
+        {
+            projected[i] = toView(vertices[i].Position);
+            minimum = glm::min(minimum, projected[i]);
+            maximum = glm::max(maximum, projected[i]);
+        }
+
+        // 5% margin; y flips to rows top to bottom
+        const glm::vec3 extent = maximum - minimum;
+        const glm::vec3 center = (minimum + maximum) * 0.5f;
+        const float scale = 0.9f * (float)size / std::max(std::max(extent.x, extent.y), 1e-6f);
+        for (glm::vec3& p : projected)
+        {
+            p.x = (p.x - center.x) * scale + size * 0.5f;
+            p.y = size * 0.5f - (p.y - center.y) * scale;
+        }
+
+        const glm::vec3 light = glm::normalize(glm::vec3(-0.4f, 0.6f, 0.7f));
+        std::vector<float> depth((size_t)size * size, -INFINITY);
+        target.Width = target.Height = size;
+        target.Pixels.assign((size_t)size * size * 4, 0);
+
+        for (size_t t = 0; t + 2 < indices.size(); t += 3)
+        {
+            if (indices[t] >= projected.size() || indices[t + 1] >= projected.size() || indices[t + 2] >= projected.size()) continue;
+            const glm::vec3 a = projected[indices[t]], b = projected[indices[t + 1]], c = projected[indices[t + 2]];
+
+            const float area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+            if (std::abs(area) < 1e-8f) continue;
+
+            // View-space face normal (screen y is flipped, which only changes the sign)
+            const glm::vec3 origin = toView(vertices[indices[t]].Position);
+            glm::vec3 normal = glm::cross(toView(vertices[indices[t + 1]].Position) - origin,
+                                          toView(vertices[indices[t + 2]].Position) - origin);
+            const float length = glm::length(normal);
+            const float shade = 0.3f + 0.7f * (length > 0.0f ? std::abs(glm::dot(normal / length, light)) : 1.0f);
+            const uint8_t r = (uint8_t)(200.0f * shade), g = (uint8_t)(206.0f * shade), bl = (uint8_t)(218.0f * shade);
+
+            const int xMin = std::max(0, (int)std::floor(std::min({ a.x, b.x, c.x })));
+            const int xMax = std::min((int)size - 1, (int)std::ceil(std::max({ a.x, b.x, c.x })));
+            const int yMin = std::max(0, (int)std::floor(std::min({ a.y, b.y, c.y })));
+            const int yMax = std::min((int)size - 1, (int)std::ceil(std::max({ a.y, b.y, c.y })));
+            const float inverseArea = 1.0f / area;
+
+            for (int y = yMin; y <= yMax; y++)
+            {
+                const float py = y + 0.5f;
+                for (int x = xMin; x <= xMax; x++)
+                {
+                    const float px = x + 0.5f;
+                    const float w0 = ((c.x - b.x) * (py - b.y) - (c.y - b.y) * (px - b.x)) * inverseArea;
+                    const float w1 = ((a.x - c.x) * (py - c.y) - (a.y - c.y) * (px - c.x)) * inverseArea;
+                    const float w2 = 1.0f - w0 - w1;
+                    if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f) continue;
+
+                    // Larger view-space z is nearer the camera
+                    const float z = w0 * a.z + w1 * b.z + w2 * c.z;
+                    float& stored = depth[(size_t)y * size + x];
+                    if (z <= stored) continue;
+                    stored = z;
+
+                    uint8_t* pixel = &target.Pixels[((size_t)y * size + x) * 4];
+                    pixel[0] = r;
+                    pixel[1] = g;
+                    pixel[2] = bl;
+                    pixel[3] = 255;
+                }
+            }
+        }
+    }
+
+    // Least recently used cell not shown this frame; NO_CELL if every cell is on screen
+    uint32_t AcquireCell()
+    {
+        if (!s_FreeCells.empty())
+        {
+            uint32_t cell = s_FreeCells.back();
+            s_FreeCells.pop_back();
+            return cell;
+        }
+
+        uint32_t victim = NO_CELL;
+        uint64_t oldest = s_Frame;
+        for (uint32_t cell = 0; cell < (uint32_t)s_CellOwners.size(); cell++)
+        {
+            auto it = s_Entries.find(s_CellOwners[cell]);
+            if (it != s_Entries.end() && it->second.State == EntryState::Ready && it->second.LastUsed < oldest)
+            {
+                oldest = it->second.LastUsed;
+                victim = cell;
+            }
+        }
+        if (victim == NO_CELL) return NO_CELL;
+
+        s_Entries.erase(s_CellOwners[victim]);
+        s_Stats.Evicted++;
+        return victim;
+    }
+
+    void ReleaseCell(uint32_t cell)
+    {
+        if (cell != NO_CELL) s_FreeCells.push_back(cell);
+    }
+
+    ThumbnailCache::Thumbnail GetCellThumbnail(uint32_t cell)
+    {
+        const float step = (float)ThumbnailCache::CellSize / (float)s_AtlasSize;
+        ThumbnailCache::Thumbnail thumbnail;
+        thumbnail.TextureID = s_AtlasID;
+        thumbnail.U0 = (cell % s_CellsPerRow) * step;
+        thumbnail.V0 = (cell / s_CellsPerRow) * step;
+        thumbnail.U1 = thumbnail.U0 + step;
+        thumbnail.V1 = thumbnail.V0 + step;
+        return thumbnail;
+    }
+
+    void UploadCell(uint32_t cell, const Image& image)
+    {
+        const GLint x = (GLint)((cell % s_CellsPerRow) * ThumbnailCache::CellSize);
+        const GLint y = (GLint)((cell / s_CellsPerRow) * ThumbnailCache::CellSize);
+        const GLsizei size = (GLsizei)ThumbnailCache::CellSize;
+
+        GL_CALL(glBindTexture(GL_TEXTURE_2D, s_AtlasID));
+        if (s_Compressed)
+        {
+            GL_CALL(glCompressedTexSubImage2D(GL_TEXTURE_2D, 0, x, y, size, size, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,
+                                              (GLsizei)image.Levels[0].Pixels.size(), image.Levels[0].Pixels.data()));
+        }
+        else
+        {
+            Image decoded;
+            if (TextureCompressor::Decompress(image, decoded))
+                GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, size, size, GL_RGBA, GL_UNSIGNED_BYTE, decoded.Levels[0].Pixels.data()));
+        }
+        GL_CALL(glBindTexture(GL_TEXTURE_2D, 0));
+    }
+
+    void FinishJob(uint64_t contentHash, const Job& job)
+    {
+        s_InFlight--;
+        auto it = s_Entries.find(contentHash);
+        if (it == s_Entries.end()) return;
+        Entry& entry = it->second;
+
+        if (!job.Succeeded)
+        {
+            ReleaseCell(entry.Cell);
+            entry.Cell = NO_CELL;
+            entry.State = EntryState::Failed;
+            s_Stats.Failed++;
+            return;
+        }
+
+        UploadCell(entry.Cell, job.Pixels);
+        entry.State = EntryState::Ready;
+
+        if (job.FromDisk) s_Stats.DiskHits++;
+        else
+        {
+            s_Stats.Generated++;
+            s_GenerateMs += job.GenerateMs;
+        }
+        s_Completed++;
+        s_LatencyMs += std::chrono::duration<double, std::milli>(Clock::now() - job.Queued).count();
+    }
+}
+
+void ThumbnailCache::Init(const std::string& cacheDirectory, uint32_t atlasSize)
+{
+    Shutdown();
+
+    s_Directory = cacheDirectory;
+    std::error_code error;
+    fs::create_directories(s_Directory, error);
+
+    s_CellsPerRow = std::max(1u, atlasSize / CellSize);
+    s_AtlasSize = s_CellsPerRow * CellSize;
+    s_Compressed = Texture2D::IsFormatSupported(TextureFormat::BC3);
+
+    GL_CALL(glGenTextures(1, &s_AtlasID));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, s_AtlasID));
+    if (s_Compressed)
+    {
+        // Every cell is uploaded before it is shown - the initial contents do not matter
+        std::vector<uint8_t> blank(Image::GetLevelBytes(TextureFormat::BC3, s_AtlasSize, s_AtlasSize));
+        GL_CALL(glCompressedTexImage2D(GL_TEXTURE_2D, 0, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, s_AtlasSize, s_AtlasSize, 0,
+                                       (GLsizei)blank.size(), blank.data()));
+    }
+    else
+    {
+        GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, s_AtlasSize, s_AtlasSize, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+    }
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, 0));
+
+    const uint32_t cellCount = s_CellsPerRow * s_CellsPerRow;
+    s_CellOwners.assign(cellCount, 0);
+    s_FreeCells.resize(cellCount);
+    for (uint32_t i = 0; i < cellCount; i++)
+        s_FreeCells[i] = cellCount - 1 - i; // Cell 0 first
+
+    CORE_INFO("[ThumbnailCache] {0}x{0} {1} atlas, {2} cells of {3} px, cache '{4}'", s_AtlasSize,
+              s_Compressed ? "BC3" : "RGBA8", cellCount, CellSize, s_Directory);
+}
+
+void ThumbnailCache::Shutdown()
+{
+    if (s_AtlasID) GL_CALL(glDeleteTextures(1, &s_AtlasID));
+    s_AtlasID = 0;
+    s_Entries.clear();
+    s_CellOwners.clear();
+    s_FreeCells.clear();
+    s_InFlight = 0;
+    s_Generation++;
+
+    s_Stats = Stats();
+    s_GenerateMs = s_LatencyMs = 0.0;
+    s_Completed = 0;
+}
+
+void ThumbnailCache::Update()
+{
+    s_Frame++;
+}
+
+bool ThumbnailCache::HasPreview(const AssetRecord& asset)
+{
+    if (asset.Type == AssetType::Texture) return true;
+    if (asset.Type != AssetType::Model || asset.Path.size() < 4) return false;
+
+    std::string extension = asset.Path.substr(asset.Path.size() - 4);
+    for (char& c : extension) c = (char)std::tolower((unsigned char)c);
+    return extension == ".obj"; // The only model format with a CPU-side importer
+}
+
+ThumbnailCache::Thumbnail ThumbnailCache::Get(const AssetRecord& asset)
+{
+    if (!s_AtlasID || !HasPreview(asset)) return {};
+
+    auto it = s_Entries.find(asset.ContentHash);
+    if (it != s_Entries.end())
+    {
+        it->second.LastUsed = s_Frame;
+        return it->second.State == EntryState::Ready ? GetCellThumbnail(it->second.Cell) : Thumbnail();
+    }
+
+    if (s_InFlight >= MaxInFlight) return {}; // Asked again next frame if still visible
+    const uint32_t cell = AcquireCell();
+    if (cell == NO_CELL) return {};
+
+    Entry& entry = s_Entries[asset.ContentHash];
+    entry.Cell = cell;
+    entry.LastUsed = s_Frame;
+    s_CellOwners[cell] = asset.ContentHash;
+    s_InFlight++;
+
+    auto job = std::make_shared<Job>();
+    job->Queued = Clock::now();
+    AsyncLoader::Submit(
+        [job, path = AssetDatabase::GetAbsolutePath(asset), type = asset.Type, cachePath = GetCachePath(asset.ContentHash)]()
+        {
+            if (ReadCached(cachePath, job->Pixels))
+            {
+                job->FromDisk = job->Succeeded = true;
+                return;
+            }
+
+            auto start = Clock::now();
+            Image thumbnail;
+            job->Succeeded = Generate(path, type, thumbnail) &&
+                             TextureCompressor::Compress(thumbnail, TextureFormat::BC3, TextureCompressor::Quality::Fast, job->Pixels, 1);
+            job->GenerateMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            if (job->Succeeded) WriteCached(cachePath, job->Pixels);
+        },
+        [job, contentHash = asset.ContentHash, generation = s_Generation]()
+        {
+            if (generation == s_Generation) FinishJob(contentHash, *job);
+        });
+
+    return {};
+}
+
+bool ThumbnailCache::Generate(const std::string& path, AssetType type, Image& thumbnail)
+{
+    Image result;
+    result.Format = TextureFormat::RGBA8;
+    result.Levels.resize(1);
+    Image::Level& cell = result.Levels[0];
+    cell.Width = cell.Height = CellSize;
+    cell.Pixels.assign((size_t)CellSize * CellSize * 4, 0);
+
+    if (type == AssetType::Texture)
+    {
+        // The mip chain does the heavy downscale: the smallest level still
+        // covering the cell, then one bilinear step of at most 2:1
+        Image image;
+        if (!ImageLoader::Load(path, image, true)) return false;
+
+        size_t level = 0;
+        while (level + 1 < image.Levels.size() &&
+               std::max(image.Levels[level + 1].Width, image.Levels[level + 1].Height) >= CellSize)
+            level++;
+        ResampleCentered(image.Levels[level], cell);
+    }
+    else if (type == AssetType::Model)
+    {
+        std::vector<Vertex> vertices;
+        std::vector<uint32_t> indices;
+        if (!ObjImporter::Load(path, vertices, indices, nullptr, 1)) return false;
+
+        // 2x supersampling: render at twice the size, box-filter with the mip builder
+        Image rendered;
+        rendered.Levels.resize(1);
+        Rasterize(vertices, indices, CellSize * 2, rendered.Levels[0]);
+        ImageLoader::GenerateMips(rendered);
+        BlitCentered(rendered.Levels[1], cell);
+    }
+    else
+    {
+        return false;
+    }
+
+    thumbnail = std::move(result);
+    return true;
+}
+
+ThumbnailCache::Stats ThumbnailCache::GetStats()
+{
+    Stats stats = s_Stats;
+    stats.Capacity = (uint32_t)s_CellOwners.size();
+    stats.Resident = stats.Capacity - (uint32_t)s_FreeCells.size() - s_InFlight;
+    stats.InFlight = s_InFlight;
+    stats.AverageGenerateMs = s_Stats.Generated ? s_GenerateMs / s_Stats.Generated : 0.0;
+    stats.AverageLatencyMs = s_Completed ? s_LatencyMs / s_Completed : 0.0;
+    return stats;
+}
+
+void ThumbnailCache::LogStats()
+{
+    Stats stats = GetStats();
+    CORE_INFO("[ThumbnailCache] {0}/{1} cells, {2} generated ({3} ms avg), {4} from disk, {5} failed, {6} evicted, {7} ms avg latency",
+              stats.Resident, stats.Capacity, stats.Generated, stats.AverageGenerateMs, stats.DiskHits, stats.Failed,
+              stats.Evicted, stats.AverageLatencyMs);
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+#include <Core/Resources/AssetDatabase.hpp>
+#include <Rendering/Image.hpp>
+
+/**
+ * ============================================================================
+ * THUMBNAIL CACHE - asset previews for the Content Browser
+ * ============================================================================
+ *
+ * Get() returns an asset's cell in one shared atlas texture, or nothing yet:
+ * the first ask queues the thumbnail on an AsyncLoader worker and it shows
+ * up a few frames later. Only what is asked for is made, so a browser that
+ * draws just its visible rows only generates what the user scrolls past.
+ *
+ * Workers:
+ *   - Textures: decoded with mips; the first level that fits the cell is
+ *     the (box-filtered) thumbnail.
+ *   - OBJ models: rasterized on the CPU - orthographic three-quarter view,
+ *     z-buffer, flat shading - at twice the cell size and box-filtered down.
+ *     No GL, so nothing is rendered on the main thread.
+ * Thumbnails are BC3 (4 KB per 64 px cell) in the atlas and on disk under
+ * cache/thumbnails/<content hash>.thumb: a restart or a moved file reuses
+ * them, an edit (new hash) makes a fresh one. Without S3TC the atlas is
+ * RGBA8 and cells are decompressed on upload.
+ *
+ * Cells are recycled least-recently-used; one asked for this frame is never
+ * evicted. At most MaxInFlight jobs run at once - items scrolled past before
+ * their turn are never queued.
+ * ============================================================================
+ */
+namespace ThumbnailCache
+{
+    constexpr uint32_t CellSize = 64;
+    constexpr uint32_t MaxInFlight = 8;
+
+    struct Thumbnail
+    {
+        uint32_t TextureID = 0;     // Atlas; 0 = not ready, or no preview for this asset
+        float U0 = 0.0f, V0 = 0.0f; // Top left
+        float U1 = 0.0f, V1 = 0.0f; // Bottom right
+
+        bool IsReady() const { return TextureID != 0; }
+    };
+
+    struct Stats
+    {
+        uint32_t Resident = 0;          // Cells holding a thumbnail
+        uint32_t Capacity = 0;
+        uint32_t InFlight = 0;
+        uint32_t Generated = 0;         // Made from the source file
+        uint32_t DiskHits = 0;          // Read from the cache directory
+        uint32_t Failed = 0;
+        uint32_t Evicted = 0;
+        double AverageGenerateMs = 0.0; // Worker time per generated thumbnail
+        double AverageLatencyMs = 0.0;  // Get() -> uploaded, generated and disk hits
+    };
+
+    // Main thread with a GL context; atlasSize is rounded down to whole cells
+    void Init(const std::string& cacheDirectory = "cache/thumbnails", uint32_t atlasSize = 2048);
+    // Frees the atlas; thumbnails still in flight are dropped
+    void Shutdown();
+
+    // Main thread, once per frame: ages the LRU
+    void Update();
+
+    // Main thread, for each visible asset every frame
+    Thumbnail Get(const AssetRecord& asset);
+    bool HasPreview(const AssetRecord& asset);
+
+    // Any thread: CellSize x CellSize RGBA8 preview of `path`, transparent around the content
+    bool Generate(const std::string& path, AssetType type, Image& thumbnail);
+
+    Stats GetStats();
+    void LogStats();
+}
@@ -1,7 +1,10 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <memory>
 
+#include <entt/entt.hpp>
+
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
@@ -62,12 +65,45 @@ struct TransformComponent
     }
 };
 
+// -----------------------------
+// World Transform Component
+// -----------------------------
+// Parent's world matrix * the local TransformComponent. Added with every
+// TransformComponent and kept current by TransformHierarchy - read it for
+// rendering and picking, edit TransformComponent.
+struct WorldTransformComponent
+{
+    glm::mat4 Matrix{ 1.0f };
+
+    WorldTransformComponent() = default;
+    WorldTransformComponent(const glm::mat4& matrix)
+        : Matrix(matrix) {}
+};
+
+// -----------------------------
+// Relationship Component
+// -----------------------------
+// Parent/child links: an intrusive list of children. Only entities that
+// have a parent or children carry one. Changed through
+// TransformHierarchy::SetParent (SceneAPI::SetParent), never directly.
+struct RelationshipComponent
+{
+    entt::entity Parent = entt::null;
+    entt::entity FirstChild = entt::null;
+    entt::entity PrevSibling = entt::null;
+    entt::entity NextSibling = entt::null;
+    uint32_t ChildCount = 0;
+
+    uint32_t Slot = UINT32_MAX; // Index in TransformHierarchy's depth-sorted arrays
+};
+
 // -----------------------------
 // Mesh Component  (TOP LEVEL)
 // -----------------------------
 struct MeshComponent
 {
     std::shared_ptr<Mesh> MeshHandle;
+    uint32_t LOD = 0;   // Level drawn last frame, picked by SceneRenderer's LODSelector
 
     MeshComponent() = default;
     MeshComponent(const std::shared_ptr<Mesh>& mesh)
@@ -0,0 +1,239 @@
+#include "HierarchyIndex.hpp"
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <string_view>
+
+#include <Core/Log.hpp>
+
+#include "Scene.hpp"
+#include "Components.hpp"
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Changes above this share of the rows (or 1024) are cheaper as a full rebuild
+    constexpr size_t MERGE_LIMIT_DIVISOR = 8;
+    constexpr size_t MERGE_LIMIT_MIN = 1024;
+
+    constexpr uint32_t CHANGED_FILTER_BITS = 4096;
+
+    uint32_t FilterBit(entt::entity entity)
+    {
+        return ((uint32_t)entity * 2654435761u) >> 20; // Fibonacci hash, top 12 bits
+    }
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    // Newest first; ties by handle so the order is stable across refreshes
+    bool RowBefore(const HierarchyIndex::Row& lhs, const HierarchyIndex::Row& rhs)
+    {
+        if (lhs.Order != rhs.Order) return lhs.Order > rhs.Order;
+        return (uint32_t)lhs.Handle > (uint32_t)rhs.Handle;
+    }
+
+    char ToLower(char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? char(c - 'A' + 'a') : c;
+    }
+
+    std::string ToLower(const std::string& text)
+    {
+        std::string lower(text);
+        for (char& c : lower) c = ToLower(c);
+        return lower;
+    }
+}
+
+void HierarchyIndex::Attach(Scene* scene)
+{
+    if (scene == m_Scene) return;
+    Detach();
+    if (!scene) return;
+
+    m_Scene = scene;
+    auto& reg = scene->Reg();
+    reg.on_construct<TagComponent>().connect<&HierarchyIndex::OnRowChanged>(*this);
+    reg.on_destroy<TagComponent>().connect<&HierarchyIndex::OnRowChanged>(*this);
+    reg.on_update<TagComponent>().connect<&HierarchyIndex::OnNameChanged>(*this);
+    reg.on_construct<HierarchyOrderComponent>().connect<&HierarchyIndex::OnRowChanged>(*this);
+    reg.on_update<HierarchyOrderComponent>().connect<&HierarchyIndex::OnRowChanged>(*this);
+    reg.on_destroy<HierarchyOrderComponent>().connect<&HierarchyIndex::OnRowChanged>(*this);
+
+    m_NeedsRebuild = true;
+}
+
+void HierarchyIndex::Detach()
+{
+    if (!m_Scene) return;
+
+    auto& reg = m_Scene->Reg();
+    reg.on_construct<TagComponent>().disconnect<&HierarchyIndex::OnRowChanged>(*this);
+    reg.on_destroy<TagComponent>().disconnect<&HierarchyIndex::OnRowChanged>(*this);
+    reg.on_update<TagComponent>().disconnect<&HierarchyIndex::OnNameChanged>(*this);
+    reg.on_construct<HierarchyOrderComponent>().disconnect<&HierarchyIndex::OnRowChanged>(*this);
+    reg.on_update<HierarchyOrderComponent>().disconnect<&HierarchyIndex::OnRowChanged>(*this);
+    reg.on_destroy<HierarchyOrderComponent>().disconnect<&HierarchyIndex::OnRowChanged>(*this);
+
+    m_Scene = nullptr;
+    m_Rows.clear();
+    m_Changed.clear();
+    m_Names.clear();
+    m_NameOffsets.clear();
+    m_Matches.clear();
+    m_Query.clear();
+    m_NeedsRebuild = true;
+    m_NamesDirty = true;
+}
+
+void HierarchyIndex::OnRowChanged(entt::registry&, entt::entity entity)
+{
+    if (m_NeedsRebuild) return;
+
+    m_Changed.push_back(entity);
+    if (m_Changed.size() > std::max(MERGE_LIMIT_MIN, m_Rows.size() / MERGE_LIMIT_DIVISOR))
+    {
+        m_NeedsRebuild = true;
+        m_Changed.clear();
+    }
+}
+
+void HierarchyIndex::OnNameChanged(entt::registry&, entt::entity)
+{
+    m_NamesDirty = true;
+}
+
+void HierarchyIndex::Refresh()
+{
+    if (!m_Scene || (!m_NeedsRebuild && m_Changed.empty())) return;
+
+    auto start = Clock::now();
+    if (m_NeedsRebuild)
+        Rebuild();
+    else
+        Merge();
+
+    m_NeedsRebuild = false;
+    m_Changed.clear();
+    m_NamesDirty = true;
+    m_Stats.Rows = (uint32_t)m_Rows.size();
+    m_Stats.LastRefreshMs = ElapsedMs(start);
+}
+
+void HierarchyIndex::Rebuild()
+{
+    auto& reg = m_Scene->Reg();
+    auto view = reg.view<TagComponent, HierarchyOrderComponent>();
+
+    m_Rows.clear();
+    m_Rows.reserve(view.size_hint());
+    for (auto entity : view)
+        m_Rows.push_back({ view.get<HierarchyOrderComponent>(entity).Order, entity });
+
+    std::sort(m_Rows.begin(), m_Rows.end(), RowBefore);
+    m_Stats.FullRebuilds++;
+}
+
+void HierarchyIndex::Merge()
+{
+    auto& reg = m_Scene->Reg();
+
+    std::sort(m_Changed.begin(), m_Changed.end());
+    m_Changed.erase(std::unique(m_Changed.begin(), m_Changed.end()), m_Changed.end());
+
+    // Changed entities leave the list and come back in at their new place, if they still qualify
+    std::vector<Row> inserts;
+    for (entt::entity entity : m_Changed)
+    {
+        if (reg.valid(entity) && reg.all_of<TagComponent, HierarchyOrderComponent>(entity))
+            inserts.push_back({ reg.get<HierarchyOrderComponent>(entity).Order, entity });
+    }
+    std::sort(inserts.begin(), inserts.end(), RowBefore);
+
+    // A small hashed bitmap rejects almost every unchanged row before the binary search
+    uint64_t filter[CHANGED_FILTER_BITS / 64] = {};
+    for (entt::entity entity : m_Changed)
+    {
+        uint32_t bit = FilterBit(entity);
+        filter[bit / 64] |= 1ull << (bit % 64);
+    }
+    m_Rows.erase(std::remove_if(m_Rows.begin(), m_Rows.end(), [&](const Row& row)
+    {
+        uint32_t bit = FilterBit(row.Handle);
+        return (filter[bit / 64] >> (bit % 64) & 1) && std::binary_search(m_Changed.begin(), m_Changed.end(), row.Handle);
+    }), m_Rows.end());
+
+    // Into the spare buffer, which keeps its capacity between refreshes
+    m_Merged.clear();
+    m_Merged.reserve(std::max(m_Rows.capacity(), m_Rows.size() + inserts.size()));
+    std::merge(m_Rows.begin(), m_Rows.end(), inserts.begin(), inserts.end(), std::back_inserter(m_Merged), RowBefore);
+    m_Rows.swap(m_Merged);
+    m_Stats.Merges++;
+}
+
+void HierarchyIndex::BuildSearchIndex()
+{
+    auto tags = m_Scene->Reg().view<TagComponent>(); // Direct pool access, no registry lookup per row
+
+    m_Names.clear();
+    m_Names.reserve(m_Rows.size() * 16);
+    m_NameOffsets.resize(m_Rows.size() + 1);
+    for (size_t i = 0; i < m_Rows.size(); ++i)
+    {
+        size_t start = m_Names.size();
+        m_NameOffsets[i] = (uint32_t)start;
+        m_Names.append(tags.get<TagComponent>(m_Rows[i].Handle).Tag);
+        m_Names.push_back('\0');
+        std::transform(m_Names.begin() + start, m_Names.end(), m_Names.begin() + start, [](char c) { return ToLower(c); });
+    }
+    m_NameOffsets[m_Rows.size()] = (uint32_t)m_Names.size();
+
+    m_NamesDirty = false;
+    m_Stats.SearchRebuilds++;
+}
+
+const std::vector<uint32_t>& HierarchyIndex::Filter(const std::string& query)
+{
+    auto start = Clock::now();
+    std::string lower = ToLower(query);
+
+    if (!m_NamesDirty && lower == m_Query) return m_Matches;
+
+    // Narrowing a query that is still valid only re-checks its matches
+    bool narrow = !m_NamesDirty && !m_Query.empty() && lower.compare(0, m_Query.size(), m_Query) == 0;
+    if (m_NamesDirty) BuildSearchIndex();
+
+    if (lower.empty())
+    {
+        m_Matches.resize(m_Rows.size());
+        std::iota(m_Matches.begin(), m_Matches.end(), 0u);
+    }
+    else if (narrow)
+    {
+        m_Matches.erase(std::remove_if(m_Matches.begin(), m_Matches.end(), [&](uint32_t row)
+        {
+            std::string_view name(m_Names.data() + m_NameOffsets[row], m_NameOffsets[row + 1] - m_NameOffsets[row] - 1);
+            return name.find(lower) == std::string_view::npos;
+        }), m_Matches.end());
+    }
+    else
+    {
+        // One pass over every name; a hit jumps to the start of the next row
+        m_Matches.clear();
+        size_t position = 0;
+        while ((position = m_Names.find(lower, position)) != std::string::npos)
+        {
+            uint32_t row = uint32_t(std::upper_bound(m_NameOffsets.begin(), m_NameOffsets.end(), (uint32_t)position) - m_NameOffsets.begin() - 1);
+            m_Matches.push_back(row);
+            position = m_NameOffsets[row + 1];
+        }
+    }
+
+    m_Query = std::move(lower);
+    m_Stats.LastFilterMs = ElapsedMs(start);
+    return m_Matches;
+}
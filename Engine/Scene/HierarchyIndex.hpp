@@ -0,0 +1,92 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <entt/entt.hpp>
+
+class Scene;
+
+// ============================================================================
+// HierarchyIndex - the Hierarchy panel's row order, kept up to date
+// ============================================================================
+// Rows are the entities with a TagComponent and a HierarchyOrderComponent,
+// newest (highest Order) first. Registry signals record which entities
+// changed; Refresh() (once per frame) merges just those back into the sorted
+// list - O(n) for a few changes instead of sorting the whole pool every
+// frame - and only rebuilds from scratch when a large part of the scene
+// changed at once.
+//
+// Filter() is a case-insensitive substring match over a search index: every
+// row's lowercased name in one buffer, so a query is a single linear scan.
+// Typing more characters narrows the previous result instead of scanning
+// again. The index is only built once a filter is used and only refreshed
+// when names or rows changed.
+//
+// Renames must go through the registry (replace/patch/emplace_or_replace)
+// to be seen; writing TagComponent::Tag in place is not signalled.
+// ============================================================================
+class HierarchyIndex
+{
+public:
+    struct Row
+    {
+        int32_t Order;
+        entt::entity Handle;
+    };
+
+    struct Stats
+    {
+        uint32_t Rows = 0;
+        uint32_t FullRebuilds = 0;
+        uint32_t Merges = 0;            // Incremental refreshes
+        uint32_t SearchRebuilds = 0;
+        double LastRefreshMs = 0.0;
+        double LastFilterMs = 0.0;
+    };
+
+    HierarchyIndex() = default;
+    ~HierarchyIndex() { Detach(); }
+
+    HierarchyIndex(const HierarchyIndex&) = delete;
+    HierarchyIndex& operator=(const HierarchyIndex&) = delete;
+
+    // Connects to the scene's registry; Detach() before the scene is destroyed
+    void Attach(Scene* scene);
+    void Detach();
+    Scene* GetScene() const { return m_Scene; }
+
+    // Applies recorded changes; call before reading rows each frame
+    void Refresh();
+
+    // Newest first
+    const std::vector<Row>& GetRows() const { return m_Rows; }
+    // Indices into GetRows() whose name contains `query`, ignoring ASCII case
+    const std::vector<uint32_t>& Filter(const std::string& query);
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    void OnRowChanged(entt::registry& registry, entt::entity entity);
+    void OnNameChanged(entt::registry& registry, entt::entity entity);
+
+    void Rebuild();
+    void Merge();
+    void BuildSearchIndex();
+
+    Scene* m_Scene = nullptr;
+    std::vector<Row> m_Rows;
+    std::vector<Row> m_Merged;              // Merge() output, swapped with m_Rows
+    std::vector<entt::entity> m_Changed;    // Since the last Refresh(), may repeat
+    bool m_NeedsRebuild = true;
+
+    // Search index: lowercased names, '\0' terminated, in row order
+    std::string m_Names;
+    std::vector<uint32_t> m_NameOffsets;    // Row -> start in m_Names; one extra = end
+    bool m_NamesDirty = true;
+
+    std::string m_Query;                    // Last query, lowercased
+    std::vector<uint32_t> m_Matches;
+
+    Stats m_Stats;
+};
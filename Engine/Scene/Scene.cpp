@@ -4,6 +4,15 @@
 
 Scene::Scene()
 {
+    m_Registry.on_construct<HierarchyOrderComponent>().connect<&Scene::OnOrderSet>(*this);
+    m_Registry.on_update<HierarchyOrderComponent>().connect<&Scene::OnOrderSet>(*this);
+    m_Transforms.Attach(m_Registry);
+}
+
+void Scene::OnOrderSet(entt::registry& registry, entt::entity entity)
+{
+    int32_t order = registry.get<HierarchyOrderComponent>(entity).Order;
+    if (order >= m_NextOrder) m_NextOrder = order + 1;
 }
 
 Entity Scene::CreateEntity(const std::string& name)
@@ -34,6 +43,9 @@ void Scene::DestroyEntity(Entity entity)
         m_EntityMap.erase(entity.GetComponent<IDComponent>().ID);
     }
 
+    // Children become roots instead of pointing at a dead parent
+    m_Transforms.Unlink(entity.Handle());
+
     m_Registry.destroy(entity.Handle());
 }
 
@@ -83,10 +95,15 @@ void Scene::OnUpdate(float ts)
                     dup.LastSourcePosition = sourceTC.Position;
                     dup.LastSourceRotation = sourceTC.Rotation;
                     dup.LastSourceScale = sourceTC.Scale;
+
+                    // Written in place - signal it so the world transform follows
+                    m_Registry.patch<TransformComponent>(entity);
                 }
             }
         }
     }
+
+    m_Transforms.Update();
 }
 
 Entity Scene::GetEntityByUUID(Core::UUID uuid)
@@ -3,6 +3,8 @@
 #include <Core/UUID.hpp>
 #include <unordered_map>
 
+#include "TransformHierarchy.hpp"
+
 class Entity;
 
 class Scene
@@ -11,6 +13,9 @@ public:
     Scene();
     ~Scene() = default;
 
+    Scene(const Scene&) = delete;
+    Scene& operator=(const Scene&) = delete;
+
     Entity CreateEntity(const std::string& name = "Entity");
     Entity CreateEntityWithUUID(Core::UUID uuid, const std::string& name = "Entity");
     void DestroyEntity(Entity entity);
@@ -21,7 +26,17 @@ public:
 
     entt::registry& Reg() { return m_Registry; }
 
+    // Next HierarchyOrderComponent::Order, above every order in the scene - O(1), no view scan
+    int32_t AllocateOrder() { return m_NextOrder++; }
+
+    // Parent/child links and WorldTransformComponent; updated at the end of OnUpdate()
+    TransformHierarchy& GetTransforms() { return m_Transforms; }
+
 private:
+    void OnOrderSet(entt::registry& registry, entt::entity entity);
+
     entt::registry m_Registry;
     std::unordered_map<Core::UUID, entt::entity> m_EntityMap;
+    int32_t m_NextOrder = 0; // Raised past any order set directly (undo, loading)
+    TransformHierarchy m_Transforms;
 };
@@ -14,12 +14,22 @@ namespace SceneAPI
 {
     inline void SetNextOrder(Entity entity)
     {
-        auto& reg = entity.GetScene()->Reg();
-        int32_t maxOrder = -1;
-        reg.view<HierarchyOrderComponent>().each([&](auto e, auto& hc) {
-            if (hc.Order > maxOrder) maxOrder = hc.Order;
-        });
-        entity.AddOrReplaceComponent<HierarchyOrderComponent>(maxOrder + 1);
+        entity.AddOrReplaceComponent<HierarchyOrderComponent>(entity.GetScene()->AllocateOrder());
+    }
+
+    // Empty parent = make it a root. Keeps the child's world transform; false if it would create a cycle.
+    inline bool SetParent(Entity child, Entity parent)
+    {
+        return child.GetScene()->GetTransforms().SetParent(child.Handle(), parent ? parent.Handle() : entt::null);
+    }
+
+    // Same parent as the source, so a copied local transform lands in the same place
+    inline void CopyParent(Entity source, Entity duplicate)
+    {
+        TransformHierarchy& transforms = duplicate.GetScene()->GetTransforms();
+        entt::entity parent = transforms.GetParent(source.Handle());
+        if (parent != entt::null)
+            transforms.SetParent(duplicate.Handle(), parent, false);
     }
 
     inline Entity CreateEmptyEntity(Scene& scene, const std::string& name = "Empty Entity")
@@ -98,6 +108,7 @@ namespace SceneAPI
             duplicate.AddComponent<DuplicationComponent>(sourceID);
         }
 
+        CopyParent(source, duplicate);
         SetNextOrder(duplicate);
         return duplicate;
     }
@@ -137,6 +148,7 @@ namespace SceneAPI
             duplicate.AddComponent<DuplicationComponent>(sourceID);
         }
 
+        CopyParent(source, duplicate);
         SetNextOrder(duplicate);
         return duplicate;
     }
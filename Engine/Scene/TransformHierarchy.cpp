@@ -0,0 +1,418 @@
+#include "TransformHierarchy.hpp"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/matrix_decompose.hpp>
+
+#include <Core/Log.hpp>
+#include <Core/WorkerPool.hpp>
+
+#include "Components.hpp"
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    // Position / Euler degrees / scale from a TRS matrix (the gizmo's decomposition)
+    void SetLocalFromMatrix(TransformComponent& transform, const glm::mat4& matrix)
+    {
+        glm::vec3 scale, translation, skew;
+        glm::quat rotation;
+        glm::vec4 perspective;
+        if (!glm::decompose(matrix, scale, rotation, translation, skew, perspective)) return;
+
+        transform.Position = translation;
+        transform.Rotation = glm::degrees(glm::eulerAngles(rotation));
+        transform.Scale = scale;
+    }
+}
+
+TransformHierarchy::TransformHierarchy() = default;
+TransformHierarchy::~TransformHierarchy() = default;
+
+void TransformHierarchy::Attach(entt::registry& registry)
+{
+    m_Registry = &registry;
+    registry.on_construct<TransformComponent>().connect<&TransformHierarchy::OnTransformConstructed>(*this);
+    registry.on_update<TransformComponent>().connect<&TransformHierarchy::OnTransformUpdated>(*this);
+}
+
+void TransformHierarchy::OnTransformConstructed(entt::registry& registry, entt::entity entity)
+{
+    registry.emplace_or_replace<WorldTransformComponent>(entity, registry.get<TransformComponent>(entity).GetMatrix());
+    if (registry.all_of<RelationshipComponent>(entity))
+        m_StructureDirty = true; // Node gains HasTransform
+}
+
+void TransformHierarchy::OnTransformUpdated(entt::registry& registry, entt::entity entity)
+{
+    const RelationshipComponent* relationship = registry.try_get<RelationshipComponent>(entity);
+    if (!relationship)
+    {
+        m_FlatDirty.push_back(entity);
+        return;
+    }
+
+    // Newly linked nodes have no slot yet; the pending rebuild marks every node dirty anyway
+    if (!m_StructureDirty && relationship->Slot < m_Entities.size() && m_Entities[relationship->Slot] == entity)
+        MarkDirty(relationship->Slot);
+}
+
+entt::entity TransformHierarchy::GetParent(entt::entity entity) const
+{
+    const RelationshipComponent* relationship = m_Registry->try_get<RelationshipComponent>(entity);
+    return relationship ? relationship->Parent : entt::null;
+}
+
+glm::mat4 TransformHierarchy::GetWorldMatrix(entt::entity entity) const
+{
+    const WorldTransformComponent* world = m_Registry->try_get<WorldTransformComponent>(entity);
+    return world ? world->Matrix : glm::mat4(1.0f);
+}
+
+bool TransformHierarchy::SetParent(entt::entity child, entt::entity parent, bool keepWorld)
+{
+    auto& reg = *m_Registry;
+    if (!reg.valid(child) || child == parent) return false;
+    if (parent != entt::null && !reg.valid(parent)) return false;
+    if (GetParent(child) == parent) return true;
+
+    // Only an entity with children can end up below itself
+    const RelationshipComponent* relationship = reg.try_get<RelationshipComponent>(child);
+    if (parent != entt::null && relationship && relationship->ChildCount > 0)
+    {
+        for (entt::entity ancestor = parent; ancestor != entt::null; ancestor = GetParent(ancestor))
+        {
+            if (ancestor == child)
+            {
+                CORE_WARN("[TransformHierarchy] Cannot parent an entity to its own descendant");
+                return false;
+            }
+        }
+    }
+
+    glm::mat4 world = GetWorldMatrix(child);
+
+    if (GetParent(child) != entt::null)
+        RemoveFromParent(child);
+    if (parent != entt::null)
+        Link(child, parent);
+
+    if (keepWorld && reg.all_of<TransformComponent>(child))
+    {
+        glm::mat4 local = parent != entt::null ? glm::inverse(GetWorldMatrix(parent)) * world : world;
+        TransformComponent transform = reg.get<TransformComponent>(child);
+        SetLocalFromMatrix(transform, local);
+        reg.replace<TransformComponent>(child, transform);
+    }
+
+    m_StructureDirty = true;
+    return true;
+}
+
+void TransformHierarchy::Link(entt::entity child, entt::entity parent)
+{
+    auto& reg = *m_Registry;
+
+    // Emplacing may move the pool - take references only afterwards
+    reg.get_or_emplace<RelationshipComponent>(parent);
+    reg.get_or_emplace<RelationshipComponent>(child);
+    auto& parentLinks = reg.get<RelationshipComponent>(parent);
+    auto& childLinks = reg.get<RelationshipComponent>(child);
+
+    childLinks.Parent = parent;
+    childLinks.PrevSibling = entt::null;
+    childLinks.NextSibling = parentLinks.FirstChild;
+    if (parentLinks.FirstChild != entt::null)
+        reg.get<RelationshipComponent>(parentLinks.FirstChild).PrevSibling = child;
+    parentLinks.FirstChild = child;
+    parentLinks.ChildCount++;
+}
+
+void TransformHierarchy::RemoveFromParent(entt::entity child)
+{
+    auto& reg = *m_Registry;
+    auto& childLinks = reg.get<RelationshipComponent>(child);
+    entt::entity parent = childLinks.Parent;
+    auto& parentLinks = reg.get<RelationshipComponent>(parent);
+
+    if (childLinks.PrevSibling != entt::null)
+        reg.get<RelationshipComponent>(childLinks.PrevSibling).NextSibling = childLinks.NextSibling;
+    else
+        parentLinks.FirstChild = childLinks.NextSibling;
+    if (childLinks.NextSibling != entt::null)
+        reg.get<RelationshipComponent>(childLinks.NextSibling).PrevSibling = childLinks.PrevSibling;
+    parentLinks.ChildCount--;
+
+    childLinks.Parent = childLinks.PrevSibling = childLinks.NextSibling = entt::null;
+
+    // Removing components moves the pool - references above are dead after this
+    DropIfUnlinked(parent);
+    DropIfUnlinked(child);
+}
+
+void TransformHierarchy::Unlink(entt::entity entity)
+{
+    auto& reg = *m_Registry;
+    while (const RelationshipComponent* relationship = reg.try_get<RelationshipComponent>(entity))
+    {
+        if (relationship->FirstChild != entt::null)
+            SetParent(relationship->FirstChild, entt::null, true);
+        else if (relationship->Parent != entt::null)
+            SetParent(entity, entt::null, false);
+        else
+            break;
+    }
+    m_StructureDirty = true;
+}
+
+void TransformHierarchy::DropIfUnlinked(entt::entity entity)
+{
+    auto& reg = *m_Registry;
+    const RelationshipComponent* relationship = reg.try_get<RelationshipComponent>(entity);
+    if (!relationship || relationship->Parent != entt::null || relationship->ChildCount > 0) return;
+
+    reg.remove<RelationshipComponent>(entity);
+    m_FlatDirty.push_back(entity); // World = local again
+    m_StructureDirty = true;
+}
+
+void TransformHierarchy::Rebuild()
+{
+    auto start = Clock::now();
+    auto& reg = *m_Registry;
+    auto links = reg.view<RelationshipComponent>();
+    auto transforms = reg.view<TransformComponent>();
+
+    m_Entities.clear();
+    m_Parent.clear();
+    m_ChildBegin.clear();
+    m_ChildEnd.clear();
+    m_Flags.clear();
+    m_LevelStart.assign(1, 0);
+
+    auto push = [&](entt::entity entity, uint32_t parent)
+    {
+        links.get<RelationshipComponent>(entity).Slot = (uint32_t)m_Entities.size();
+        m_Entities.push_back(entity);
+        m_Parent.push_back(parent);
+        m_ChildBegin.push_back(0);
+        m_ChildEnd.push_back(0);
+        m_Flags.push_back(LocalDirty | (transforms.contains(entity) ? HasTransform : 0));
+    };
+
+    for (auto entity : links)
+    {
+        if (links.get<RelationshipComponent>(entity).Parent == entt::null)
+            push(entity, NoParent);
+    }
+
+    // Breadth first: level by level, each parent's children appended together
+    for (uint32_t begin = 0; begin < (uint32_t)m_Entities.size();)
+    {
+        uint32_t end = (uint32_t)m_Entities.size();
+        m_LevelStart.push_back(end);
+        for (uint32_t i = begin; i < end; i++)
+        {
+            m_ChildBegin[i] = (uint32_t)m_Entities.size();
+            for (entt::entity child = links.get<RelationshipComponent>(m_Entities[i]).FirstChild; child != entt::null;
+                 child = links.get<RelationshipComponent>(child).NextSibling)
+                push(child, i);
+            m_ChildEnd[i] = (uint32_t)m_Entities.size();
+        }
+        begin = end;
+    }
+
+    // Everything is recomputed once
+    uint32_t levels = (uint32_t)m_LevelStart.size() - 1;
+    m_World.resize(m_Entities.size());
+    m_LevelDirty.resize(levels);
+    for (uint32_t level = 0; level < levels; level++)
+        m_LevelDirty[level].assign(1, { m_LevelStart[level], m_LevelStart[level + 1] });
+    m_MinDirtyLevel = levels ? 0 : UINT32_MAX;
+    m_MaxDirtyLevel = levels ? levels - 1 : 0;
+
+    m_StructureDirty = false;
+    m_Stats.Nodes = (uint32_t)m_Entities.size();
+    m_Stats.Levels = levels;
+    m_Stats.Rebuilds++;
+    m_Stats.LastRebuildMs = ElapsedMs(start);
+}
+
+void TransformHierarchy::MarkDirty(uint32_t slot)
+{
+    m_Flags[slot] |= LocalDirty;
+
+    uint32_t level = (uint32_t)(std::upper_bound(m_LevelStart.begin(), m_LevelStart.end(), slot) - m_LevelStart.begin()) - 1;
+    std::vector<Range>& dirty = m_LevelDirty[level];
+    if (!dirty.empty() && dirty.back().End == slot)
+        dirty.back().End++; // Neighbouring edits (a selection moved together) stay one range
+    else
+        dirty.push_back({ slot, slot + 1 });
+    m_MinDirtyLevel = std::min(m_MinDirtyLevel, level);
+    m_MaxDirtyLevel = std::max(m_MaxDirtyLevel, level);
+}
+
+void TransformHierarchy::Update(uint32_t workerCount)
+{
+    if (!m_Registry) return;
+
+    if (m_StructureDirty)
+        Rebuild();
+
+    auto start = Clock::now();
+    auto& reg = *m_Registry;
+    m_Stats.LastUpdated = 0;
+    m_Stats.LastWorkers = 0;
+
+    if (!m_FlatDirty.empty())
+    {
+        auto view = reg.view<TransformComponent, WorldTransformComponent>();
+        for (entt::entity entity : m_FlatDirty)
+        {
+            if (!reg.valid(entity) || !view.contains(entity) || reg.all_of<RelationshipComponent>(entity)) continue;
+            view.get<WorldTransformComponent>(entity).Matrix = view.get<TransformComponent>(entity).GetMatrix();
+            m_Stats.LastUpdated++;
+        }
+        m_FlatDirty.clear();
+    }
+
+    if (m_MinDirtyLevel <= m_MaxDirtyLevel)
+        Propagate(workerCount ? workerCount : std::max(1u, std::thread::hardware_concurrency()));
+
+    m_Stats.LastPropagateMs = ElapsedMs(start);
+}
+
+void TransformHierarchy::Propagate(uint32_t workerCount)
+{
+    auto& reg = *m_Registry;
+    auto transforms = reg.view<TransformComponent>();
+    auto worlds = reg.view<WorldTransformComponent>();
+
+    // Keeps `ranges` sorted and disjoint, given ranges in ascending order
+    auto append = [](std::vector<Range>& ranges, uint32_t begin, uint32_t end)
+    {
+        if (begin >= end) return;
+        if (!ranges.empty() && begin <= ranges.back().End)
+            ranges.back().End = std::max(ranges.back().End, end);
+        else
+            ranges.push_back({ begin, end });
+    };
+
+    // Dirty nodes [first, last) of m_Ranges, counted across ranges. Returns how many were
+    // recomputed; the children that must follow them are appended to `children`.
+    auto process = [&](uint32_t first, uint32_t last, std::vector<Range>& children)
+    {
+        uint32_t updated = 0;
+        size_t r = (size_t)(std::upper_bound(m_RangeOffsets.begin(), m_RangeOffsets.end(), first) - m_RangeOffsets.begin()) - 1;
+        for (; r < m_Ranges.size() && m_RangeOffsets[r] < last; r++)
+        {
+            const Range& range = m_Ranges[r];
+            uint32_t begin = range.Begin + (first > m_RangeOffsets[r] ? first - m_RangeOffsets[r] : 0);
+            uint32_t end = std::min(range.End, range.Begin + (last - m_RangeOffsets[r]));
+            for (uint32_t i = begin; i < end; i++)
+            {
+                uint8_t flags = m_Flags[i];
+                uint32_t parent = m_Parent[i];
+                if (!(flags & LocalDirty) && (parent == NoParent || !(m_Flags[parent] & WorldChanged))) continue;
+
+                entt::entity entity = m_Entities[i];
+                glm::mat4 local = (flags & HasTransform) ? transforms.get<TransformComponent>(entity).GetMatrix() : glm::mat4(1.0f);
+                m_World[i] = parent == NoParent ? local : m_World[parent] * local;
+                if (flags & HasTransform)
+                    worlds.get<WorldTransformComponent>(entity).Matrix = m_World[i];
+
+                m_Flags[i] = (flags & HasTransform) | WorldChanged;
+                append(children, m_ChildBegin[i], m_ChildEnd[i]);
+                updated++;
+            }
+        }
+        return updated;
+    };
+
+    auto clearFlags = [this](const std::vector<Range>& ranges)
+    {
+        for (const Range& range : ranges)
+        {
+            for (uint32_t i = range.Begin; i < range.End; i++)
+                m_Flags[i] &= HasTransform;
+        }
+    };
+
+    const uint32_t levels = (uint32_t)m_LevelStart.size() - 1;
+    m_Inherited.clear();
+    m_Previous.clear();
+    for (uint32_t level = m_MinDirtyLevel; level < levels; level++)
+    {
+        if (level > m_MaxDirtyLevel && m_Inherited.empty()) break;
+
+        // Edited slots and inherited children, merged into one sorted list
+        std::vector<Range>& own = m_LevelDirty[level];
+        std::sort(own.begin(), own.end(), [](const Range& a, const Range& b) { return a.Begin < b.Begin; });
+        m_Ranges.clear();
+        for (size_t a = 0, b = 0; a < m_Inherited.size() || b < own.size();)
+        {
+            bool inherited = b == own.size() || (a < m_Inherited.size() && m_Inherited[a].Begin < own[b].Begin);
+            const Range& next = inherited ? m_Inherited[a++] : own[b++];
+            append(m_Ranges, next.Begin, next.End);
+        }
+        own.clear();
+
+        m_RangeOffsets.clear();
+        uint32_t count = 0;
+        for (const Range& range : m_Ranges)
+        {
+            m_RangeOffsets.push_back(count);
+            count += range.End - range.Begin;
+        }
+
+        // Threads by dirty nodes, not by how far apart they are
+        uint32_t workers = std::max(1u, std::min(workerCount, count / MinNodesPerWorker));
+        m_Inherited.clear();
+        if (workers <= 1)
+        {
+            m_Stats.LastUpdated += process(0, count, m_Inherited);
+        }
+        else
+        {
+            if (!m_Workers || m_Workers->GetThreadCount() != workerCount)
+                m_Workers = std::make_unique<WorkerPool>(workerCount);
+
+            // Equal node counts per chunk; parents are a finished level, slots are disjoint
+            m_WorkerChildren.resize(workers);
+            m_WorkerUpdated.assign(workers, 0);
+            uint32_t chunk = (count + workers - 1) / workers;
+            m_Workers->Run(workers, [&](uint32_t w)
+            {
+                m_WorkerChildren[w].clear();
+                uint32_t first = w * chunk;
+                if (first < count)
+                    m_WorkerUpdated[w] = process(first, std::min(count, first + chunk), m_WorkerChildren[w]);
+            });
+
+            // Chunks are in slot order, so their children are too
+            for (uint32_t w = 0; w < workers; w++)
+            {
+                for (const Range& range : m_WorkerChildren[w])
+                    append(m_Inherited, range.Begin, range.End);
+                m_Stats.LastUpdated += m_WorkerUpdated[w];
+            }
+        }
+        m_Stats.LastWorkers = std::max(m_Stats.LastWorkers, workers);
+
+        // The previous level was read as parents for the last time
+        clearFlags(m_Previous);
+        std::swap(m_Previous, m_Ranges);
+    }
+    clearFlags(m_Previous);
+
+    m_MinDirtyLevel = UINT32_MAX;
+    m_MaxDirtyLevel = 0;
+}
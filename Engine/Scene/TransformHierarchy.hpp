@@ -0,0 +1,129 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+
+// ============================================================================
+// TransformHierarchy - parent/child links and world transform propagation
+// ============================================================================
+// Every TransformComponent gets a WorldTransformComponent. An entity without
+// parent or children ("flat") just has world = local, recomputed when its
+// TransformComponent is signalled as changed.
+//
+// Entities linked by RelationshipComponent live in depth-sorted arrays
+// (breadth first): all roots, then all depth-1 nodes, ... so a parent is
+// always processed before its children and every level is one contiguous
+// range. Each level keeps a sorted list of dirty slot ranges: the nodes
+// edited directly plus the children of nodes recomputed one level up
+// (children of consecutive parents are consecutive, so a moved subtree is
+// one range per level). Update() walks only those ranges - a clean frame
+// costs nothing, and two small edits far apart never scan what lies between
+// them. A level with at least 2 * MinNodesPerWorker dirty nodes is split by
+// node count over a persistent WorkerPool; levels themselves run in order.
+//
+// Changes are seen through registry signals: edit a TransformComponent with
+// replace/patch/emplace_or_replace (or patch<TransformComponent>(entity)
+// after writing it in place). Linking or unlinking (SetParent, destroying a
+// linked entity) rebuilds the arrays on the next Update().
+// ============================================================================
+class WorkerPool;
+
+class TransformHierarchy
+{
+public:
+    struct Stats
+    {
+        uint32_t Nodes = 0;             // Linked entities in the depth-sorted arrays
+        uint32_t Levels = 0;
+        uint32_t Rebuilds = 0;
+        uint32_t LastUpdated = 0;       // World matrices recomputed by the last Update()
+        uint32_t LastWorkers = 0;       // Most threads one level of the last Update() used
+        double LastRebuildMs = 0.0;
+        double LastPropagateMs = 0.0;
+    };
+
+    // Below this many dirty nodes per thread, waking workers costs more than it saves
+    static constexpr uint32_t MinNodesPerWorker = 4096;
+
+    TransformHierarchy();
+    ~TransformHierarchy();
+    TransformHierarchy(const TransformHierarchy&) = delete;
+    TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+
+    // Connects to the registry's TransformComponent signals; the registry must outlive this
+    void Attach(entt::registry& registry);
+
+    // parent = entt::null makes `child` a root. keepWorld recomputes the local transform so
+    // the child stays where it is. False (nothing changed) if it would create a cycle.
+    bool SetParent(entt::entity child, entt::entity parent, bool keepWorld = true);
+    entt::entity GetParent(entt::entity entity) const;
+
+    // Before an entity is destroyed: children become roots (keeping their world transform)
+    void Unlink(entt::entity entity);
+
+    // Rebuilds the arrays if links changed, then propagates dirty subtrees. workerCount 0 = all cores.
+    void Update(uint32_t workerCount = 0);
+
+    // World matrix as of the last Update(); identity without a TransformComponent
+    glm::mat4 GetWorldMatrix(entt::entity entity) const;
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    static constexpr uint32_t NoParent = UINT32_MAX;
+
+    // Per-node flags
+    static constexpr uint8_t LocalDirty = 1;     // Own TransformComponent changed
+    static constexpr uint8_t WorldChanged = 2;   // Recomputed this Update() - children must follow
+    static constexpr uint8_t HasTransform = 4;   // Persistent until the next rebuild
+
+    // Slots [Begin, End) of one level
+    struct Range
+    {
+        uint32_t Begin = 0;
+        uint32_t End = 0;
+    };
+
+    void OnTransformConstructed(entt::registry& registry, entt::entity entity);
+    void OnTransformUpdated(entt::registry& registry, entt::entity entity);
+
+    void Link(entt::entity child, entt::entity parent);
+    void RemoveFromParent(entt::entity child);
+    void DropIfUnlinked(entt::entity entity);
+
+    void Rebuild();
+    void MarkDirty(uint32_t slot);
+    void Propagate(uint32_t workerCount);
+
+    entt::registry* m_Registry = nullptr;
+    bool m_StructureDirty = false;
+    std::vector<entt::entity> m_FlatDirty;      // Unlinked entities whose TransformComponent changed
+
+    // Depth-sorted arrays, one entry per linked entity
+    std::vector<entt::entity> m_Entities;
+    std::vector<uint32_t> m_Parent;             // Slot of the parent, NoParent for roots
+    std::vector<uint32_t> m_ChildBegin;         // Children: [begin, end) in the next level
+    std::vector<uint32_t> m_ChildEnd;
+    std::vector<glm::mat4> m_World;
+    std::vector<uint8_t> m_Flags;
+    std::vector<uint32_t> m_LevelStart;         // Level -> first slot; one extra = node count
+
+    // Directly edited slots per level (unsorted), and the levels that have any
+    std::vector<std::vector<Range>> m_LevelDirty;
+    uint32_t m_MinDirtyLevel = UINT32_MAX;
+    uint32_t m_MaxDirtyLevel = 0;
+
+    // Propagation scratch, kept between frames
+    std::vector<Range> m_Ranges;                // Level being processed, sorted and merged
+    std::vector<Range> m_Inherited;             // Children of this level's recomputed nodes
+    std::vector<Range> m_Previous;              // Last level's ranges - flags cleared once read
+    std::vector<uint32_t> m_RangeOffsets;       // Dirty nodes before each of m_Ranges
+    std::vector<std::vector<Range>> m_WorkerChildren;
+    std::vector<uint32_t> m_WorkerUpdated;
+    std::unique_ptr<WorkerPool> m_Workers;
+
+    Stats m_Stats;
+};
@@ -0,0 +1,208 @@
+#include "Test.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Core/Resources/FileWatcher.hpp>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Generous bound on top of the debounce: the watcher thread wakes every 50 ms
+    // and CI machines stall, but a batch must never wait for a second debounce
+    constexpr double LATENCY_SLACK_MS = 400.0;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    void Sleep(int ms)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    }
+
+    // Fresh directory under the system temp dir, removed again on scope exit
+    struct TempDir
+    {
+        fs::path Path;
+
+        explicit TempDir(const char* name)
+        {
+            Path = fs::temp_directory_path() / (std::string("uicheck_") + name + "_" +
+                   std::to_string(Clock::now().time_since_epoch().count()));
+            fs::create_directories(Path);
+        }
+        ~TempDir()
+        {
+            std::error_code error;
+            fs::remove_all(Path, error);
+        }
+
+        std::string Root() const { return Path.generic_string(); }
+    };
+
+    void Append(const fs::path& path, const std::string& text)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::app);
+        file << text;
+    }
+
+    // Polls like the editor's frame loop (every 5 ms) until a batch arrives
+    std::vector<std::string> WaitForBatch(FileWatcher& watcher, double timeoutMs)
+    {
+        auto start = Clock::now();
+        while (ElapsedMs(start) < timeoutMs)
+        {
+            std::vector<std::string> batch = watcher.Poll();
+            if (!batch.empty()) return batch;
+            Sleep(5);
+        }
+        return {};
+    }
+
+    // Without inotify (or off Linux) the polling fallback runs these too - keep its interval short
+    FileWatcher::Settings MakeSettings(double debounceMs, double maxDelayMs)
+    {
+        FileWatcher::Settings settings;
+        settings.DebounceMs = debounceMs;
+        settings.MaxDelayMs = maxDelayMs;
+        settings.PollIntervalMs = 50.0;
+        return settings;
+    }
+
+    bool Contains(const std::vector<std::string>& paths, const std::string& path)
+    {
+        return std::find(paths.begin(), paths.end(), path) != paths.end();
+    }
+}
+
+TEST_CASE(ChunkedWritesArriveAsOneBatchAfterTheDebounce)
+{
+    TempDir dir("chunked");
+    FileWatcher::Settings settings = MakeSettings(150.0, 5000.0);
+
+    FileWatcher watcher;
+    REQUIRE(watcher.Start(dir.Root(), settings));
+
+    // An editor saving in pieces, plus a second file touched in between
+    Clock::time_point lastWrite;
+    for (int chunk = 0; chunk < 5; chunk++)
+    {
+        if (chunk > 0)
+        {
+            Sleep(30);
+            CHECK(watcher.Poll().empty()); // Still active: nothing is handed out mid-save
+        }
+        Append(dir.Path / "shader.glsl", "void main() {}\n");
+        if (chunk == 2) Append(dir.Path / "other.glsl", "// x\n");
+        lastWrite = Clock::now();
+    }
+
+    std::vector<std::string> batch = WaitForBatch(watcher, 3000.0);
+    double latency = ElapsedMs(lastWrite);
+
+    CHECK((batch == std::vector<std::string>{ "other.glsl", "shader.glsl" }));
+    CHECK(latency >= settings.DebounceMs * 0.9);
+    CHECK(latency <= settings.DebounceMs + LATENCY_SLACK_MS);
+
+    FileWatcher::Stats stats = watcher.GetStats();
+    CHECK(stats.Delivered == 2);
+    CHECK(stats.Coalesced > 0);
+
+    // Nothing more to deliver once the batch is out
+    Sleep(200);
+    CHECK(watcher.Poll().empty());
+}
+
+TEST_CASE(ConstantActivityIsDeliveredAfterMaxDelay)
+{
+    TempDir dir("busy");
+    FileWatcher::Settings settings = MakeSettings(100.0, 300.0);
+
+    FileWatcher watcher;
+    REQUIRE(watcher.Start(dir.Root(), settings));
+
+    // Writes every 20 ms never leave the tree quiet for a debounce
+    auto firstWrite = Clock::now();
+    std::vector<std::string> batch;
+    while (batch.empty() && ElapsedMs(firstWrite) < 3000.0)
+    {
+        Append(dir.Path / "log.txt", "line\n");
+        Sleep(20);
+        batch = watcher.Poll();
+    }
+    double latency = ElapsedMs(firstWrite);
+
+    CHECK((batch == std::vector<std::string>{ "log.txt" }));
+    CHECK(latency >= settings.MaxDelayMs * 0.9);
+    CHECK(latency <= settings.MaxDelayMs + LATENCY_SLACK_MS);
+}
+
+TEST_CASE(TempFileRenameAndNewDirectoriesAreSeen)
+{
+    TempDir dir("rename");
+    FileWatcher::Settings settings = MakeSettings(100.0, 1000.0);
+
+    FileWatcher watcher;
+    REQUIRE(watcher.Start(dir.Root(), settings));
+
+    // Save through a temp file: both names arrive in the same batch (polling only sees the result)
+    Append(dir.Path / "model.obj.tmp", "v 0 0 0\n");
+    fs::rename(dir.Path / "model.obj.tmp", dir.Path / "model.obj");
+    std::vector<std::string> batch = WaitForBatch(watcher, 3000.0);
+    CHECK(Contains(batch, "model.obj"));
+    if (watcher.GetBackend() == FileWatcher::Backend::Inotify)
+        CHECK(Contains(batch, "model.obj.tmp"));
+
+    // A directory created after Start is watched from then on; hidden entries never show up
+    fs::create_directories(dir.Path / "textures");
+    Sleep(150); // Let the watcher add the new directory before writing into it
+    WaitForBatch(watcher, 1000.0);
+
+    Append(dir.Path / "textures" / "wall.tga", "tga");
+    Append(dir.Path / ".cache", "ignored");
+    batch = WaitForBatch(watcher, 3000.0);
+    CHECK((batch == std::vector<std::string>{ "textures/wall.tga" }));
+}
+
+TEST_CASE(PollingBackendDeliversChanges)
+{
+    TempDir dir("polling");
+    Append(dir.Path / "existing.txt", "a");
+
+    FileWatcher::Settings settings;
+    settings.DebounceMs = 50.0;
+    settings.PollIntervalMs = 100.0;
+    settings.ForcePolling = true;
+
+    FileWatcher watcher;
+    REQUIRE(watcher.Start(dir.Root(), settings));
+    CHECK(watcher.GetBackend() == FileWatcher::Backend::Polling);
+
+    // Size changes are seen even where mtime is coarse
+    Append(dir.Path / "existing.txt", "bc");
+    Append(dir.Path / "new.txt", "d");
+    auto write = Clock::now();
+
+    std::vector<std::string> batch = WaitForBatch(watcher, 3000.0);
+    double latency = ElapsedMs(write);
+
+    CHECK((batch == std::vector<std::string>{ "existing.txt", "new.txt" }));
+    CHECK(latency <= settings.PollIntervalMs + settings.DebounceMs + LATENCY_SLACK_MS);
+
+    fs::remove(dir.Path / "new.txt");
+    batch = WaitForBatch(watcher, 3000.0);
+    CHECK((batch == std::vector<std::string>{ "new.txt" }));
+
+    watcher.Stop();
+    CHECK(!watcher.IsRunning());
+}
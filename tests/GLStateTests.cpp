@@ -0,0 +1,202 @@
+#include "Test.hpp"
+
+#include <glad/glad.h>
+#include <Rendering/GLState.hpp>
+
+// No context: glad's function pointers are pointed at counters, so every
+// call GLState forwards is seen and nothing reaches a driver.
+namespace
+{
+    struct Calls
+    {
+        int UseProgram = 0;
+        int BindVertexArray = 0;
+        int BindFramebuffer = 0;
+        int BindBuffer = 0;
+        int BindBufferRange = 0;
+        int Viewport = 0;
+        int GetIntegerv = 0;
+        int Enable = 0;
+        int Disable = 0;
+        int PolygonMode = 0;
+        int LineWidth = 0;
+    };
+
+    Calls s_Calls;
+
+    void APIENTRY FakeUseProgram(GLuint) { s_Calls.UseProgram++; }
+    void APIENTRY FakeBindVertexArray(GLuint) { s_Calls.BindVertexArray++; }
+    void APIENTRY FakeBindFramebuffer(GLenum, GLuint) { s_Calls.BindFramebuffer++; }
+    void APIENTRY FakeBindBuffer(GLenum, GLuint) { s_Calls.BindBuffer++; }
+    void APIENTRY FakeBindBufferRange(GLenum, GLuint, GLuint, GLintptr, GLsizeiptr) { s_Calls.BindBufferRange++; }
+    void APIENTRY FakeViewport(GLint, GLint, GLsizei, GLsizei) { s_Calls.Viewport++; }
+    void APIENTRY FakeEnable(GLenum) { s_Calls.Enable++; }
+    void APIENTRY FakeDisable(GLenum) { s_Calls.Disable++; }
+    void APIENTRY FakePolygonMode(GLenum, GLenum) { s_Calls.PolygonMode++; }
+    void APIENTRY FakeLineWidth(GLfloat) { s_Calls.LineWidth++; }
+    GLenum APIENTRY FakeGetError() { return GL_NO_ERROR; }
+
+    void APIENTRY FakeGetIntegerv(GLenum, GLint* data)
+    {
+        s_Calls.GetIntegerv++;
+        data[0] = 0; data[1] = 0; data[2] = 640; data[3] = 480;
+    }
+
+    // Fresh counters and an empty cache, as after context creation
+    void Reset()
+    {
+        glad_glUseProgram = FakeUseProgram;
+        glad_glBindVertexArray = FakeBindVertexArray;
+        glad_glBindFramebuffer = FakeBindFramebuffer;
+        glad_glBindBuffer = FakeBindBuffer;
+        glad_glBindBufferRange = FakeBindBufferRange;
+        glad_glViewport = FakeViewport;
+        glad_glGetIntegerv = FakeGetIntegerv;
+        glad_glEnable = FakeEnable;
+        glad_glDisable = FakeDisable;
+        glad_glPolygonMode = FakePolygonMode;
+        glad_glLineWidth = FakeLineWidth;
+        glad_glGetError = FakeGetError;
+
+        s_Calls = {};
+        GLState::Invalidate();
+        GLState::ResetStats();
+    }
+}
+
+TEST_CASE(RepeatedBindsReachGLOnce)
+{
+    Reset();
+
+    // A frame's worth of draws sharing one shader, mesh and target
+    for (int draw = 0; draw < 10; draw++)
+    {
+        GLState::BindFramebuffer(2);
+        GLState::UseProgram(5);
+        GLState::BindVertexArray(7);
+    }
+    CHECK(s_Calls.BindFramebuffer == 1);
+    CHECK(s_Calls.UseProgram == 1);
+    CHECK(s_Calls.BindVertexArray == 1);
+    CHECK(GLState::GetStats().Issued == 3);
+    CHECK(GLState::GetStats().Redundant == 27);
+
+    CHECK(GLState::UseProgram(6));
+    CHECK(!GLState::UseProgram(6));
+    CHECK(s_Calls.UseProgram == 2);
+}
+
+TEST_CASE(BufferTargetsAreCachedSeparately)
+{
+    Reset();
+
+    CHECK(GLState::BindBuffer(GL_ARRAY_BUFFER, 3));
+    CHECK(GLState::BindBuffer(GL_UNIFORM_BUFFER, 3));
+    CHECK(GLState::BindBuffer(GL_DRAW_INDIRECT_BUFFER, 3));
+    CHECK(!GLState::BindBuffer(GL_ARRAY_BUFFER, 3));
+    CHECK(!GLState::BindBuffer(GL_DRAW_INDIRECT_BUFFER, 3));
+    CHECK(s_Calls.BindBuffer == 3);
+
+    // Element arrays are VAO state: never skipped
+    CHECK(GLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 4));
+    CHECK(GLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 4));
+    CHECK(s_Calls.BindBuffer == 5);
+}
+
+TEST_CASE(UniformRangesAreNeverSkipped)
+{
+    Reset();
+
+    GLState::BindUniformBufferRange(0, 9, 0, 256);
+    GLState::BindUniformBufferRange(0, 9, 0, 256);
+    CHECK(s_Calls.BindBufferRange == 2);
+
+    // ...and leave buffer 9 on the generic binding point
+    CHECK(!GLState::BindBuffer(GL_UNIFORM_BUFFER, 9));
+    CHECK(s_Calls.BindBuffer == 0);
+}
+
+TEST_CASE(RenderStateChangesOnlyOnDifference)
+{
+    Reset();
+
+    GLState::SetDepthTest(true);
+    GLState::SetDepthTest(true);
+    GLState::SetDepthTest(false);
+    CHECK(s_Calls.Enable == 1);
+    CHECK(s_Calls.Disable == 1);
+
+    GLState::SetWireframe(false);
+    GLState::SetWireframe(false);
+    GLState::SetLineWidth(2.0f);
+    GLState::SetLineWidth(2.0f);
+    CHECK(s_Calls.PolygonMode == 1);
+    CHECK(s_Calls.LineWidth == 1);
+
+    GLState::SetViewport(0, 0, 800, 600);
+    GLState::SetViewport(0, 0, 800, 600);
+    CHECK(s_Calls.Viewport == 1);
+
+    // A known viewport is answered from the cache
+    int viewport[4];
+    GLState::GetViewport(viewport);
+    CHECK(viewport[2] == 800 && viewport[3] == 600);
+    CHECK(s_Calls.GetIntegerv == 0);
+}
+
+TEST_CASE(InvalidateRelearnsEverything)
+{
+    Reset();
+
+    GLState::UseProgram(5);
+    GLState::BindVertexArray(7);
+    GLState::SetDepthTest(true);
+    GLState::SetViewport(0, 0, 800, 600);
+
+    // Someone else (the ImGui backend) touched the context
+    GLState::Invalidate();
+
+    GLState::UseProgram(5);
+    GLState::BindVertexArray(7);
+    GLState::SetDepthTest(true);
+    CHECK(s_Calls.UseProgram == 2);
+    CHECK(s_Calls.BindVertexArray == 2);
+    CHECK(s_Calls.Enable == 2);
+
+    int viewport[4];
+    GLState::GetViewport(viewport);
+    GLState::GetViewport(viewport);
+    CHECK(s_Calls.GetIntegerv == 1);
+    CHECK(viewport[2] == 640 && viewport[3] == 480);
+}
+
+TEST_CASE(DeletedObjectsFallBackToZero)
+{
+    Reset();
+
+    // GL unbinds a deleted VAO / framebuffer / buffer: 0 is what is bound now
+    GLState::BindVertexArray(7);
+    GLState::OnVertexArrayDeleted(7);
+    CHECK(!GLState::BindVertexArray(0));
+    CHECK(GLState::BindVertexArray(7)); // The name may come back for a new object
+
+    GLState::BindFramebuffer(2);
+    GLState::OnFramebufferDeleted(2);
+    CHECK(!GLState::BindFramebuffer(0));
+
+    GLState::BindBuffer(GL_ARRAY_BUFFER, 3);
+    GLState::BindBuffer(GL_UNIFORM_BUFFER, 3);
+    GLState::OnBufferDeleted(3);
+    CHECK(!GLState::BindBuffer(GL_ARRAY_BUFFER, 0));
+    CHECK(GLState::BindBuffer(GL_UNIFORM_BUFFER, 3));
+
+    // A deleted program stays current until replaced, so the next use must reach GL
+    GLState::UseProgram(5);
+    GLState::OnProgramDeleted(5);
+    CHECK(GLState::UseProgram(5));
+
+    // Deleting something that is not bound changes nothing
+    GLState::BindVertexArray(8);
+    GLState::OnVertexArrayDeleted(9);
+    CHECK(!GLState::BindVertexArray(8));
+}
@@ -0,0 +1,234 @@
+#include "Test.hpp"
+
+#include <cmath>
+#include <vector>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <Rendering/LODSelector.hpp>
+#include <Rendering/Mesh/Mesh.hpp>
+#include <Rendering/Mesh/MeshSimplifier.hpp>
+
+namespace
+{
+    // Unit sphere, rings x segments quads with a seam column of duplicated positions
+    void MakeSphere(uint32_t rings, uint32_t segments, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices)
+    {
+        const float pi = 3.14159265f;
+        for (uint32_t r = 0; r <= rings; r++)
+        {
+            float phi = pi * (float)r / rings;
+            for (uint32_t s = 0; s <= segments; s++)
+            {
+                float theta = 2.0f * pi * (float)s / segments;
+                glm::vec3 p(std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta));
+                vertices.push_back({ p, p });
+            }
+        }
+
+        for (uint32_t r = 0; r < rings; r++)
+        {
+            for (uint32_t s = 0; s < segments; s++)
+            {
+                uint32_t i = r * (segments + 1) + s;
+                uint32_t below = i + segments + 1;
+                if (r > 0) indices.insert(indices.end(), { i, i + 1, below });
+                if (r + 1 < rings) indices.insert(indices.end(), { i + 1, below + 1, below });
+            }
+        }
+    }
+
+    // Flat size x size grid in XZ, normals up
+    void MakePlane(uint32_t size, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices)
+    {
+        for (uint32_t z = 0; z <= size; z++)
+            for (uint32_t x = 0; x <= size; x++)
+                vertices.push_back({ glm::vec3((float)x / size, 0.0f, (float)z / size), glm::vec3(0.0f, 1.0f, 0.0f) });
+
+        for (uint32_t z = 0; z < size; z++)
+        {
+            for (uint32_t x = 0; x < size; x++)
+            {
+                uint32_t i = z * (size + 1) + x;
+                indices.insert(indices.end(), { i, i + size + 1, i + 1, i + 1, i + size + 1, i + size + 2 });
+            }
+        }
+    }
+
+    // Largest distance of any referenced vertex from the unit sphere's surface
+    float SphereDeviation(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices)
+    {
+        float worst = 0.0f;
+        for (uint32_t index : indices)
+            worst = std::max(worst, std::abs(glm::length(vertices[index].Position) - 1.0f));
+        return worst;
+    }
+
+    bool IndicesValid(const std::vector<uint32_t>& indices, size_t vertexCount)
+    {
+        if (indices.size() % 3 != 0) return false;
+        for (size_t t = 0; t < indices.size(); t += 3)
+        {
+            uint32_t a = indices[t], b = indices[t + 1], c = indices[t + 2];
+            if (a >= vertexCount || b >= vertexCount || c >= vertexCount) return false;
+            if (a == b || b == c || a == c) return false; // Collapsed triangles are removed
+        }
+        return true;
+    }
+
+    glm::mat4 Perspective() { return glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f); }
+}
+
+// ============================================================================
+// Simplifier
+// ============================================================================
+TEST_CASE(SimplifyReachesTheTargetOnASphere)
+{
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    MakeSphere(32, 64, vertices, indices);
+
+    const uint32_t target = (uint32_t)indices.size() / 4 / 3 * 3;
+    MeshSimplifier::Result result = MeshSimplifier::Simplify(vertices, indices, target);
+
+    CHECK(IndicesValid(result.Indices, vertices.size()));
+    CHECK(result.Indices.size() <= target + target / 10);
+    CHECK(result.Indices.size() >= target / 2);
+
+    // Vertices are reused, never moved: every corner still lies on the sphere.
+    // The reported error bounds how far the surface moved.
+    CHECK(SphereDeviation(vertices, result.Indices) < 1e-5f);
+    CHECK(result.Error > 0.0f);
+    CHECK(result.Error < 0.1f);
+}
+
+TEST_CASE(SimplifyCollapsesAFlatPlaneWithoutError)
+{
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    MakePlane(16, vertices, indices);
+
+    MeshSimplifier::Result result = MeshSimplifier::Simplify(vertices, indices, 6);
+    CHECK(IndicesValid(result.Indices, vertices.size()));
+    CHECK(result.Indices.size() < indices.size() / 4);
+    CHECK(result.Error < 1e-4f);
+
+    // Border quadrics keep the outline: the four corners survive and the area stays 1
+    float area = 0.0f;
+    for (size_t t = 0; t < result.Indices.size(); t += 3)
+    {
+        const glm::vec3& a = vertices[result.Indices[t]].Position;
+        const glm::vec3& b = vertices[result.Indices[t + 1]].Position;
+        const glm::vec3& c = vertices[result.Indices[t + 2]].Position;
+        glm::vec3 n = glm::cross(b - a, c - a);
+        CHECK(n.y > 0.0f); // No flipped triangles
+        area += 0.5f * glm::length(n);
+    }
+    CHECK(std::abs(area - 1.0f) < 1e-4f);
+}
+
+TEST_CASE(ChainHalvesAndAccumulatesError)
+{
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    MakeSphere(32, 64, vertices, indices);
+
+    std::vector<MeshSimplifier::Result> chain = MeshSimplifier::BuildChain(vertices, indices, 4);
+    REQUIRE(chain.size() >= 3);
+
+    size_t previousCount = indices.size();
+    float previousError = 0.0f;
+    for (const MeshSimplifier::Result& level : chain)
+    {
+        CHECK(IndicesValid(level.Indices, vertices.size()));
+        CHECK(level.Indices.size() < previousCount * 9 / 10);   // Every kept level removes at least 10%
+        CHECK(level.Indices.size() >= previousCount / 4);       // ...and aims at half
+        CHECK(level.Error >= previousError);
+        previousCount = level.Indices.size();
+        previousError = level.Error;
+    }
+}
+
+// ============================================================================
+// LOD selection
+// ============================================================================
+TEST_CASE(ScreenSpaceErrorFollowsProjection)
+{
+    LODSelector selector;
+    selector.SetCamera(glm::vec3(0.0f), Perspective(), 1080.0f);
+
+    // 60 degree vertical fov: a unit at distance 1 spans 540 / tan(30) pixels
+    const float pixelsPerUnit = 540.0f / std::tan(glm::radians(30.0f));
+    CHECK(std::abs(selector.GetScreenSpaceError(1.0f, 1.0f) - pixelsPerUnit) < 0.01f);
+    CHECK(std::abs(selector.GetScreenSpaceError(0.01f, 10.0f) - pixelsPerUnit * 0.001f) < 1e-4f);
+}
+
+TEST_CASE(FartherObjectsGetCoarserLevels)
+{
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    MakeSphere(32, 64, vertices, indices);
+    std::vector<MeshSimplifier::Result> chain = MeshSimplifier::BuildChain(vertices, indices, 4);
+    REQUIRE(!chain.empty());
+
+    std::vector<float> errors = { 0.0f };
+    for (const MeshSimplifier::Result& level : chain) errors.push_back(level.Error);
+    auto getError = [&](uint32_t level) { return errors[level]; };
+    const uint32_t count = (uint32_t)errors.size();
+    const glm::vec3 minAABB(-1.0f), maxAABB(1.0f);
+
+    LODSelector selector;
+    selector.SetCamera(glm::vec3(0.0f), Perspective(), 1080.0f);
+
+    // Inside the bounding sphere: always full detail
+    CHECK(selector.Select(count, getError, minAABB, maxAABB, glm::mat4(1.0f), count - 1) == 0);
+
+    // Walking away never picks a finer level, and ends at the coarsest
+    uint32_t level = 0, previous = 0;
+    for (float distance = 2.0f; distance < 2000.0f; distance *= 1.25f)
+    {
+        glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -distance));
+        level = selector.Select(count, getError, minAABB, maxAABB, model, level);
+        CHECK(level >= previous);
+        previous = level;
+    }
+    CHECK(level == count - 1);
+
+    // The chosen level's error is under the threshold where it is used
+    glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -50.0f));
+    uint32_t chosen = selector.Select(count, getError, minAABB, maxAABB, model, 0);
+    float distance = 50.0f - std::sqrt(3.0f);
+    CHECK(selector.GetScreenSpaceError(errors[chosen], distance) <= selector.ThresholdPixels);
+
+    // Scaling the object up makes its error bigger on screen: never coarser
+    glm::mat4 scaled = glm::scale(model, glm::vec3(4.0f));
+    CHECK(selector.Select(count, getError, minAABB, maxAABB, scaled, 0) <= chosen);
+}
+
+TEST_CASE(HysteresisHoldsLevelsNearTheSwitchDistance)
+{
+    const float errors[] = { 0.0f, 0.01f };
+    auto getError = [&](uint32_t level) { return errors[level]; };
+    const glm::vec3 minAABB(-0.001f), maxAABB(0.001f);
+
+    LODSelector selector;
+    selector.SetCamera(glm::vec3(0.0f), Perspective(), 1080.0f);
+
+    // Level 1 is exactly 1 pixel here
+    const float switchDistance = selector.GetScreenSpaceError(0.01f, 1.0f) / selector.ThresholdPixels;
+    auto at = [&](float distance)
+    {
+        return glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -(distance + glm::length(maxAABB))));
+    };
+
+    // Just past the switch distance: level 1 is good enough but not by the margin
+    CHECK(selector.Select(2, getError, minAABB, maxAABB, at(switchDistance * 1.1f), 0) == 0);
+    CHECK(selector.Select(2, getError, minAABB, maxAABB, at(switchDistance * 1.1f), 1) == 1);
+
+    // Well past it: coarsen. Inside it: refine, whatever the current level.
+    CHECK(selector.Select(2, getError, minAABB, maxAABB, at(switchDistance * 1.5f), 0) == 1);
+    CHECK(selector.Select(2, getError, minAABB, maxAABB, at(switchDistance * 0.9f), 1) == 0);
+
+    selector.Hysteresis = 0.0f;
+    CHECK(selector.Select(2, getError, minAABB, maxAABB, at(switchDistance * 1.1f), 0) == 1);
+}
@@ -0,0 +1,177 @@
+#include "Test.hpp"
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#include <Rendering/Mesh/Mesh.hpp>
+#include <Rendering/Mesh/MeshOptimizer.hpp>
+
+namespace
+{
+    // size x size quads in the XY plane, rows of triangles in scan order
+    void MakeGrid(uint32_t size, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices)
+    {
+        vertices.clear();
+        indices.clear();
+        for (uint32_t y = 0; y <= size; y++)
+            for (uint32_t x = 0; x <= size; x++)
+                vertices.push_back({ glm::vec3((float)x, (float)y, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f) });
+
+        for (uint32_t y = 0; y < size; y++)
+        {
+            for (uint32_t x = 0; x < size; x++)
+            {
+                uint32_t i = y * (size + 1) + x;
+                indices.insert(indices.end(), { i, i + 1, i + size + 2, i, i + size + 2, i + size + 1 });
+            }
+        }
+    }
+
+    // Triangles as a sorted list, each rotated to start at its smallest index (winding kept)
+    std::vector<std::array<uint32_t, 3>> Triangles(const std::vector<uint32_t>& indices)
+    {
+        std::vector<std::array<uint32_t, 3>> triangles;
+        for (size_t t = 0; t + 2 < indices.size(); t += 3)
+        {
+            std::array<uint32_t, 3> tri = { indices[t], indices[t + 1], indices[t + 2] };
+            std::rotate(tri.begin(), std::min_element(tri.begin(), tri.end()), tri.end());
+            triangles.push_back(tri);
+        }
+        std::sort(triangles.begin(), triangles.end());
+        return triangles;
+    }
+
+    void ShuffleTriangles(std::vector<uint32_t>& indices, uint32_t seed)
+    {
+        std::vector<std::array<uint32_t, 3>> triangles;
+        for (size_t t = 0; t < indices.size(); t += 3)
+            triangles.push_back({ indices[t], indices[t + 1], indices[t + 2] });
+        std::shuffle(triangles.begin(), triangles.end(), std::mt19937(seed));
+        indices.clear();
+        for (const auto& tri : triangles)
+            indices.insert(indices.end(), tri.begin(), tri.end());
+    }
+}
+
+TEST_CASE(AnalyzeCountsFifoMisses)
+{
+    // One triangle: three transforms for one triangle, each vertex once
+    MeshOptimizer::CacheStats single = MeshOptimizer::AnalyzeVertexCache({ 0, 1, 2 }, 3);
+    CHECK(single.ACMR == 3.0f);
+    CHECK(single.ATVR == 1.0f);
+
+    // A quad shares an edge: 4 transforms for 2 triangles
+    MeshOptimizer::CacheStats quad = MeshOptimizer::AnalyzeVertexCache({ 0, 1, 2, 0, 2, 3 }, 4);
+    CHECK(quad.ACMR == 2.0f);
+    CHECK(quad.ATVR == 1.0f);
+
+    // With a 3-entry FIFO, vertex 0 is evicted before it is used again
+    MeshOptimizer::CacheStats evicted = MeshOptimizer::AnalyzeVertexCache({ 0, 1, 2, 3, 4, 5, 0, 1, 2 }, 6, 3);
+    CHECK(evicted.ACMR == 3.0f);
+    CHECK(evicted.ATVR == 1.5f);
+}
+
+TEST_CASE(TipsifyKeepsEveryTriangle)
+{
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    MakeGrid(32, vertices, indices);
+    ShuffleTriangles(indices, 3);
+
+    std::vector<std::array<uint32_t, 3>> before = Triangles(indices);
+    std::vector<uint32_t> clusters = MeshOptimizer::OptimizeVertexCache(indices, (uint32_t)vertices.size());
+
+    CHECK(Triangles(indices) == before);
+    REQUIRE(!clusters.empty());
+    CHECK(clusters[0] == 0);
+    CHECK(std::is_sorted(clusters.begin(), clusters.end()));
+    CHECK(std::adjacent_find(clusters.begin(), clusters.end()) == clusters.end());
+    CHECK(clusters.back() < indices.size() / 3);
+}
+
+TEST_CASE(TipsifyLowersACMROnAShuffledGrid)
+{
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    MakeGrid(64, vertices, indices);
+    ShuffleTriangles(indices, 5);
+
+    const uint32_t vertexCount = (uint32_t)vertices.size();
+    MeshOptimizer::CacheStats before = MeshOptimizer::AnalyzeVertexCache(indices, vertexCount);
+    MeshOptimizer::OptimizeVertexCache(indices, vertexCount);
+    MeshOptimizer::CacheStats after = MeshOptimizer::AnalyzeVertexCache(indices, vertexCount);
+
+    // A shuffled grid misses nearly every vertex; the ideal for a grid is 0.5
+    CHECK(before.ACMR > 2.0f);
+    CHECK(after.ACMR < 0.8f);
+    CHECK(after.ATVR < 1.5f);
+
+    // Already ordered input must not get worse
+    MakeGrid(64, vertices, indices);
+    MeshOptimizer::CacheStats scan = MeshOptimizer::AnalyzeVertexCache(indices, vertexCount);
+    MeshOptimizer::OptimizeVertexCache(indices, vertexCount);
+    CHECK(MeshOptimizer::AnalyzeVertexCache(indices, vertexCount).ACMR <= scan.ACMR);
+}
+
+TEST_CASE(OverdrawMovesWholeClusters)
+{
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    MakeGrid(32, vertices, indices);
+    ShuffleTriangles(indices, 9);
+
+    std::vector<uint32_t> clusters = MeshOptimizer::OptimizeVertexCache(indices, (uint32_t)vertices.size());
+    std::vector<std::array<uint32_t, 3>> before = Triangles(indices);
+
+    // Each cluster's triangles, in order, must appear as one run in the output
+    const uint32_t triangleCount = (uint32_t)indices.size() / 3;
+    std::vector<std::vector<uint32_t>> runs;
+    for (size_t c = 0; c < clusters.size(); c++)
+    {
+        uint32_t end = c + 1 < clusters.size() ? clusters[c + 1] : triangleCount;
+        runs.emplace_back(indices.begin() + clusters[c] * 3, indices.begin() + end * 3);
+    }
+
+    MeshOptimizer::OptimizeOverdraw(indices, vertices, clusters);
+    CHECK(Triangles(indices) == before);
+
+    for (const std::vector<uint32_t>& run : runs)
+        CHECK(std::search(indices.begin(), indices.end(), run.begin(), run.end()) != indices.end());
+}
+
+TEST_CASE(VertexFetchRenumbersInFirstUseOrder)
+{
+    std::vector<Vertex> vertices;
+    for (int i = 0; i < 6; i++)
+        vertices.push_back({ glm::vec3((float)i, 0.0f, 0.0f), glm::vec3(0.0f) });
+
+    // Vertex 1 is never referenced
+    std::vector<uint32_t> indices = { 5, 3, 0, 0, 3, 4, 2, 5, 4 };
+    std::vector<uint32_t> original = indices;
+    std::vector<Vertex> originalVertices = vertices;
+
+    MeshOptimizer::OptimizeVertexFetch(vertices, indices);
+
+    CHECK(vertices.size() == 5);
+    CHECK((indices == std::vector<uint32_t>{ 0, 1, 2, 2, 1, 3, 4, 0, 3 }));
+    for (size_t i = 0; i < indices.size(); i++)
+        CHECK(vertices[indices[i]].Position == originalVertices[original[i]].Position);
+}
+
+TEST_CASE(OptimizeReportsBeforeAndAfter)
+{
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    MakeGrid(48, vertices, indices);
+    ShuffleTriangles(indices, 11);
+    const size_t indexCount = indices.size();
+
+    MeshOptimizer::Report report = MeshOptimizer::Optimize(vertices, indices);
+
+    CHECK(indices.size() == indexCount);
+    CHECK(report.Clusters > 0);
+    CHECK(report.After.ACMR < report.Before.ACMR);
+    CHECK(report.After.ACMR == MeshOptimizer::AnalyzeVertexCache(indices, (uint32_t)vertices.size()).ACMR);
+}
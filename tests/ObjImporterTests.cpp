@@ -0,0 +1,187 @@
+#include "Test.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <Rendering/Mesh/Mesh.hpp>
+#include <Rendering/Mesh/ObjImporter.hpp>
+
+namespace
+{
+    struct Parsed
+    {
+        std::vector<Vertex> Vertices;
+        std::vector<uint32_t> Indices;
+        ObjImporter::Stats Stats;
+        bool Ok = false;
+    };
+
+    Parsed ParseObj(const std::string& text, uint32_t workers = 1)
+    {
+        Parsed parsed;
+        parsed.Ok = ObjImporter::Parse(text.data(), text.size(), parsed.Vertices, parsed.Indices, &parsed.Stats, workers);
+        return parsed;
+    }
+
+    bool Near(const glm::vec3& a, const glm::vec3& b)
+    {
+        return std::abs(a.x - b.x) < 1e-5f && std::abs(a.y - b.y) < 1e-5f && std::abs(a.z - b.z) < 1e-5f;
+    }
+
+    bool SameMesh(const Parsed& a, const Parsed& b)
+    {
+        if (a.Vertices.size() != b.Vertices.size() || a.Indices != b.Indices) return false;
+        for (size_t i = 0; i < a.Vertices.size(); i++)
+        {
+            if (a.Vertices[i].Position != b.Vertices[i].Position || a.Vertices[i].Normal != b.Vertices[i].Normal)
+                return false;
+        }
+        return true;
+    }
+
+    // Blocks of 4 positions + 4 normals, each followed by a quad over the block and a triangle
+    // reaching 8 elements back into the previous block. Big enough for two 1 MB chunks, so the
+    // first face after the cut always refers to elements parsed by the other worker.
+    std::string MakeBlocks(bool relative)
+    {
+        constexpr uint32_t BLOCKS = 16000;
+
+        std::string obj;
+        char line[128];
+        for (uint32_t block = 0; block < BLOCKS; block++)
+        {
+            for (uint32_t k = 0; k < 4; k++)
+            {
+                uint32_t n = block * 4 + k;
+                std::snprintf(line, sizeof(line), "v %u.25 %u 0.5\nvn 0 %d 1\n", n, n % 7, (int)(n % 3) - 1);
+                obj += line;
+            }
+
+            uint32_t last = block * 4 + 4; // 1-based index of the block's last element
+            if (relative)
+                obj += "f -4//-4 -3//-3 -2//-2 -1//-1\n";
+            else
+            {
+                std::snprintf(line, sizeof(line), "f %u//%u %u//%u %u//%u %u//%u\n",
+                              last - 3, last - 3, last - 2, last - 2, last - 1, last - 1, last, last);
+                obj += line;
+            }
+
+            if (block == 0) continue;
+            if (relative)
+                obj += "f -8//-8 -4//-4 -1//-1\n";
+            else
+            {
+                std::snprintf(line, sizeof(line), "f %u//%u %u//%u %u//%u\n", last - 7, last - 7, last - 3, last - 3, last, last);
+                obj += line;
+            }
+        }
+        return obj;
+    }
+}
+
+TEST_CASE(ParsesTriangleWithSmoothNormals)
+{
+    Parsed parsed = ParseObj("v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\n");
+    REQUIRE(parsed.Ok);
+    REQUIRE(parsed.Vertices.size() == 3);
+    CHECK((parsed.Indices == std::vector<uint32_t>{ 0, 1, 2 }));
+    CHECK(parsed.Vertices[1].Position == glm::vec3(1.0f, 0.0f, 0.0f));
+
+    // No "vn": counter-clockwise in XY faces +Z
+    for (const Vertex& vertex : parsed.Vertices)
+        CHECK(Near(vertex.Normal, glm::vec3(0.0f, 0.0f, 1.0f)));
+}
+
+TEST_CASE(FanTriangulatesPolygons)
+{
+    Parsed parsed = ParseObj("v 0 0 0\nv 2 0 0\nv 3 1 0\nv 1 2 0\nv -1 1 0\nf 1 2 3 4 5\n");
+    REQUIRE(parsed.Ok);
+    CHECK(parsed.Stats.Triangles == 3);
+    CHECK((parsed.Indices == std::vector<uint32_t>{ 0, 1, 2, 0, 2, 3, 0, 3, 4 }));
+}
+
+TEST_CASE(ParsesNumberForms)
+{
+    Parsed parsed = ParseObj("v -1.5 +2.25e1 3E-2\nv .5 0 0\nv 0 1. 0\nf 1 2 3\n");
+    REQUIRE(parsed.Ok);
+    CHECK(Near(parsed.Vertices[0].Position, glm::vec3(-1.5f, 22.5f, 0.03f)));
+    CHECK(Near(parsed.Vertices[1].Position, glm::vec3(0.5f, 0.0f, 0.0f)));
+    CHECK(Near(parsed.Vertices[2].Position, glm::vec3(0.0f, 1.0f, 0.0f)));
+}
+
+TEST_CASE(WeldsPositionNormalPairs)
+{
+    // v//vn and v/vt/vn; the same positions with the other normal are separate vertices
+    const char* obj =
+        "v 0 0 0\nv 1 0 0\nv 0 1 0\n"
+        "vt 0 0\nvt 1 0\n"
+        "vn 0 0 1\nvn 0 0 -1\n"
+        "f 1//1 2//1 3//1\n"
+        "f 1/1/2 3/2/2 2/1/2\n"
+        "f 3/2/1 2/2/1 1/1/1\n";
+
+    Parsed parsed = ParseObj(obj);
+    REQUIRE(parsed.Ok);
+    REQUIRE(parsed.Vertices.size() == 6);
+    CHECK((parsed.Indices == std::vector<uint32_t>{ 0, 1, 2, 3, 4, 5, 2, 1, 0 }));
+
+    CHECK(parsed.Vertices[0].Normal == glm::vec3(0.0f, 0.0f, 1.0f));
+    CHECK(parsed.Vertices[3].Normal == glm::vec3(0.0f, 0.0f, -1.0f));
+    CHECK(parsed.Vertices[3].Position == parsed.Vertices[0].Position);
+    CHECK(parsed.Vertices[4].Position == parsed.Vertices[2].Position);
+}
+
+TEST_CASE(RelativeIndicesMatchAbsolute)
+{
+    Parsed absolute = ParseObj("v 0 0 0\nv 1 0 0\nv 1 1 0\nvn 0 0 1\nf 1//1 2//1 3//1\nv 0 1 0\nf 1 3 4\n");
+    Parsed relative = ParseObj("v 0 0 0\nv 1 0 0\nv 1 1 0\nvn 0 0 1\nf -3//-1 -2//-1 -1//-1\nv 0 1 0\nf -4 -2 -1\n");
+    REQUIRE(absolute.Ok);
+    REQUIRE(relative.Ok);
+    CHECK(SameMesh(absolute, relative));
+}
+
+TEST_CASE(RelativeIndicesAcrossChunks)
+{
+    std::string relativeObj = MakeBlocks(true);
+    std::string absoluteObj = MakeBlocks(false);
+    REQUIRE(relativeObj.size() >= 2u << 20);
+
+    Parsed reference = ParseObj(absoluteObj, 1);
+    Parsed split = ParseObj(relativeObj, 2);
+    REQUIRE(reference.Ok);
+    REQUIRE(split.Ok);
+    CHECK(split.Stats.Threads == 2);
+    CHECK(reference.Stats.Triangles == 16000 * 2 + 15999);
+    CHECK(SameMesh(reference, split));
+
+    // Absolute indices split the same way
+    CHECK(SameMesh(reference, ParseObj(absoluteObj, 2)));
+}
+
+TEST_CASE(SkipsMalformedFaces)
+{
+    const char* obj =
+        "v 0 0 0\nv 1 0 0\nv 0 1 0\n"
+        "f 1 2\n"           // Too few corners
+        "f 1 0 2\n"         // Index 0 does not exist
+        "f 1 2 9\n"         // Past the last position
+        "f -1 -2 -9\n"      // Relative, before the first position
+        "f 1 x 2\n"         // Not a number
+        "f 1 2 3 # ok\n"
+        "# f 3 2 1\n";
+
+    Parsed parsed = ParseObj(obj);
+    REQUIRE(parsed.Ok);
+    CHECK(parsed.Stats.Triangles == 1);
+    CHECK((parsed.Indices == std::vector<uint32_t>{ 0, 1, 2 }));
+}
+
+TEST_CASE(FailsWithoutFaces)
+{
+    CHECK(!ParseObj("").Ok);
+    CHECK(!ParseObj("v 0 0 0\nv 1 0 0\nv 0 1 0\n").Ok);
+    CHECK(!ParseObj("v 0 0 0\nf 1 2 3\n").Ok);
+}
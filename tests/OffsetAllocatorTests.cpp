@@ -0,0 +1,151 @@
+#include "Test.hpp"
+
+#include <random>
+#include <vector>
+
+#include <Core/OffsetAllocator.hpp>
+
+TEST_CASE(AllocatesFromTheFront)
+{
+    OffsetAllocator allocator(100);
+    CHECK(allocator.Allocate(10) == 0);
+    CHECK(allocator.Allocate(20) == 10);
+    CHECK(allocator.Allocate(70) == 30);
+    CHECK(allocator.GetUsed() == 100);
+
+    CHECK(allocator.Allocate(1) == OffsetAllocator::InvalidOffset);
+    CHECK(allocator.Allocate(0) == OffsetAllocator::InvalidOffset);
+    CHECK(allocator.GetStats().FreeBlocks == 0);
+}
+
+TEST_CASE(PicksTheSmallestBlockThatFits)
+{
+    OffsetAllocator allocator(100);
+    uint32_t a = allocator.Allocate(30);    // [0, 30)
+    uint32_t b = allocator.Allocate(10);    // [30, 40)
+    uint32_t c = allocator.Allocate(10);    // [40, 50)
+    uint32_t d = allocator.Allocate(10);    // [50, 60), [60, 100) stays free
+    (void)b; (void)d;
+
+    allocator.Free(a, 30);
+    allocator.Free(c, 10);
+    REQUIRE(allocator.GetStats().FreeBlocks == 3);
+
+    // Holes of 30, 10 and 40: an 8 goes in the 10, a 25 in the 30
+    CHECK(allocator.Allocate(8) == 40);
+    CHECK(allocator.Allocate(25) == 0);
+    CHECK(allocator.Allocate(40) == 60);
+    CHECK(allocator.Allocate(6) == OffsetAllocator::InvalidOffset); // 5 + 2 left, not adjacent
+}
+
+TEST_CASE(FreedNeighboursCoalesce)
+{
+    OffsetAllocator allocator(60);
+    uint32_t a = allocator.Allocate(20);
+    uint32_t b = allocator.Allocate(20);
+    uint32_t c = allocator.Allocate(20);
+
+    // Middle last, so it merges with both sides at once
+    allocator.Free(a, 20);
+    allocator.Free(c, 20);
+    CHECK(allocator.GetStats().FreeBlocks == 2);
+    CHECK(allocator.GetStats().LargestFreeBlock == 20);
+    CHECK(allocator.GetStats().GetFragmentation() > 0.0f);
+
+    allocator.Free(b, 20);
+    OffsetAllocator::Stats stats = allocator.GetStats();
+    CHECK(stats.FreeBlocks == 1);
+    CHECK(stats.LargestFreeBlock == 60);
+    CHECK(stats.Used == 0);
+    CHECK(stats.GetFragmentation() == 0.0f);
+    CHECK(allocator.Allocate(60) == 0);
+}
+
+TEST_CASE(GrowExtendsTheTrailingFreeBlock)
+{
+    OffsetAllocator allocator(50);
+    uint32_t a = allocator.Allocate(40);
+    CHECK(allocator.Allocate(30) == OffsetAllocator::InvalidOffset);
+
+    allocator.Grow(80);
+    CHECK(allocator.GetCapacity() == 80);
+    CHECK(allocator.GetStats().FreeBlocks == 1); // [40, 50) + [50, 80)
+    CHECK(allocator.Allocate(30) == 40);
+
+    allocator.Grow(60); // Never shrinks
+    CHECK(allocator.GetCapacity() == 80);
+
+    allocator.Free(a, 40);
+    CHECK(allocator.GetStats().LargestFreeBlock == 40);
+}
+
+TEST_CASE(RandomChurnMatchesAReferenceMap)
+{
+    constexpr uint32_t CAPACITY = 4096;
+
+    struct Block
+    {
+        uint32_t Offset;
+        uint32_t Size;
+    };
+
+    std::mt19937 rng(7);
+    OffsetAllocator allocator(CAPACITY);
+    std::vector<uint8_t> owned(CAPACITY, 0);
+    std::vector<Block> live;
+    uint32_t used = 0;
+
+    for (int step = 0; step < 20000; step++)
+    {
+        if (live.empty() || rng() % 3 != 0)
+        {
+            uint32_t size = 1 + rng() % 64;
+            uint32_t offset = allocator.Allocate(size);
+            if (offset == OffsetAllocator::InvalidOffset)
+            {
+                // Only allowed when no free run is long enough
+                uint32_t run = 0, longest = 0;
+                for (uint8_t slot : owned)
+                {
+                    run = slot ? 0 : run + 1;
+                    if (run > longest) longest = run;
+                }
+                CHECK(longest < size);
+                continue;
+            }
+
+            REQUIRE(offset + size <= CAPACITY);
+            for (uint32_t i = offset; i < offset + size; i++)
+            {
+                REQUIRE(!owned[i]); // Overlaps a live block
+                owned[i] = 1;
+            }
+            live.push_back({ offset, size });
+            used += size;
+        }
+        else
+        {
+            size_t pick = rng() % live.size();
+            Block block = live[pick];
+            live[pick] = live.back();
+            live.pop_back();
+
+            allocator.Free(block.Offset, block.Size);
+            for (uint32_t i = block.Offset; i < block.Offset + block.Size; i++)
+                owned[i] = 0;
+            used -= block.Size;
+        }
+        REQUIRE(allocator.GetUsed() == used);
+    }
+
+    // Free blocks are exactly the free runs: coalescing left no two adjacent
+    uint32_t runs = 0;
+    for (uint32_t i = 0; i < CAPACITY; i++)
+        if (!owned[i] && (i == 0 || owned[i - 1])) runs++;
+    CHECK(allocator.GetStats().FreeBlocks == runs);
+
+    for (const Block& block : live)
+        allocator.Free(block.Offset, block.Size);
+    CHECK(allocator.GetStats().FreeBlocks == 1);
+    CHECK(allocator.GetStats().LargestFreeBlock == CAPACITY);
+}
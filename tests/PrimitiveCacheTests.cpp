@@ -0,0 +1,116 @@
+#include "Test.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <Rendering/Mesh/PrimitiveCache.hpp>
+
+namespace
+{
+    // Stands in for a Mesh: counts how many are alive
+    struct Object
+    {
+        explicit Object(int value) : Value(value) { s_Alive++; }
+        ~Object() { s_Alive--; }
+
+        int Value;
+        static inline int s_Alive = 0;
+    };
+
+    struct Builder
+    {
+        int Value;
+        int* Builds;
+        std::shared_ptr<Object> operator()() const { (*Builds)++; return std::make_shared<Object>(Value); }
+    };
+}
+
+TEST_CASE(HitReturnsTheSameObject)
+{
+    PrimitiveCache<Object> cache;
+    int builds = 0;
+
+    std::shared_ptr<Object> first = cache.GetOrBuild(1, Builder{ 10, &builds });
+    std::shared_ptr<Object> second = cache.GetOrBuild(1, Builder{ 20, &builds });
+    CHECK(first == second);
+    CHECK(second->Value == 10);
+    CHECK(builds == 1);
+
+    PrimitiveCacheStats stats = cache.GetStats();
+    CHECK(stats.Hits == 1);
+    CHECK(stats.Misses == 1);
+    CHECK(stats.LiveEntries == 1);
+}
+
+TEST_CASE(KeysAreSeparate)
+{
+    PrimitiveCache<Object> cache;
+    int builds = 0;
+
+    std::shared_ptr<Object> a = cache.GetOrBuild(1, Builder{ 1, &builds });
+    std::shared_ptr<Object> b = cache.GetOrBuild(2, Builder{ 2, &builds });
+    CHECK(a != b);
+    CHECK(builds == 2);
+    CHECK(cache.GetStats().LiveEntries == 2);
+}
+
+TEST_CASE(CacheDoesNotKeepObjectsAlive)
+{
+    PrimitiveCache<Object> cache;
+    int builds = 0;
+    const int aliveBefore = Object::s_Alive;
+
+    std::shared_ptr<Object> object = cache.GetOrBuild(7, Builder{ 1, &builds });
+    CHECK(Object::s_Alive == aliveBefore + 1);
+    object.reset();
+    CHECK(Object::s_Alive == aliveBefore);
+    CHECK(cache.GetStats().LiveEntries == 0);
+
+    // Expired: rebuilt on the next request, counted as a miss
+    object = cache.GetOrBuild(7, Builder{ 2, &builds });
+    CHECK(object->Value == 2);
+    CHECK(builds == 2);
+    CHECK(cache.GetStats().Hits == 0);
+    CHECK(cache.GetStats().Misses == 2);
+}
+
+TEST_CASE(SweepDropsExpiredEntries)
+{
+    PrimitiveCache<Object> cache;
+    int builds = 0;
+    const uint32_t interval = PrimitiveCache<Object>::SweepInterval;
+
+    // One key kept alive, the rest released right away
+    std::shared_ptr<Object> kept = cache.GetOrBuild(0, Builder{ 0, &builds });
+    for (uint32_t key = 1; key + 1 < interval; key++)
+        cache.GetOrBuild(key, Builder{ (int)key, &builds });
+
+    CHECK(cache.GetEntryCount() == interval - 1);
+    CHECK(cache.GetStats().Evictions == 0);
+
+    // The interval-th insert sweeps: the held entry and the new one survive
+    std::shared_ptr<Object> last = cache.GetOrBuild(interval, Builder{ 0, &builds });
+    PrimitiveCacheStats stats = cache.GetStats();
+    CHECK(stats.Evictions == interval - 2);
+    CHECK(stats.LiveEntries == 2);
+    CHECK(cache.GetEntryCount() == 2);
+
+    // Survivors are still hits
+    CHECK(cache.GetOrBuild(0, Builder{ 1, &builds }) == kept);
+    CHECK(cache.GetStats().Hits == 1);
+}
+
+TEST_CASE(ManyHoldersShareOneObject)
+{
+    PrimitiveCache<Object> cache;
+    int builds = 0;
+
+    std::vector<std::shared_ptr<Object>> holders;
+    for (int i = 0; i < 1000; i++)
+        holders.push_back(cache.GetOrBuild(3, Builder{ i, &builds }));
+
+    CHECK(builds == 1);
+    CHECK(holders.front() == holders.back());
+    CHECK(holders.front().use_count() == 1000);
+    CHECK(cache.GetStats().Hits == 999);
+}
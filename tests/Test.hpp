@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdio>
+#include <vector>
+
+// ============================================================================
+// Test - minimal self-registering test cases for the engine test executables
+// ============================================================================
+// Each test file builds into its own executable together with TestMain.cpp
+// and is registered with CTest (tests/CMakeLists.txt). A failed CHECK logs
+// and keeps going; the process exit code is the number of failed cases.
+// ============================================================================
+namespace Test
+{
+    struct Case
+    {
+        const char* Name;
+        void (*Run)();
+    };
+
+    std::vector<Case>& GetCases();
+    void ReportFailure(const char* file, int line, const char* expression);
+
+    struct Registrar
+    {
+        Registrar(const char* name, void (*run)()) { GetCases().push_back({ name, run }); }
+    };
+}
+
+#define TEST_CASE(name) \
+    static void name(); \
+    static Test::Registrar name##_Registrar(#name, name); \
+    static void name()
+
+#define CHECK(expression) \
+    do { if (!(expression)) Test::ReportFailure(__FILE__, __LINE__, #expression); } while (0)
+
+// Stops the case on failure - for preconditions later checks depend on
+#define REQUIRE(expression) \
+    do { if (!(expression)) { Test::ReportFailure(__FILE__, __LINE__, #expression); return; } } while (0)
@@ -0,0 +1,37 @@
+#include "Test.hpp"
+
+#include <Core/Log.hpp>
+
+namespace
+{
+    int s_CaseFailures = 0;
+}
+
+std::vector<Test::Case>& Test::GetCases()
+{
+    static std::vector<Case> cases;
+    return cases;
+}
+
+void Test::ReportFailure(const char* file, int line, const char* expression)
+{
+    std::printf("    %s(%d): CHECK(%s) failed\n", file, line, expression);
+    s_CaseFailures++;
+}
+
+int main()
+{
+    Core::Log::Init();
+
+    int failed = 0;
+    for (const Test::Case& testCase : Test::GetCases())
+    {
+        s_CaseFailures = 0;
+        testCase.Run();
+        std::printf("[%s] %s\n", s_CaseFailures ? "FAIL" : " OK ", testCase.Name);
+        failed += s_CaseFailures ? 1 : 0;
+    }
+
+    std::printf("%zu cases, %d failed\n", Test::GetCases().size(), failed);
+    return failed;
+}
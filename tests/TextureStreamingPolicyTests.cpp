@@ -0,0 +1,185 @@
+#include "Test.hpp"
+
+#include <Rendering/TextureStreamingPolicy.hpp>
+
+using Policy = TextureStreamingPolicy;
+using ActionType = Policy::Action::Type;
+
+namespace
+{
+    // Loads finish within the frame they were issued
+    void CompleteLoads(Policy& policy, const std::vector<Policy::Action>& actions)
+    {
+        for (const Policy::Action& action : actions)
+        {
+            if (action.Kind == ActionType::Load)
+                policy.OnLoaded(action.Entry, action.TargetMip);
+        }
+    }
+}
+
+TEST_CASE(NewEntriesStartAtTailMip)
+{
+    Policy policy;
+    Policy::Id id = policy.Add(1024, 1024, 4);
+
+    CHECK(policy.GetResidentMip(id) == 4); // 1024 >> 4 = 64 = TailSize
+    CHECK(policy.GetTargetMip(id) == 4);
+    CHECK(policy.ComputeMip(id, 256.0f) == 2);
+    CHECK(policy.ComputeMip(id, 4096.0f) == 0);
+    CHECK(policy.GetStats().ResidentBytes == Policy::GetResidentBytes(1024, 1024, 4));
+}
+
+TEST_CASE(ResidentBytesStayWithinBudget)
+{
+    const uint64_t full = Policy::GetResidentBytes(1024, 1024, 0);
+    const uint64_t tail = Policy::GetResidentBytes(1024, 1024, 4);
+
+    Policy policy;
+    policy.SetBudget(full * 4 + tail * 12);
+
+    std::vector<Policy::Id> ids;
+    for (int i = 0; i < 16; i++)
+        ids.push_back(policy.Add(1024, 1024, 4));
+
+    // Everything wants mip 0 - four times more than the budget holds
+    for (int frame = 0; frame < 32; frame++)
+    {
+        for (Policy::Id id : ids)
+            policy.Request(id, 0);
+
+        CompleteLoads(policy, policy.Plan());
+        CHECK(policy.GetStats().ResidentBytes <= policy.GetBudget());
+    }
+
+    Policy::Stats stats = policy.GetStats();
+    CHECK(stats.WantedBytes == full * 16);
+    CHECK(stats.OverBudgetFrames == 0);
+    CHECK(stats.Loads > 0);
+}
+
+TEST_CASE(ShrinkingBudgetEvictsImmediately)
+{
+    Policy policy;
+    policy.UnusedFrames = 2;
+    Policy::Id id = policy.Add(1024, 1024, 4);
+
+    policy.Request(id, 0);
+    CompleteLoads(policy, policy.Plan());
+    REQUIRE(policy.GetResidentMip(id) == 0);
+
+    // Unused textures stay resident while the budget allows - they are a cache
+    for (int frame = 0; frame < 4; frame++)
+        CHECK(policy.Plan().empty());
+    CHECK(policy.GetResidentMip(id) == 0);
+
+    policy.SetBudget(Policy::GetResidentBytes(1024, 1024, 3));
+    std::vector<Policy::Action> actions = policy.Plan();
+    REQUIRE(actions.size() == 1);
+    CHECK(actions[0].Kind == ActionType::Evict);
+    CHECK(actions[0].TargetMip == 3); // Only as far as needed, not down to the tail
+    CHECK(policy.GetResidentMip(id) == 3);
+}
+
+TEST_CASE(EvictsLeastRecentlyUsedFirst)
+{
+    const uint64_t full = Policy::GetResidentBytes(512, 512, 0);
+    const uint64_t tail = Policy::GetResidentBytes(512, 512, 3);
+
+    Policy policy;
+    policy.UnusedFrames = 2;
+    policy.SetBudget(full * 3 + tail); // Three full textures and one tail
+
+    Policy::Id a = policy.Add(512, 512, 3);
+    Policy::Id b = policy.Add(512, 512, 3);
+    Policy::Id c = policy.Add(512, 512, 3);
+    Policy::Id d = policy.Add(512, 512, 3);
+
+    policy.Request(a, 0);
+    policy.Request(b, 0);
+    policy.Request(c, 0);
+    CompleteLoads(policy, policy.Plan());
+    REQUIRE(policy.GetResidentMip(a) == 0 && policy.GetResidentMip(b) == 0 && policy.GetResidentMip(c) == 0);
+
+    // Last use: a = frame 1, b = frame 2, c = frame 3
+    policy.Request(b, 0);
+    policy.Request(c, 0);
+    policy.Plan();
+    policy.Request(c, 0);
+    policy.Plan();
+
+    // Let all three go stale; nothing is evicted while under budget
+    policy.Plan();
+    policy.Plan();
+    REQUIRE(policy.GetTargetMip(c) == 3);
+
+    policy.Request(d, 0);
+    std::vector<Policy::Action> actions = policy.Plan();
+
+    REQUIRE(actions.size() == 2);
+    CHECK(actions[0].Kind == ActionType::Evict);
+    CHECK(actions[0].Entry == a);
+    CHECK(actions[0].TargetMip == 3);
+    CHECK(actions[1].Kind == ActionType::Load);
+    CHECK(actions[1].Entry == d);
+    CHECK(actions[1].TargetMip == 0);
+
+    CHECK(policy.GetResidentMip(b) == 0);
+    CHECK(policy.GetResidentMip(c) == 0);
+    CHECK(policy.GetStats().ResidentBytes <= policy.GetBudget());
+}
+
+TEST_CASE(InFlightLoadsReserveTheirBytes)
+{
+    const uint64_t full = Policy::GetResidentBytes(1024, 1024, 0);
+    const uint64_t tail = Policy::GetResidentBytes(1024, 1024, 4);
+
+    Policy policy;
+    policy.SetBudget(full + tail);
+
+    Policy::Id x = policy.Add(1024, 1024, 4);
+    Policy::Id y = policy.Add(1024, 1024, 4);
+
+    policy.Request(x, 0);
+    std::vector<Policy::Action> actions = policy.Plan();
+    REQUIRE(actions.size() == 1);
+    CHECK(actions[0].Kind == ActionType::Load && actions[0].Entry == x);
+    CHECK(policy.IsPending(x));
+    CHECK(policy.GetResidentMip(x) == 4);                   // Nothing arrived yet...
+    CHECK(policy.GetStats().ResidentBytes == full + tail);  // ...but the bytes are taken
+    CHECK(policy.GetStats().PendingLoads == 1);
+
+    // The pending load is neither re-issued nor evicted to make room for y
+    policy.Request(x, 0);
+    policy.Request(y, 0);
+    CHECK(policy.Plan().empty());
+    CHECK(policy.GetResidentMip(y) == 4);
+
+    policy.OnLoaded(x, 0);
+    CHECK(!policy.IsPending(x));
+    CHECK(policy.GetResidentMip(x) == 0);
+    CHECK(policy.GetStats().ResidentBytes == full + tail);
+}
+
+TEST_CASE(FailedOrRemovedLoadsReleaseTheirReservation)
+{
+    const uint64_t full = Policy::GetResidentBytes(1024, 1024, 0);
+    const uint64_t tail = Policy::GetResidentBytes(1024, 1024, 4);
+
+    Policy policy;
+    Policy::Id x = policy.Add(1024, 1024, 4);
+    Policy::Id y = policy.Add(1024, 1024, 4);
+
+    policy.Request(x, 0);
+    policy.Request(y, 0);
+    policy.Plan();
+    REQUIRE(policy.GetStats().ResidentBytes == full * 2);
+
+    // Decode failed: the old mip is still what is resident
+    policy.OnLoaded(x, 4);
+    CHECK(policy.GetStats().ResidentBytes == full + tail);
+
+    policy.Remove(y);
+    CHECK(policy.GetStats().ResidentBytes == tail);
+    CHECK(policy.GetStats().Entries == 1);
+}
@@ -0,0 +1,172 @@
+#include "Test.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <Rendering/Mesh/Mesh.hpp>
+#include <Rendering/Mesh/VertexLayout.hpp>
+
+namespace
+{
+    float FromBits(uint32_t bits)
+    {
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    // Edge cases for half conversion: signed zeros, half denormals and their
+    // rounding, ties to even, the overflow boundary, float denormals, Inf and NaN
+    std::vector<float> SpecialValues()
+    {
+        const float inf = std::numeric_limits<float>::infinity();
+        std::vector<float> values =
+        {
+            0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 2.0f / 3.0f, 0.1f, -0.3f,
+            5.96046448e-8f, 2.98023224e-8f, 2.98023259e-8f, 8.9e-8f, 6.0975552e-5f, 6.1035156e-5f,
+            1.0f + 1.0f / 2048.0f, 1.0f + 3.0f / 2048.0f, 1.0f + 1.0f / 4096.0f,
+            65504.0f, 65519.0f, 65520.0f, 1.0e10f, -1.0e10f,
+            std::numeric_limits<float>::denorm_min(), std::numeric_limits<float>::min(),
+            inf, -inf, std::numeric_limits<float>::quiet_NaN(), FromBits(0xFF800001u)
+        };
+        for (int k = -520; k <= 520; k++)
+            values.push_back((k + 0.5f) / 511.0f); // Exact snorm ties
+        return values;
+    }
+
+    std::vector<Vertex> MakeVertices()
+    {
+        std::vector<float> special = SpecialValues();
+        std::vector<Vertex> vertices;
+        for (size_t i = 0; i < special.size(); i++)
+        {
+            float a = special[i], b = special[(i + 7) % special.size()], c = special[(i + 13) % special.size()];
+            vertices.push_back({ glm::vec3(a, b, c), glm::vec3(c, a, b) });
+        }
+
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> range(-70000.0f, 70000.0f);
+        std::uniform_real_distribution<float> unit(-1.2f, 1.2f);
+        std::uniform_int_distribution<uint32_t> bits;
+        for (int i = 0; i < 20000; i++)
+        {
+            glm::vec3 position(range(rng), range(rng) * 1e-4f, FromBits(bits(rng)));
+            glm::vec3 normal(unit(rng), unit(rng), unit(rng));
+            vertices.push_back({ position, normal });
+        }
+        return vertices;
+    }
+
+    // The scalar path, built from the public reference conversions
+    std::vector<uint8_t> EncodeScalar(VertexFormat format, const std::vector<Vertex>& vertices)
+    {
+        const uint32_t stride = VertexEncoder::GetLayout(format).Stride;
+        std::vector<uint8_t> out(vertices.size() * stride);
+        for (size_t i = 0; i < vertices.size(); i++)
+        {
+            const glm::vec3& p = vertices[i].Position;
+            const glm::vec3& n = vertices[i].Normal;
+            uint8_t* dst = out.data() + i * stride;
+            if (format == VertexFormat::Float32)
+            {
+                std::memcpy(dst, &vertices[i], sizeof(Vertex));
+                continue;
+            }
+
+            uint16_t position[4] = { VertexEncoder::FloatToHalf(p.x), VertexEncoder::FloatToHalf(p.y),
+                                     VertexEncoder::FloatToHalf(p.z), VertexEncoder::FloatToHalf(1.0f) };
+            std::memcpy(dst, position, sizeof(position));
+            if (format == VertexFormat::Quantized)
+            {
+                uint32_t packed = VertexEncoder::PackSnorm10_10_10_2(n.x, n.y, n.z);
+                std::memcpy(dst + 8, &packed, sizeof(packed));
+            }
+            else
+            {
+                uint16_t normal[4] = { VertexEncoder::FloatToHalf(n.x), VertexEncoder::FloatToHalf(n.y),
+                                       VertexEncoder::FloatToHalf(n.z), 0 };
+                std::memcpy(dst + 8, normal, sizeof(normal));
+            }
+        }
+        return out;
+    }
+
+    // Index of the first differing vertex, or count if identical
+    size_t FirstMismatch(VertexFormat format, const std::vector<Vertex>& vertices)
+    {
+        const uint32_t stride = VertexEncoder::GetLayout(format).Stride;
+        std::vector<uint8_t> encoded(vertices.size() * stride);
+        VertexEncoder::Encode(format, vertices.data(), (uint32_t)vertices.size(), encoded.data());
+        std::vector<uint8_t> expected = EncodeScalar(format, vertices);
+
+        for (size_t i = 0; i < vertices.size(); i++)
+        {
+            if (std::memcmp(encoded.data() + i * stride, expected.data() + i * stride, stride) != 0)
+            {
+                std::printf("    %s vertex %zu differs\n", VertexEncoder::GetFormatName(format), i);
+                return i;
+            }
+        }
+        return vertices.size();
+    }
+}
+
+TEST_CASE(FloatToHalfKnownValues)
+{
+    using VertexEncoder::FloatToHalf;
+    CHECK(FloatToHalf(0.0f) == 0x0000);
+    CHECK(FloatToHalf(-0.0f) == 0x8000);
+    CHECK(FloatToHalf(1.0f) == 0x3C00);
+    CHECK(FloatToHalf(-2.0f) == 0xC000);
+    CHECK(FloatToHalf(65504.0f) == 0x7BFF);
+    CHECK(FloatToHalf(65520.0f) == 0x7C00);                       // Rounds up to Inf
+    CHECK(FloatToHalf(5.96046448e-8f) == 0x0001);                 // Smallest half denormal
+    CHECK(FloatToHalf(1.0f + 1.0f / 2048.0f) == 0x3C00);          // Tie, even stays
+    CHECK(FloatToHalf(1.0f + 3.0f / 2048.0f) == 0x3C02);          // Tie, odd rounds up
+    CHECK(FloatToHalf(std::numeric_limits<float>::infinity()) == 0x7C00);
+    CHECK(FloatToHalf(std::numeric_limits<float>::quiet_NaN()) == 0x7E00);
+}
+
+TEST_CASE(PackSnormKnownValues)
+{
+    using VertexEncoder::PackSnorm10_10_10_2;
+    CHECK(PackSnorm10_10_10_2(0.0f, 0.0f, 0.0f) == 0u);
+    CHECK(PackSnorm10_10_10_2(1.0f, 0.0f, 0.0f) == 0x1FFu);
+    CHECK(PackSnorm10_10_10_2(0.0f, -1.0f, 0.0f) == 0x201u << 10);
+    CHECK(PackSnorm10_10_10_2(0.0f, 0.0f, 2.0f) == 0x1FFu << 20);  // Clamped
+    CHECK(PackSnorm10_10_10_2(std::nanf(""), 0.0f, 0.0f) == 0x201u); // NaN -> -1
+}
+
+TEST_CASE(Float32IsACopy)
+{
+    std::vector<Vertex> vertices = MakeVertices();
+    CHECK(FirstMismatch(VertexFormat::Float32, vertices) == vertices.size());
+}
+
+// Encode() takes the SSE2 path where available; it must match the scalar conversions bit for bit
+TEST_CASE(HalfMatchesScalar)
+{
+    std::vector<Vertex> vertices = MakeVertices();
+    CHECK(FirstMismatch(VertexFormat::Half, vertices) == vertices.size());
+}
+
+TEST_CASE(QuantizedMatchesScalar)
+{
+    std::vector<Vertex> vertices = MakeVertices();
+    CHECK(FirstMismatch(VertexFormat::Quantized, vertices) == vertices.size());
+}
+
+TEST_CASE(StatsCountEncodedVertices)
+{
+    std::vector<Vertex> vertices(100, Vertex{ glm::vec3(1.0f), glm::vec3(0.0f, 1.0f, 0.0f) });
+    std::vector<uint8_t> out(vertices.size() * 16);
+
+    VertexEncoder::Stats before = VertexEncoder::GetStats();
+    VertexEncoder::Encode(VertexFormat::Half, vertices.data(), (uint32_t)vertices.size(), out.data());
+    const VertexEncoder::Stats& after = VertexEncoder::GetStats();
+    CHECK(after.VerticesEncoded - before.VerticesEncoded == 100);
+    CHECK(after.BytesWritten - before.BytesWritten == 1600);
+}
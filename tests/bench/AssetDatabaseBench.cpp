@@ -0,0 +1,98 @@
+#include "Bench.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <Core/Log.hpp>
+#include <Core/Resources/AssetDatabase.hpp>
+
+using Bench::Clock;
+using Bench::ElapsedMs;
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    constexpr uint32_t FILES_PER_DIRECTORY = 1000;
+    constexpr size_t FILE_BYTES = 1024;
+
+    // Unique content per (index, version), so moves are found by hash and edits change it
+    void WriteFile(const fs::path& path, uint32_t index, uint32_t version = 0)
+    {
+        std::string text = "asset " + std::to_string(index) + " version " + std::to_string(version) + "\n";
+        text.resize(FILE_BYTES, (char)('a' + index % 26));
+        std::ofstream(path, std::ios::binary).write(text.data(), (std::streamsize)text.size());
+    }
+
+    fs::path FilePath(const fs::path& root, uint32_t index)
+    {
+        return root / ("dir" + std::to_string(index / FILES_PER_DIRECTORY)) / ("file" + std::to_string(index) + ".txt");
+    }
+
+    void Report(const char* scan, double wallMs)
+    {
+        AssetDatabase::Stats stats = AssetDatabase::GetStats();
+        uint32_t read = stats.Touched + stats.Added + stats.Modified + stats.Moved;
+        LOG_INFO("[AssetDatabase]   {0}: {1} ms (scan {2} ms, walk {3} ms, hash {4} ms), {5} files, {6} read ({7} KB)",
+                 scan, wallMs, stats.TotalMs, stats.WalkMs, stats.HashMs, stats.Files, read, stats.HashedBytes / 1024);
+        LOG_INFO("[AssetDatabase]     {0} unchanged, {1} touched, {2} added, {3} modified, {4} moved, {5} removed",
+                 stats.Unchanged, stats.Touched, stats.Added, stats.Modified, stats.Moved, stats.Removed);
+    }
+}
+
+// `size` 1 KB files, 1000 per directory: cold scan, warm rescan, restart, then edits + moves
+BENCHMARK(AssetDatabase, 100000)
+{
+    Bench::TempDir dir("assets");
+    const fs::path root = dir.Path / "assets";
+    const std::string index = (dir.Path / "assets.db").string();
+
+    // Older than the "written in the last 2 s" window, so a warm scan can skip every file
+    const auto past = fs::file_time_type::clock::now() - std::chrono::hours(1);
+
+    auto start = Clock::now();
+    for (uint32_t i = 0; i < size; i++)
+    {
+        fs::path path = FilePath(root, i);
+        if (i % FILES_PER_DIRECTORY == 0) fs::create_directories(path.parent_path());
+        WriteFile(path, i);
+        fs::last_write_time(path, past);
+    }
+    LOG_INFO("[AssetDatabase] {0} files in {1} directories, written in {2} ms",
+             size, (size + FILES_PER_DIRECTORY - 1) / FILES_PER_DIRECTORY, ElapsedMs(start));
+
+    start = Clock::now();
+    AssetDatabase::Init(root.string(), index, false);
+    Report("Cold, no index", ElapsedMs(start));
+
+    start = Clock::now();
+    AssetDatabase::Refresh(false);
+    Report("Warm rescan", ElapsedMs(start));
+
+    AssetDatabase::Shutdown();
+    std::error_code error;
+    LOG_INFO("[AssetDatabase]   Index: {0} KB", fs::file_size(index, error) / 1024);
+
+    start = Clock::now();
+    AssetDatabase::Init(root.string(), index, false);
+    Report("Restart: index load + rescan", ElapsedMs(start));
+
+    // 100 edits, 2 moves into another directory, 5 new files, 3 deletions
+    const uint32_t edits = std::min(100u, size / 4);
+    for (uint32_t i = 0; i < edits; i++)
+        WriteFile(FilePath(root, i * (size / edits)), i * (size / edits), 1);
+    for (uint32_t i = 0; i < 2 && i < size; i++)
+        fs::rename(FilePath(root, size - 1 - i), root / "dir0" / ("moved" + std::to_string(i) + ".txt"), error);
+    for (uint32_t i = 0; i < 5; i++)
+        WriteFile(root / "dir0" / ("added" + std::to_string(i) + ".txt"), size + i);
+    for (uint32_t i = 0; i < 3 && 3 + i * 2 < size; i++)
+        fs::remove(FilePath(root, 3 + i * 2), error);
+
+    start = Clock::now();
+    AssetDatabase::Refresh(false);
+    Report("Edits + moves", ElapsedMs(start));
+
+    AssetDatabase::Shutdown();
+}
@@ -0,0 +1,115 @@
+#include "Bench.hpp"
+#include "GridObj.hpp"
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Core/Log.hpp>
+#include <Core/Resources/AsyncLoader.hpp>
+#include <Core/Resources/MappedFile.hpp>
+#include <Rendering/Mesh/CookedMesh.hpp>
+#include <Rendering/Mesh/Mesh.hpp>
+#include <Rendering/Mesh/ObjImporter.hpp>
+
+using Bench::Clock;
+using Bench::ElapsedMs;
+
+namespace
+{
+    constexpr VertexFormat FORMAT = VertexFormat::Float32;
+    constexpr uint32_t LOD_LEVELS = 0;
+
+    // Worker half of ResourceManager::LoadModelAsync: import + cook unless the cooked file is current
+    bool PrepareModel(const std::string& path)
+    {
+        std::string cookedPath = CookedMesh::GetCookedPath(path, FORMAT, LOD_LEVELS);
+        if (!CookedMesh::IsUpToDate(cookedPath, path, FORMAT, LOD_LEVELS) || !CookedMesh::Verify(cookedPath))
+        {
+            std::vector<Vertex> vertices;
+            std::vector<uint32_t> indices;
+            ObjImporter::Stats imported;
+            if (!ObjImporter::Load(path, vertices, indices, &imported)) return false;
+            if (!CookedMesh::Cook(cookedPath, vertices, indices, FORMAT, LOD_LEVELS, imported.TotalMs)) return false;
+        }
+
+        // Touch every page, like PrefetchFile
+        MappedFile file(cookedPath);
+        char sum = 0;
+        for (size_t offset = 0; offset < file.GetSize(); offset += 4096)
+            sum += file.GetData()[offset];
+        volatile char sink = sum;
+        (void)sink;
+        return file.IsOpen();
+    }
+
+    // Main-thread half without GL: map the cooked file and copy level 0 where
+    // CookedMesh::Load would hand it to glBufferSubData
+    void UploadModel(const std::string& path, std::vector<uint8_t>& staging)
+    {
+        MappedFile file(CookedMesh::GetCookedPath(path, FORMAT, LOD_LEVELS));
+        if (file.GetSize() < sizeof(CookedMeshHeader) + sizeof(CookedMeshLOD)) return;
+
+        CookedMeshLOD level;
+        std::memcpy(&level, file.GetData() + sizeof(CookedMeshHeader), sizeof(level));
+        size_t vertexBytes = (size_t)level.VertexCount * VertexEncoder::GetLayout(FORMAT).Stride;
+        size_t indexBytes = (size_t)level.IndexCount * sizeof(uint32_t);
+        if (level.VertexOffset + vertexBytes > file.GetSize() || level.IndexOffset + indexBytes > file.GetSize()) return;
+
+        staging.resize(vertexBytes + indexBytes);
+        std::memcpy(staging.data(), file.GetData() + level.VertexOffset, vertexBytes);
+        std::memcpy(staging.data() + vertexBytes, file.GetData() + level.IndexOffset, indexBytes);
+    }
+
+    // Submits one load per file, then runs 60 Hz frames with the default 2 ms upload budget until drained
+    void RunBatch(const char* name, const std::vector<std::string>& paths)
+    {
+        constexpr auto FRAME = std::chrono::microseconds(16667);
+
+        std::vector<uint8_t> staging;
+        uint32_t failed = 0;
+        auto start = Clock::now();
+        for (const std::string& path : paths)
+        {
+            auto ok = std::make_shared<bool>(false);
+            AsyncLoader::Submit([ok, path]() { *ok = PrepareModel(path); },
+                                [ok, path, &staging, &failed]() { if (*ok) UploadModel(path, staging); else failed++; });
+        }
+        double submitMs = ElapsedMs(start);
+
+        while (!AsyncLoader::IsIdle())
+        {
+            auto frame = Clock::now();
+            AsyncLoader::Update();
+            std::this_thread::sleep_until(frame + FRAME);
+        }
+
+        AsyncLoader::Stats stats = AsyncLoader::GetStats();
+        LOG_INFO("[AsyncLoader]   {0}: submit {1} ms, first ready {2} ms, all ready {3} ms, {4} failed",
+                 name, submitMs, stats.FirstReadyMs, stats.AllReadyMs, failed);
+        LOG_INFO("[AsyncLoader]     {0} workers, worker time {1} ms, upload {2} ms over {3} frames, max {4} ms/frame",
+                 stats.Workers, stats.WorkMs, stats.UploadMs, stats.Frames, stats.MaxFrameUploadMs);
+    }
+}
+
+// `size` small OBJ files (1.6k triangles each) loaded through AsyncLoader: first run imports and
+// cooks, the second only maps the cooked files. Uploads copy the cooked blocks instead of calling GL.
+BENCHMARK(AsyncLoader, 1000)
+{
+    Bench::TempDir dir("async");
+
+    const std::string obj = Bench::MakeGridObj(29); // 28 x 28 quads
+    std::vector<std::string> paths(size);
+    for (uint32_t i = 0; i < size; i++)
+    {
+        paths[i] = (dir.Path / ("model" + std::to_string(i) + ".obj")).string();
+        std::ofstream(paths[i], std::ios::binary).write(obj.data(), (std::streamsize)obj.size());
+    }
+    LOG_INFO("[AsyncLoader] {0} OBJ files, {1} KB each", size, obj.size() / 1024);
+
+    RunBatch("First run (import + cook)", paths);
+    RunBatch("Cooked", paths);
+    AsyncLoader::Shutdown();
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <vector>
+
+// ============================================================================
+// Bench - self-registering benchmarks for the UICheckBench executable
+// ============================================================================
+// Not part of CTest: timings depend on the machine, so they are logged for a
+// person to read, not checked. Each benchmark takes a size (entities, nodes,
+// texels per side) and has a default for a plain run.
+// ============================================================================
+namespace Bench
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Case
+    {
+        const char* Name;
+        void (*Run)(uint32_t size);
+        uint32_t DefaultSize;
+    };
+
+    std::vector<Case>& GetCases();
+
+    struct Registrar
+    {
+        Registrar(const char* name, void (*run)(uint32_t), uint32_t defaultSize) { GetCases().push_back({ name, run, defaultSize }); }
+    };
+
+    inline double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    // Fresh directory under the system temp dir for benchmarks that need files, removed on scope exit
+    struct TempDir
+    {
+        std::filesystem::path Path;
+
+        explicit TempDir(const char* name)
+        {
+            Path = std::filesystem::temp_directory_path() / (std::string("uicheck_bench_") + name + "_" +
+                   std::to_string(Clock::now().time_since_epoch().count()));
+            std::filesystem::create_directories(Path);
+        }
+        ~TempDir()
+        {
+            std::error_code error;
+            std::filesystem::remove_all(Path, error);
+        }
+
+        TempDir(const TempDir&) = delete;
+        TempDir& operator=(const TempDir&) = delete;
+    };
+}
+
+// `name` is what the command line selects; it may be the class under test
+#define BENCHMARK(name, defaultSize) \
+    static void name##_Bench(uint32_t size); \
+    static Bench::Registrar name##_Registrar(#name, name##_Bench, defaultSize); \
+    static void name##_Bench(uint32_t size)
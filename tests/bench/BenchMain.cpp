@@ -0,0 +1,38 @@
+#include "Bench.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <Core/Log.hpp>
+
+std::vector<Bench::Case>& Bench::GetCases()
+{
+    static std::vector<Case> cases;
+    return cases;
+}
+
+// UICheckBench [name [size]] - no name runs every benchmark at its default size
+int main(int argc, char** argv)
+{
+    Core::Log::Init();
+
+    const char* only = argc > 1 ? argv[1] : nullptr;
+    uint32_t size = argc > 2 ? (uint32_t)std::strtoul(argv[2], nullptr, 10) : 0;
+
+    int ran = 0;
+    for (const Bench::Case& benchCase : Bench::GetCases())
+    {
+        if (only && std::strcmp(only, benchCase.Name) != 0) continue;
+        benchCase.Run(size ? size : benchCase.DefaultSize);
+        ran++;
+    }
+
+    if (ran == 0)
+    {
+        std::printf("No benchmark named '%s'. Available:\n", only ? only : "");
+        for (const Bench::Case& benchCase : Bench::GetCases())
+            std::printf("    %s (default size %u)\n", benchCase.Name, benchCase.DefaultSize);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,184 @@
+#include "Bench.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <glad/glad.h>
+
+#include <Core/Log.hpp>
+#include <Core/Window.hpp>
+#include <Core/Resources/AssetDatabase.hpp>
+#include <Core/Resources/AsyncLoader.hpp>
+#include <Rendering/ThumbnailCache.hpp>
+
+using Bench::Clock;
+using Bench::ElapsedMs;
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    // 96 px cells in a ~1200 x 800 panel
+    constexpr uint32_t COLUMNS = 8;
+    constexpr uint32_t ROWS = 6;
+    constexpr uint32_t VISIBLE = COLUMNS * ROWS;
+    constexpr uint32_t IMAGE_SIZE = 8;
+
+    // Distinct pixels per index, so every file has its own content hash (and thumbnail)
+    void WriteImage(const fs::path& path, uint32_t index)
+    {
+        std::string header = "P6\n" + std::to_string(IMAGE_SIZE) + " " + std::to_string(IMAGE_SIZE) + "\n255\n";
+        std::string pixels(IMAGE_SIZE * IMAGE_SIZE * 3, '\0');
+        for (size_t i = 0; i < pixels.size(); i++)
+            pixels[i] = (char)((index >> (8 * (i % 3))) + i);
+        std::ofstream file(path, std::ios::binary);
+        file.write(header.data(), (std::streamsize)header.size());
+        file.write(pixels.data(), (std::streamsize)pixels.size());
+    }
+
+    struct FrameStats
+    {
+        uint32_t Frames = 0;
+        uint32_t Ready = 0; // Thumbnails ready in the last frame
+        double TotalMs = 0.0;
+        double MaxMs = 0.0;
+        double UploadMs = 0.0;
+
+        void Add(double ms)
+        {
+            Frames++;
+            TotalMs += ms;
+            MaxMs = std::max(MaxMs, ms);
+        }
+        double GetAverageMs() const { return Frames ? TotalMs / Frames : 0.0; }
+    };
+
+    // The non-ImGui work DrawContentBrowserPanel does per frame: look up the folder, then for
+    // each visible cell find the record, cut its file name and ask for its thumbnail
+    uint32_t DrawVisible(const std::string& folder, size_t firstItem, bool thumbnails)
+    {
+        const AssetDatabase::Directory* directory = AssetDatabase::GetDirectory(folder);
+        if (!directory) return 0;
+
+        const size_t folderCount = directory->Children.size();
+        const size_t end = std::min(folderCount + directory->Assets.size(), firstItem + VISIBLE);
+        uint32_t ready = 0;
+        size_t nameChars = 0;
+        for (size_t index = std::max(firstItem, folderCount); index < end; index++)
+        {
+            const AssetRecord* asset = AssetDatabase::Find(directory->Assets[index - folderCount]);
+            if (!asset) continue;
+
+            size_t slash = asset->Path.find_last_of('/');
+            const char* name = slash == std::string::npos ? asset->Path.c_str() : asset->Path.c_str() + slash + 1;
+            nameChars += std::char_traits<char>::length(name);
+
+            if (thumbnails && ThumbnailCache::Get(*asset).IsReady())
+                ready++;
+        }
+        volatile size_t sink = nameChars;
+        (void)sink;
+        return ready;
+    }
+
+    // One editor frame: the panel, then ThumbnailCache::Update and AsyncLoader::Update as the editor runs them
+    void RunFrame(FrameStats& stats, const std::string& folder, size_t firstItem, bool thumbnails)
+    {
+        auto start = Clock::now();
+        stats.Ready = DrawVisible(folder, firstItem, thumbnails);
+        stats.Add(ElapsedMs(start));
+
+        ThumbnailCache::Update();
+        start = Clock::now();
+        AsyncLoader::Update();
+        stats.UploadMs += ElapsedMs(start);
+    }
+
+    void Report(const char* name, const FrameStats& stats)
+    {
+        LOG_INFO("[ContentBrowser]   {0}: {1} frames, {2} ms/frame avg, {3} ms max, {4} of {5} thumbnails ready; AsyncLoader::Update {6} ms/frame",
+                 name, stats.Frames, stats.GetAverageMs(), stats.MaxMs, stats.Ready, VISIBLE,
+                 stats.Frames ? stats.UploadMs / stats.Frames : 0.0);
+    }
+}
+
+// One folder of `size` small PPM textures, viewed 8 x 6 cells at a time: the panel's listing +
+// ThumbnailCache::Get cost per frame (no ImGui) when opening the folder, idle, scrolling through it,
+// and opening it again from the disk cache.
+// Needs a GL context for the atlas (hidden window); without one only the listing is measured.
+BENCHMARK(ContentBrowser, 50000)
+{
+    Bench::TempDir dir("browser");
+    const fs::path root = dir.Path / "assets";
+    const std::string folder = "textures";
+    fs::create_directories(root / folder);
+
+    auto start = Clock::now();
+    for (uint32_t i = 0; i < size; i++)
+        WriteImage(root / folder / ("texture" + std::to_string(i) + ".ppm"), i);
+    LOG_INFO("[ContentBrowser] {0} textures in one folder, written in {1} ms", size, ElapsedMs(start));
+
+    // Hidden window for the atlas - like --headless
+    WindowProps props("UICheckBench", 64, 64);
+    props.Visible = false;
+    props.VSync = false;
+    std::unique_ptr<Window> window(Window::Create(props));
+    const bool hasGL = window && window->GetNativeWindow() && GLAD_GL_VERSION_3_3;
+    if (!hasGL)
+        LOG_ERROR("[ContentBrowser] No GL context - measuring the folder listing only");
+
+    // Listing, not cooking: a no-op texture importer keeps the first scan from queueing size CookedTexture jobs
+    AssetDatabase::RegisterImporter(AssetType::Texture, { []() -> uint64_t { return 0; }, [](const std::string&) { return true; } });
+    start = Clock::now();
+    AssetDatabase::Init(root.string(), (dir.Path / "assets.db").string(), false);
+    while (!AsyncLoader::IsIdle())
+        AsyncLoader::Update(1000.0);
+    LOG_INFO("[ContentBrowser] AssetDatabase::Init {0} ms, {1} assets", ElapsedMs(start), AssetDatabase::GetAssetCount());
+
+    FrameStats listing;
+    for (uint32_t frame = 0; frame < 1000; frame++)
+        RunFrame(listing, folder, (size_t)(frame % (size / VISIBLE + 1)) * VISIBLE, false);
+    Report("Listing only, no thumbnails", listing);
+
+    // Opening the folder: ask every frame until the first screen is filled
+    auto open = [&folder, size](const char* name)
+    {
+        FrameStats opening;
+        while (opening.Frames < 10000 && (opening.Frames == 0 || opening.Ready < std::min(VISIBLE, size)))
+            RunFrame(opening, folder, 0, true);
+        Report(name, opening);
+    };
+
+    if (hasGL)
+    {
+        const std::string cacheDirectory = (dir.Path / "thumbnails").string();
+        ThumbnailCache::Init(cacheDirectory);
+        open("Open, cold cache (until the first screen is ready)");
+
+        FrameStats idle;
+        for (uint32_t frame = 0; frame < 1000; frame++)
+            RunFrame(idle, folder, 0, true);
+        Report("Idle, all visible thumbnails ready", idle);
+
+        // One row per frame from top to bottom, without waiting for thumbnails
+        FrameStats scroll;
+        for (size_t first = 0; first < size; first += COLUMNS)
+            RunFrame(scroll, folder, first, true);
+        Report("Scroll, one row per frame", scroll);
+
+        while (!AsyncLoader::IsIdle())
+            AsyncLoader::Update(1000.0);
+        ThumbnailCache::LogStats();
+
+        // Editor restart: same folder, thumbnails now come from the disk cache
+        ThumbnailCache::Init(cacheDirectory);
+        open("Open after restart, disk cache");
+        ThumbnailCache::LogStats();
+        ThumbnailCache::Shutdown();
+    }
+
+    AsyncLoader::Shutdown();
+    AssetDatabase::Shutdown();
+}
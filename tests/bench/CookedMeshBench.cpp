@@ -0,0 +1,71 @@
+#include "Bench.hpp"
+#include "GridObj.hpp"
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <Core/Log.hpp>
+#include <Rendering/Mesh/CookedMesh.hpp>
+#include <Rendering/Mesh/Mesh.hpp>
+#include <Rendering/Mesh/ObjImporter.hpp>
+
+using Bench::Clock;
+using Bench::ElapsedMs;
+
+// A generated grid OBJ of `size` MB with 3 LODs: ObjImporter::Parse, then Build + Write once per
+// format and the mapped, validated read of the .cmesh (Load() without the GL upload), best of 5
+BENCHMARK(CookedMesh, 7)
+{
+    constexpr int RUNS = 5;
+    constexpr uint32_t LOD_LEVELS = 3;
+
+    Bench::TempDir dir("cmesh");
+    const uint32_t side = std::max(2u, (uint32_t)std::sqrt(size * 1024.0 * 1024.0 / Bench::GRID_OBJ_BYTES_PER_VERTEX));
+    const std::string obj = Bench::MakeGridObj(side);
+    const std::string objPath = (dir.Path / "grid.obj").string();
+
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    ObjImporter::Stats parsed;
+    if (!ObjImporter::Parse(obj.data(), obj.size(), vertices, indices, &parsed, 1))
+    {
+        LOG_ERROR("[CookedMesh] Generated OBJ did not parse");
+        return;
+    }
+    LOG_INFO("[CookedMesh] {0} KB OBJ, {1} vertices, {2} triangles, {3} LODs: parse {4} ms (1 thread, {5} MB/s)",
+             obj.size() / 1024, parsed.Vertices, parsed.Triangles, LOD_LEVELS, parsed.TotalMs, parsed.GetMBPerSecond());
+
+    for (uint32_t f = 0; f < (uint32_t)VertexFormat::Count; f++)
+    {
+        VertexFormat format = (VertexFormat)f;
+        const std::string cookedPath = CookedMesh::GetCookedPath(objPath, format, LOD_LEVELS);
+
+        CookedMesh::Data data;
+        auto start = Clock::now();
+        if (!CookedMesh::Build(vertices, indices, format, LOD_LEVELS, data, parsed.TotalMs)) continue;
+        double buildMs = ElapsedMs(start);
+
+        start = Clock::now();
+        if (!CookedMesh::Write(cookedPath, data)) continue;
+        double writeMs = ElapsedMs(start);
+
+        double readMs = 0.0;
+        bool valid = true;
+        for (int run = 0; run < RUNS; run++)
+        {
+            start = Clock::now();
+            valid = CookedMesh::Verify(cookedPath) && valid;
+            double ms = ElapsedMs(start);
+            if (run == 0 || ms < readMs) readMs = ms;
+        }
+
+        std::error_code error;
+        uint64_t bytes = std::filesystem::file_size(cookedPath, error);
+        double parseMs = parsed.TotalMs + buildMs;
+        LOG_INFO("[CookedMesh]   {0}: build {1} ms, write {2} ms, {3} KB, {4} levels | mapped read {5} ms{6} vs {7} ms parse + build ({8}x)",
+                 VertexEncoder::GetFormatName(format), buildMs, writeMs, bytes / 1024, data.Levels.size(), readMs,
+                 valid ? "" : " (INVALID)", parseMs, readMs > 0.0 ? parseMs / readMs : 0.0);
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace Bench
+{
+    // Rough OBJ text per grid vertex: one "v", one "vn" and one "f" line
+    constexpr double GRID_OBJ_BYTES_PER_VERTEX = 112.0;
+
+    // A wavy side x side grid of quads with per-vertex normals ("v//vn" faces)
+    inline std::string MakeGridObj(uint32_t side)
+    {
+        std::string obj;
+        obj.reserve((size_t)(side * (double)side * GRID_OBJ_BYTES_PER_VERTEX));
+        char line[128];
+        for (uint32_t y = 0; y < side; y++)
+        {
+            for (uint32_t x = 0; x < side; x++)
+            {
+                float height = 0.25f * std::sin(x * 0.1f) * std::cos(y * 0.1f);
+                std::snprintf(line, sizeof(line), "v %.6f %.6f %.6f\nvn %.6f %.6f %.6f\n",
+                              x * 0.01f, height, y * 0.01f, 0.0f, 1.0f, 0.0f);
+                obj += line;
+            }
+        }
+        for (uint32_t y = 0; y + 1 < side; y++)
+        {
+            for (uint32_t x = 0; x + 1 < side; x++)
+            {
+                uint32_t i = y * side + x + 1;
+                std::snprintf(line, sizeof(line), "f %u//%u %u//%u %u//%u %u//%u\n",
+                              i, i, i + side, i + side, i + side + 1, i + side + 1, i + 1, i + 1);
+                obj += line;
+            }
+        }
+        return obj;
+    }
+}
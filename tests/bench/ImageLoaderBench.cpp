@@ -0,0 +1,214 @@
+#include "Bench.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <Core/Log.hpp>
+#include <Rendering/Image.hpp>
+
+using Bench::Clock;
+using Bench::ElapsedMs;
+
+namespace
+{
+    // Checker blocks of flat color (RLE runs) over a gradient with grain (no runs), RGBA8 top-down
+    std::vector<uint8_t> MakePixels(uint32_t size)
+    {
+        std::mt19937 rng(7);
+        std::vector<uint8_t> pixels((size_t)size * size * 4);
+        for (uint32_t y = 0; y < size; y++)
+        {
+            for (uint32_t x = 0; x < size; x++)
+            {
+                uint8_t* px = &pixels[((size_t)y * size + x) * 4];
+                if ((x / 64 + y / 64) % 2 == 0)
+                {
+                    px[0] = 200; px[1] = 60; px[2] = 40;
+                }
+                else
+                {
+                    uint32_t grain = rng() & 15;
+                    px[0] = (uint8_t)(x * 255 / size);
+                    px[1] = (uint8_t)(y * 255 / size);
+                    px[2] = (uint8_t)(128 + grain);
+                }
+                px[3] = (uint8_t)(255 - (x + y) * 127 / (2 * size));
+            }
+        }
+        return pixels;
+    }
+
+    void Put16(std::vector<uint8_t>& out, uint32_t v) { out.push_back((uint8_t)v); out.push_back((uint8_t)(v >> 8)); }
+    void Put32(std::vector<uint8_t>& out, uint32_t v) { Put16(out, v & 0xFFFF); Put16(out, v >> 16); }
+
+    // BI_RGB, bottom-up; 24-bit rows padded to 4 bytes
+    std::vector<uint8_t> EncodeBMP(const std::vector<uint8_t>& pixels, uint32_t size, uint32_t bpp)
+    {
+        const size_t stride = (((size_t)bpp * size + 31) / 32) * 4;
+        std::vector<uint8_t> out = { 'B', 'M' };
+        Put32(out, (uint32_t)(54 + stride * size));
+        Put32(out, 0);
+        Put32(out, 54);
+        Put32(out, 40);
+        Put32(out, size);
+        Put32(out, size);
+        Put16(out, 1);
+        Put16(out, bpp);
+        for (int i = 0; i < 6; i++) Put32(out, 0);
+
+        out.resize(54 + stride * size);
+        for (uint32_t y = 0; y < size; y++)
+        {
+            uint8_t* row = out.data() + 54 + stride * (size - 1 - y);
+            for (uint32_t x = 0; x < size; x++)
+            {
+                const uint8_t* px = &pixels[((size_t)y * size + x) * 4];
+                uint8_t* dst = row + x * (bpp / 8);
+                dst[0] = px[2];
+                dst[1] = px[1];
+                dst[2] = px[0];
+                if (bpp == 32) dst[3] = px[3];
+            }
+        }
+        return out;
+    }
+
+    // True color, top-down; RLE packs repeats into run packets and the rest into raw packets
+    std::vector<uint8_t> EncodeTGA(const std::vector<uint8_t>& pixels, uint32_t size, uint32_t bpp, bool rle)
+    {
+        std::vector<uint8_t> out(18, 0);
+        out[2] = rle ? 10 : 2;
+        out[12] = (uint8_t)size; out[13] = (uint8_t)(size >> 8);
+        out[14] = (uint8_t)size; out[15] = (uint8_t)(size >> 8);
+        out[16] = (uint8_t)bpp;
+        out[17] = 0x20 | (bpp == 32 ? 8 : 0);
+
+        const uint32_t bytes = bpp / 8;
+        const size_t count = (size_t)size * size;
+        auto put = [&](size_t i)
+        {
+            const uint8_t* px = &pixels[i * 4];
+            uint8_t bgra[4] = { px[2], px[1], px[0], px[3] };
+            out.insert(out.end(), bgra, bgra + bytes);
+        };
+        auto same = [&](size_t a, size_t b) { return std::memcmp(&pixels[a * 4], &pixels[b * 4], bytes) == 0; };
+
+        if (!rle)
+        {
+            for (size_t i = 0; i < count; i++) put(i);
+            return out;
+        }
+
+        for (size_t i = 0; i < count; )
+        {
+            size_t run = 1;
+            while (i + run < count && run < 128 && same(i, i + run)) run++;
+            if (run > 1)
+            {
+                out.push_back((uint8_t)(0x80 | (run - 1)));
+                put(i);
+                i += run;
+                continue;
+            }
+
+            size_t raw = 1;
+            while (i + raw < count && raw < 128 && !(i + raw + 1 < count && same(i + raw, i + raw + 1))) raw++;
+            out.push_back((uint8_t)(raw - 1));
+            for (size_t r = 0; r < raw; r++) put(i + r);
+            i += raw;
+        }
+        return out;
+    }
+
+    std::vector<uint8_t> EncodePPM(const std::vector<uint8_t>& pixels, uint32_t size)
+    {
+        std::string header = "P6\n# UICheckBench\n" + std::to_string(size) + " " + std::to_string(size) + "\n255\n";
+        std::vector<uint8_t> out(header.begin(), header.end());
+        out.reserve(out.size() + (size_t)size * size * 3);
+        for (size_t i = 0; i < (size_t)size * size; i++)
+            out.insert(out.end(), &pixels[i * 4], &pixels[i * 4] + 3);
+        return out;
+    }
+
+    // Level 0 against the source; alpha only where the format stores it
+    bool Matches(const Image& image, const std::vector<uint8_t>& pixels, bool alpha)
+    {
+        if (image.Levels.empty() || image.Levels[0].Pixels.size() != pixels.size()) return false;
+        const std::vector<uint8_t>& decoded = image.Levels[0].Pixels;
+        for (size_t i = 0; i < pixels.size(); i += 4)
+        {
+            if (std::memcmp(&decoded[i], &pixels[i], 3) != 0) return false;
+            if (decoded[i + 3] != (alpha ? pixels[i + 3] : 255)) return false;
+        }
+        return true;
+    }
+}
+
+// A size x size image written as BMP, TGA and PPM files, then loaded (map + decode + mips), best of 5
+BENCHMARK(ImageLoader, 2048)
+{
+    constexpr int RUNS = 5;
+
+    struct Format
+    {
+        const char* Name;
+        const char* File;
+        bool Alpha;
+        std::vector<uint8_t> Bytes;
+    };
+
+    std::vector<uint8_t> pixels = MakePixels(size);
+    std::vector<Format> formats;
+    formats.push_back({ "BMP 24-bit", "image24.bmp", false, EncodeBMP(pixels, size, 24) });
+    formats.push_back({ "BMP 32-bit", "image32.bmp", false, EncodeBMP(pixels, size, 32) });
+    formats.push_back({ "TGA 32-bit", "image32.tga", true, EncodeTGA(pixels, size, 32, false) });
+    formats.push_back({ "TGA 24-bit RLE", "image24_rle.tga", false, EncodeTGA(pixels, size, 24, true) });
+    formats.push_back({ "PPM P6", "image.ppm", false, EncodePPM(pixels, size) });
+
+    Bench::TempDir dir("images");
+    LOG_INFO("[ImageLoader] {0}x{1}, {2} mip levels, {3} KB RGBA8 level 0",
+             size, size, ImageLoader::GetMipCount(size, size), pixels.size() / 1024);
+
+    for (const Format& format : formats)
+    {
+        std::string path = (dir.Path / format.File).string();
+        std::ofstream(path, std::ios::binary).write((const char*)format.Bytes.data(), (std::streamsize)format.Bytes.size());
+
+        double bestMs = 0.0, decodeMs = 0.0, mipMs = 0.0;
+        Image image;
+        for (int run = 0; run < RUNS; run++)
+        {
+            ImageLoader::Stats before = ImageLoader::GetStats();
+            auto start = Clock::now();
+            if (!ImageLoader::Load(path, image))
+            {
+                LOG_ERROR("[ImageLoader]   {0}: failed to load", format.Name);
+                break;
+            }
+            double ms = ElapsedMs(start);
+            ImageLoader::Stats after = ImageLoader::GetStats();
+
+            if (run == 0 || ms < bestMs)
+            {
+                bestMs = ms;
+                decodeMs = after.DecodeMs - before.DecodeMs;
+                mipMs = after.MipMs - before.MipMs;
+            }
+        }
+        if (!image.IsValid()) continue;
+
+        if (!Matches(image, pixels, format.Alpha))
+            LOG_ERROR("[ImageLoader]   {0}: decoded pixels differ from the source", format.Name);
+
+        const uint64_t decoded = image.Levels[0].Pixels.size();
+        const uint64_t mips = image.GetByteSize() - decoded;
+        auto mbPerSecond = [](uint64_t bytes, double ms) { return ms > 0.0 ? (bytes / (1024.0 * 1024.0)) / (ms / 1000.0) : 0.0; };
+
+        LOG_INFO("[ImageLoader]   {0}: {1} KB file, {2} ms total, decode {3} MB/s ({4} ms), mips {5} KB at {6} MB/s ({7} ms)",
+                 format.Name, format.Bytes.size() / 1024, bestMs, mbPerSecond(decoded, decodeMs), decodeMs,
+                 mips / 1024, mbPerSecond(mips, mipMs), mipMs);
+    }
+}
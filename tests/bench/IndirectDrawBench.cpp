@@ -0,0 +1,63 @@
+#include "Bench.hpp"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <Core/Log.hpp>
+#include <Rendering/IndirectDraw.hpp>
+
+using Bench::Clock;
+using Bench::ElapsedMs;
+
+// `size` draws over 64 arena ranges in two vertex formats: Add + Build per frame, 1 thread vs all
+BENCHMARK(IndirectDrawBuilder, 100000)
+{
+    constexpr uint32_t MESHES = 64;
+    constexpr int FRAMES = 20;
+
+    std::vector<MeshArena::Allocation> meshes(MESHES);
+    for (uint32_t m = 0; m < MESHES; m++)
+    {
+        meshes[m].BaseVertex = m * 1000;
+        meshes[m].VertexCount = 1000;
+        meshes[m].FirstIndex = m * 3000;
+        meshes[m].IndexCount = 3000;
+        meshes[m].Format = m % 2 ? VertexFormat::Quantized : VertexFormat::Float32;
+    }
+
+    std::vector<glm::mat4> models(size);
+    for (uint32_t i = 0; i < size; i++)
+        models[i] = glm::translate(glm::mat4(1.0f), glm::vec3((float)(i % 100), 0.0f, (float)(i / 100)));
+
+    const uint32_t cores = std::max(1u, std::thread::hardware_concurrency());
+    const glm::vec4 color(0.8f, 0.8f, 0.8f, 1.0f);
+    IndirectDrawBuilder builder;
+
+    LOG_INFO("[IndirectDrawBuilder] {0} draws, {1} frames each", size, FRAMES);
+    std::vector<uint32_t> threadCounts = { 1 };
+    if (cores > 1) threadCounts.push_back(cores);
+
+    for (uint32_t workers : threadCounts)
+    {
+        double addMs = 0.0, buildMs = 0.0;
+        for (int frame = 0; frame < FRAMES; frame++)
+        {
+            auto start = Clock::now();
+            builder.Clear();
+            for (uint32_t i = 0; i < size; i++)
+                builder.Add(models[i], meshes[i % MESHES]);
+            addMs += ElapsedMs(start);
+
+            start = Clock::now();
+            builder.Build(color, workers);
+            buildMs += ElapsedMs(start);
+        }
+
+        addMs /= FRAMES;
+        buildMs /= FRAMES;
+        LOG_INFO("[IndirectDrawBuilder]   {0} thread(s): Add {1} ms, Build {2} ms, {3} M draws/s",
+                 workers, addMs, buildMs, (size / 1e6) / ((addMs + buildMs) / 1000.0));
+    }
+}
@@ -0,0 +1,45 @@
+#include "Bench.hpp"
+#include "GridObj.hpp"
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Core/Log.hpp>
+#include <Rendering/Mesh/Mesh.hpp>
+#include <Rendering/Mesh/ObjImporter.hpp>
+
+// A generated grid OBJ of `size` MB parsed from memory: 1 worker vs all cores, best of 3
+BENCHMARK(ObjImporter, 64)
+{
+    constexpr int RUNS = 3;
+
+    const uint32_t side = std::max(2u, (uint32_t)std::sqrt(size * 1024.0 * 1024.0 / Bench::GRID_OBJ_BYTES_PER_VERTEX));
+    std::string obj = Bench::MakeGridObj(side);
+    const uint32_t cores = std::max(1u, std::thread::hardware_concurrency());
+    LOG_INFO("[ObjImporter] {0} MB grid OBJ, {1} cores", obj.size() / (1024.0 * 1024.0), cores);
+
+    std::vector<uint32_t> threadCounts = { 1 };
+    if (cores > 1) threadCounts.push_back(cores);
+
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    for (uint32_t workers : threadCounts)
+    {
+        ObjImporter::Stats best;
+        for (int run = 0; run < RUNS; run++)
+        {
+            ObjImporter::Stats stats;
+            if (!ObjImporter::Parse(obj.data(), obj.size(), vertices, indices, &stats, workers))
+            {
+                LOG_ERROR("[ObjImporter] Generated OBJ did not parse");
+                return;
+            }
+            if (run == 0 || stats.TotalMs < best.TotalMs) best = stats;
+        }
+
+        LOG_INFO("[ObjImporter]   {0} worker(s) ({1} used): {2} MB/s, parse {3} ms, weld {4} ms, {5} vertices, {6} triangles",
+                 workers, best.Threads, best.GetMBPerSecond(), best.ParseMs, best.WeldMs, best.Vertices, best.Triangles);
+    }
+}
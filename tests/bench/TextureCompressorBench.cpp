@@ -0,0 +1,105 @@
+#include "Bench.hpp"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <thread>
+
+#include <Core/Log.hpp>
+#include <Rendering/Image.hpp>
+#include <Rendering/TextureCompressor.hpp>
+
+using Bench::Clock;
+using Bench::ElapsedMs;
+
+namespace
+{
+    // Smooth value noise, brick edges and fine grain - closer to real albedo than white noise.
+    // With alpha, a radial falloff from the centre.
+    Image MakeAlbedo(uint32_t size, bool alpha, uint32_t seed)
+    {
+        constexpr int GRID = 17;
+
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+        std::normal_distribution<float> grain(0.0f, 4.0f);
+        float grid[3][GRID][GRID];
+        for (auto& channel : grid)
+            for (auto& row : channel)
+                for (float& value : row) value = uniform(rng);
+
+        auto noise = [&](int c, float x, float y)
+        {
+            x *= GRID - 1;
+            y *= GRID - 1;
+            int xi = std::min((int)x, GRID - 2), yi = std::min((int)y, GRID - 2);
+            float fx = x - xi, fy = y - yi;
+            fx = fx * fx * (3.0f - 2.0f * fx);
+            fy = fy * fy * (3.0f - 2.0f * fy);
+            float top = grid[c][yi][xi] + (grid[c][yi][xi + 1] - grid[c][yi][xi]) * fx;
+            float bottom = grid[c][yi + 1][xi] + (grid[c][yi + 1][xi + 1] - grid[c][yi + 1][xi]) * fx;
+            return top + (bottom - top) * fy;
+        };
+
+        Image image;
+        image.Levels.resize(1);
+        Image::Level& level = image.Levels[0];
+        level.Width = level.Height = size;
+        level.Pixels.resize((size_t)size * size * 4);
+        for (uint32_t y = 0; y < size; y++)
+        {
+            for (uint32_t x = 0; x < size; x++)
+            {
+                float fx = (float)x / size, fy = (float)y / size;
+                uint8_t* texel = &level.Pixels[((size_t)y * size + x) * 4];
+                bool mortar = ((x / 32 + (y / 16) % 2) % 4 == 0) || (y % 16 == 0);
+                for (int c = 0; c < 3; c++)
+                {
+                    float value = noise(c, fx, fy) * 200.0f + 30.0f + grain(rng);
+                    if (mortar) value *= 0.5f;
+                    texel[c] = (uint8_t)std::clamp(value, 0.0f, 255.0f);
+                }
+                texel[3] = alpha ? (uint8_t)std::clamp(255.0f * (1.2f - 2.0f * std::hypot(fx - 0.5f, fy - 0.5f)), 0.0f, 255.0f) : 255;
+            }
+        }
+        ImageLoader::GenerateMips(image);
+        return image;
+    }
+}
+
+// A size x size albedo with a full mip chain, opaque and with alpha, in every format and quality
+BENCHMARK(TextureCompressor, 1024)
+{
+    using TextureCompressor::Quality;
+
+    const uint32_t cores = std::max(1u, std::thread::hardware_concurrency());
+    for (bool alpha : { false, true })
+    {
+        Image source = MakeAlbedo(size, alpha, alpha ? 2 : 1);
+
+        uint64_t texels = 0;
+        for (const Image::Level& level : source.Levels)
+            texels += (uint64_t)level.Width * level.Height;
+
+        LOG_INFO("[TextureCompressor] {0}x{1} {2}, {3} levels, {4} threads, {5} KB RGBA8",
+                 size, size, alpha ? "with alpha" : "opaque", source.Levels.size(), cores, source.GetByteSize() / 1024);
+
+        for (TextureFormat format : { TextureFormat::BC1, TextureFormat::BC3, TextureFormat::BC7 })
+        {
+            for (uint32_t q = 0; q < (uint32_t)Quality::Count; q++)
+            {
+                Image compressed;
+                auto start = Clock::now();
+                if (!TextureCompressor::Compress(source, format, (Quality)q, compressed)) continue;
+                double ms = ElapsedMs(start);
+
+                double mtexels = ms > 0.0 ? (texels / 1e6) / (ms / 1000.0) : 0.0;
+                double psnr = TextureCompressor::ComputePSNR(source, compressed);
+                double alphaPsnr = format == TextureFormat::BC1 ? 0.0 : TextureCompressor::ComputePSNR(source, compressed, 0, true);
+
+                LOG_INFO("[TextureCompressor]   {0} {1}: {2} MTexel/s ({3} ms), {4} KB, PSNR {5} dB, alpha {6} dB",
+                         Image::GetFormatName(format), TextureCompressor::GetQualityName((Quality)q), mtexels, ms,
+                         compressed.GetByteSize() / 1024, psnr, alphaPsnr);
+            }
+        }
+    }
+}
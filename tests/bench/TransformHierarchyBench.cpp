@@ -0,0 +1,91 @@
+#include "Bench.hpp"
+#include <algorithm>
+#include <thread>
+
+#include <Core/Log.hpp>
+#include <Scene/Components.hpp>
+#include <Scene/Scene.hpp>
+#include <Scene/TransformHierarchy.hpp>
+
+using Bench::Clock;
+using Bench::ElapsedMs;
+
+// Wide (one root, size - 1 children), deep (one chain) and 8-ary trees: rebuild and propagation timings
+BENCHMARK(TransformHierarchy, 1000000)
+{
+    if (size < 2) return;
+
+    struct Shape
+    {
+        const char* Name;
+        uint32_t (*ParentOf)(uint32_t);
+    };
+    static const Shape SHAPES[] =
+    {
+        { "wide", [](uint32_t) { return 0u; } },
+        { "deep", [](uint32_t i) { return i - 1; } },
+        { "8-ary", [](uint32_t i) { return (i - 1) / 8; } },
+    };
+
+    const uint32_t cores = std::max(1u, std::thread::hardware_concurrency());
+    LOG_INFO("[TransformHierarchy] {0} nodes, {1} threads", size, cores);
+
+    for (const Shape& shape : SHAPES)
+    {
+        Scene scene;
+        auto& reg = scene.Reg();
+        TransformHierarchy& hierarchy = scene.GetTransforms();
+
+        std::vector<entt::entity> entities(size);
+        for (uint32_t i = 0; i < size; i++)
+        {
+            entities[i] = reg.create();
+            reg.emplace<TransformComponent>(entities[i], glm::vec3(0.001f * (float)(i % 7), 0.01f, 0.0f));
+        }
+
+        auto start = Clock::now();
+        for (uint32_t i = 1; i < size; i++)
+            hierarchy.SetParent(entities[i], entities[shape.ParentOf(i)], false);
+        double linkMs = ElapsedMs(start);
+
+        hierarchy.Update(cores);
+        double rebuildMs = hierarchy.GetStats().LastRebuildMs;
+        double firstMs = hierarchy.GetStats().LastPropagateMs;
+
+        auto moveRoot = [&]() { reg.patch<TransformComponent>(entities[0], [](TransformComponent& t) { t.Position.x += 1.0f; }); };
+        moveRoot();
+        hierarchy.Update(1);
+        double allSerialMs = hierarchy.GetStats().LastPropagateMs;
+        moveRoot();
+        hierarchy.Update(cores);
+        double allParallelMs = hierarchy.GetStats().LastPropagateMs;
+        uint32_t allUpdated = hierarchy.GetStats().LastUpdated;
+        uint32_t allWorkers = hierarchy.GetStats().LastWorkers;
+
+        reg.patch<TransformComponent>(entities[size - 1], [](TransformComponent& t) { t.Rotation.y += 10.0f; });
+        hierarchy.Update(cores);
+        double leafMs = hierarchy.GetStats().LastPropagateMs;
+
+        // Two edits at opposite ends of the deepest level: only their subtrees are visited
+        reg.patch<TransformComponent>(entities[size / 2 + 1], [](TransformComponent& t) { t.Position.y += 1.0f; });
+        reg.patch<TransformComponent>(entities[size - 1], [](TransformComponent& t) { t.Position.y += 1.0f; });
+        hierarchy.Update(cores);
+        double scatteredMs = hierarchy.GetStats().LastPropagateMs;
+        uint32_t scatteredUpdated = hierarchy.GetStats().LastUpdated;
+
+        hierarchy.Update(cores);
+        double cleanMs = hierarchy.GetStats().LastPropagateMs;
+
+        // What the renderer used to do every frame: every local matrix, no parents
+        start = Clock::now();
+        float checksum = 0.0f;
+        reg.view<TransformComponent>().each([&](auto, const TransformComponent& transform) { checksum += transform.GetMatrix()[3][0]; });
+        double localOnlyMs = ElapsedMs(start);
+
+        LOG_INFO("[TransformHierarchy]   {0}: {1} levels; link {2} ms, rebuild {3} ms, first update {4} ms",
+                 shape.Name, hierarchy.GetStats().Levels, linkMs, rebuildMs, firstMs);
+        LOG_INFO("[TransformHierarchy]   {0}: root moved ({1} nodes) {2} ms on 1 thread, {3} ms on {4}; one leaf {5} ms; two scattered ({6} nodes) {7} ms; clean {8} ms",
+                 shape.Name, allUpdated, allSerialMs, allParallelMs, allWorkers, leafMs, scatteredUpdated, scatteredMs, cleanMs);
+        LOG_INFO("[TransformHierarchy]   {0}: local matrices only (old per-frame cost) {1} ms (checksum {2})", shape.Name, localOnlyMs, checksum);
+    }
+}
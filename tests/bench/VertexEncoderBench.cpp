@@ -0,0 +1,53 @@
+#include "Bench.hpp"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <Core/Log.hpp>
+#include <Rendering/Mesh/Mesh.hpp>
+#include <Rendering/Mesh/VertexLayout.hpp>
+
+using Bench::Clock;
+using Bench::ElapsedMs;
+
+// `size` vertices (positions within +-100, unit normals) encoded into every format, best of 5
+BENCHMARK(VertexEncoder, 1000000)
+{
+    constexpr int RUNS = 5;
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> range(-100.0f, 100.0f);
+    std::normal_distribution<float> direction(0.0f, 1.0f);
+    std::vector<Vertex> vertices(size);
+    for (Vertex& vertex : vertices)
+    {
+        vertex.Position = glm::vec3(range(rng), range(rng), range(rng));
+        glm::vec3 normal(direction(rng), direction(rng), direction(rng));
+        vertex.Normal = normal / std::max(glm::length(normal), 1e-6f);
+    }
+
+    LOG_INFO("[VertexEncoder] {0} vertices, {1} KB as Vertex", size, (uint64_t)size * sizeof(Vertex) / 1024);
+
+    std::vector<uint8_t> encoded;
+    for (uint32_t f = 0; f < (uint32_t)VertexFormat::Count; f++)
+    {
+        VertexFormat format = (VertexFormat)f;
+        const uint32_t stride = VertexEncoder::GetLayout(format).Stride;
+        encoded.assign((size_t)size * stride, 0);
+
+        double bestMs = 0.0;
+        for (int run = 0; run < RUNS; run++)
+        {
+            auto start = Clock::now();
+            VertexEncoder::Encode(format, vertices.data(), size, encoded.data());
+            double ms = ElapsedMs(start);
+            if (run == 0 || ms < bestMs) bestMs = ms;
+        }
+
+        double mverts = bestMs > 0.0 ? (size / 1e6) / (bestMs / 1000.0) : 0.0;
+        double mbWritten = bestMs > 0.0 ? ((double)size * stride / (1024.0 * 1024.0)) / (bestMs / 1000.0) : 0.0;
+        LOG_INFO("[VertexEncoder]   {0}: {1} bytes/vertex, {2} KB, {3} ms, {4} M vertices/s, {5} MB/s written",
+                 VertexEncoder::GetFormatName(format), stride, (uint64_t)size * stride / 1024, bestMs, mverts, mbWritten);
+    }
+}